@@ -0,0 +1,78 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace LibGL::Benchmark
+{
+    class StressScene;
+
+    struct BenchmarkResult
+    {
+        std::string m_name;
+        std::string m_scene;
+        uint32_t    m_bodyCount;
+        uint64_t    m_operationCount;
+        double      m_nanoseconds;
+
+        // Combination of the benchmark's results, reported so the measured work can't be optimized away
+        uint64_t m_checksum;
+    };
+
+    /**
+     * \brief Times benchmarks and writes their results as JSON lines, one object per benchmark
+     */
+    class BenchmarkRunner
+    {
+    public:
+        /**
+         * \brief The measured work. Returns a checksum of its results
+         */
+        using Benchmark = std::function<uint64_t()>;
+
+        /**
+         * \brief Creates a runner writing its results to the given stream
+         * \param output The stream to write the results to
+         * \param threadCount The number of thread pool workers available to the benchmarks, reported with the results
+         */
+        BenchmarkRunner(std::ostream& output, uint32_t threadCount);
+
+        BenchmarkRunner(const BenchmarkRunner& other) = delete;
+        BenchmarkRunner(BenchmarkRunner&& other) noexcept = delete;
+        ~BenchmarkRunner() = default;
+
+        BenchmarkRunner& operator=(const BenchmarkRunner& other) = delete;
+        BenchmarkRunner& operator=(BenchmarkRunner&& other) noexcept = delete;
+
+        /**
+         * \brief Times the given benchmark and writes its result
+         * \param name The benchmark's name
+         * \param scene The scene the benchmark runs in
+         * \param operationCount The number of operations run by the benchmark
+         * \param benchmark The measured work
+         * \return The benchmark's result
+         */
+        const BenchmarkResult& run(const std::string& name, const StressScene& scene, uint64_t operationCount,
+                                   const Benchmark&   benchmark);
+
+        /**
+         * \brief Gets the results of every benchmark run so far
+         * \return The benchmarks' results
+         */
+        std::span<const BenchmarkResult> getResults() const;
+
+    private:
+        std::ostream&                m_output;
+        std::vector<BenchmarkResult> m_results;
+        uint32_t                     m_threadCount;
+
+        /**
+         * \brief Writes the given result as a single line JSON object
+         * \param result The result to write
+         */
+        void write(const BenchmarkResult& result) const;
+    };
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include "BenchmarkRunner.h"
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace LibGL::Benchmark
+{
+    class StressScene;
+
+    struct BenchmarkSettings
+    {
+        static constexpr float STEP_DURATION = 1.f / 60.f;
+
+        std::vector<uint32_t> m_bodyCounts = { 128, 512, 2048 };
+        uint32_t              m_stepCount = 120;
+        uint32_t              m_queryCount = 10000;
+        uint32_t              m_seed = 1;
+        uint32_t              m_threadCount = 0;
+
+        /**
+         * \brief Reads the settings from "--name=value" command line arguments, keeping the defaults of the missing ones
+         * \param argc The number of command line arguments
+         * \param argv The command line arguments, starting with the program's name
+         * \return True if every argument was valid. False otherwise.
+         */
+        bool parse(int argc, char* argv[]);
+
+        /**
+         * \brief Gets the description of the command line arguments
+         * \return The benchmark's usage
+         */
+        static std::string_view getUsage();
+    };
+
+    /**
+     * \brief Runs the physics benchmarks in a stress scene of each shape, layout and body count
+     */
+    class BenchmarkSuite
+    {
+    public:
+        /**
+         * \brief Creates a benchmark suite with the given settings
+         * \param runner The runner timing the benchmarks and writing their results
+         * \param settings The suite's settings
+         */
+        BenchmarkSuite(BenchmarkRunner& runner, BenchmarkSettings settings);
+
+        BenchmarkSuite(const BenchmarkSuite& other) = delete;
+        BenchmarkSuite(BenchmarkSuite&& other) noexcept = delete;
+        ~BenchmarkSuite() = default;
+
+        BenchmarkSuite& operator=(const BenchmarkSuite& other) = delete;
+        BenchmarkSuite& operator=(BenchmarkSuite&& other) noexcept = delete;
+
+        /**
+         * \brief Generates every stress scene and runs the benchmarks in each of them
+         */
+        void run();
+
+    private:
+        BenchmarkRunner&  m_runner;
+        BenchmarkSettings m_settings;
+
+        /**
+         * \brief Times ray casts and overlap queries from random points of the given scene
+         * \param scene The scene to query
+         */
+        void runQueries(StressScene& scene);
+
+        /**
+         * \brief Times the given scene's rigidbody steps
+         * \param scene The scene to simulate
+         */
+        void runSteps(StressScene& scene);
+    };
+}
@@ -0,0 +1,14 @@
+#pragma once
+#include <cstdint>
+
+namespace LibGL::Benchmark
+{
+    enum class EStressLayout : uint8_t
+    {
+        // Towers of touching bodies resting on the ground, keeping the solver busy
+        STACKED,
+
+        // Bodies spread at random above the ground, mostly falling freely
+        SCATTERED
+    };
+}
@@ -0,0 +1,12 @@
+#pragma once
+#include <cstdint>
+
+namespace LibGL::Benchmark
+{
+    enum class EStressShape : uint8_t
+    {
+        BOX,
+        SPHERE,
+        CAPSULE
+    };
+}
@@ -0,0 +1,113 @@
+#pragma once
+#include "EStressLayout.h"
+#include "EStressShape.h"
+
+#include <Scene.h>
+
+#include <Vector/Vector3.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+
+namespace LibGL::Benchmark
+{
+    /**
+     * \brief A headless scene filled with rigidbodies of a single shape on top of a static ground box.
+     * The bodies are placed from the given seed so that every run generates the same scene
+     */
+    class StressScene
+    {
+    public:
+        static constexpr float BODY_SIZE = 1.f;
+        static constexpr float STACK_HEIGHT = 10.f;
+
+        /**
+         * \brief Generates a scene of the given shape and layout
+         * \param shape The shape of the rigidbodies' colliders
+         * \param layout The way the rigidbodies are placed
+         * \param bodyCount The number of rigidbodies to create
+         * \param seed The seed of the random placement
+         */
+        StressScene(EStressShape shape, EStressLayout layout, uint32_t bodyCount, uint32_t seed);
+
+        StressScene(const StressScene& other) = delete;
+        StressScene(StressScene&& other) noexcept = delete;
+        ~StressScene() = default;
+
+        StressScene& operator=(const StressScene& other) = delete;
+        StressScene& operator=(StressScene&& other) noexcept = delete;
+
+        /**
+         * \brief Gets the scene's name, made of its shape and layout
+         * \return The scene's name
+         */
+        std::string getName() const;
+
+        /**
+         * \brief Gets the number of rigidbodies in the scene
+         * \return The scene's rigidbody count
+         */
+        uint32_t getBodyCount() const;
+
+        /**
+         * \brief Gets the half size of the ground, which contains every body on the horizontal axes
+         * \return The scene's horizontal half extent
+         */
+        float getHalfExtent() const;
+
+        /**
+         * \brief Gets the height under which every body starts
+         * \return The scene's starting height
+         */
+        float getHeight() const;
+
+        /**
+         * \brief Gets a random point inside the scene's volume, from the scene's own random sequence
+         * \return The random point
+         */
+        LibMath::Vector3 getRandomPoint();
+
+        /**
+         * \brief Gets a random normalized direction, from the scene's own random sequence
+         * \return The random direction
+         */
+        LibMath::Vector3 getRandomDirection();
+
+        /**
+         * \brief Converts the given shape to a lowercase name
+         * \param shape The shape to convert
+         * \return The shape's name
+         */
+        static const char* toString(EStressShape shape);
+
+        /**
+         * \brief Converts the given layout to a lowercase name
+         * \param layout The layout to convert
+         * \return The layout's name
+         */
+        static const char* toString(EStressLayout layout);
+
+    private:
+        Resources::Scene m_scene;
+        std::mt19937     m_random;
+        EStressShape     m_shape;
+        EStressLayout    m_layout;
+        uint32_t         m_bodyCount;
+        float            m_halfExtent;
+        float            m_height;
+
+        /**
+         * \brief Adds a rigidbody with a collider of the scene's shape at the given position
+         * \param position The body's position
+         */
+        void addBody(const LibMath::Vector3& position);
+
+        /**
+         * \brief Gets a random number from the scene's random sequence.
+         * The raw generator's output is converted by hand since the standard distributions differ between libraries
+         * \return A random number between 0 and 1
+         */
+        float getRandom();
+    };
+}
@@ -0,0 +1,53 @@
+#include "BenchmarkRunner.h"
+
+#include "StressScene.h"
+
+#include <chrono>
+#include <iomanip>
+
+namespace LibGL::Benchmark
+{
+    BenchmarkRunner::BenchmarkRunner(std::ostream& output, const uint32_t threadCount)
+        : m_output(output), m_threadCount(threadCount)
+    {
+    }
+
+    const BenchmarkResult& BenchmarkRunner::run(const std::string& name, const StressScene& scene,
+                                                const uint64_t     operationCount, const Benchmark& benchmark)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        const Clock::time_point start = Clock::now();
+        const uint64_t          checksum = benchmark();
+        const Clock::time_point end = Clock::now();
+
+        const std::chrono::duration<double, std::nano> duration = end - start;
+
+        m_results.push_back({
+            name, scene.getName(), scene.getBodyCount(), operationCount, duration.count(), checksum
+        });
+
+        write(m_results.back());
+        return m_results.back();
+    }
+
+    std::span<const BenchmarkResult> BenchmarkRunner::getResults() const
+    {
+        return m_results;
+    }
+
+    void BenchmarkRunner::write(const BenchmarkResult& result) const
+    {
+        const double operationCount = static_cast<double>(result.m_operationCount);
+        const double nanosecondsPerOperation = operationCount > 0. ? result.m_nanoseconds / operationCount : 0.;
+        const double operationsPerSecond = result.m_nanoseconds > 0. ? operationCount * 1e9 / result.m_nanoseconds : 0.;
+
+        // The names never contain characters which would need to be escaped
+        m_output << std::fixed << std::setprecision(3)
+            << "{\"benchmark\":\"" << result.m_name << "\",\"scene\":\"" << result.m_scene
+            << "\",\"bodies\":" << result.m_bodyCount << ",\"threads\":" << m_threadCount
+            << ",\"operations\":" << result.m_operationCount << ",\"total_ns\":" << result.m_nanoseconds
+            << ",\"ns_per_op\":" << nanosecondsPerOperation << ",\"ops_per_second\":" << operationsPerSecond
+            << ",\"checksum\":" << result.m_checksum << "}" << std::endl;
+    }
+}
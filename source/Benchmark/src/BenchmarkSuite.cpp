@@ -0,0 +1,187 @@
+#include "BenchmarkSuite.h"
+
+#include "StressScene.h"
+
+#include <ColliderOverlaps.h>
+#include <ICollider.h>
+#include <Raycast.h>
+#include <Rigidbody.h>
+
+#include <algorithm>
+#include <charconv>
+#include <utility>
+
+using namespace LibGL::Physics;
+using namespace LibMath;
+
+namespace LibGL::Benchmark
+{
+    bool BenchmarkSettings::parse(const int argc, char* argv[])
+    {
+        const auto parseNumber = [](const std::string_view text, uint32_t& out)
+        {
+            const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), out);
+            return error == std::errc() && end == text.data() + text.size();
+        };
+
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view argument = argv[i];
+            const size_t           separator = argument.find('=');
+
+            if (!argument.starts_with("--") || separator == std::string_view::npos)
+                return false;
+
+            const std::string_view name = argument.substr(2, separator - 2);
+            const std::string_view value = argument.substr(separator + 1);
+
+            if (name == "bodies")
+            {
+                m_bodyCounts.clear();
+
+                for (size_t start = 0; start <= value.size();)
+                {
+                    const size_t end = std::min(value.find(',', start), value.size());
+                    uint32_t     bodyCount;
+
+                    if (!parseNumber(value.substr(start, end - start), bodyCount) || bodyCount == 0)
+                        return false;
+
+                    m_bodyCounts.push_back(bodyCount);
+                    start = end + 1;
+                }
+            }
+            else if (name == "steps")
+            {
+                if (!parseNumber(value, m_stepCount))
+                    return false;
+            }
+            else if (name == "queries")
+            {
+                if (!parseNumber(value, m_queryCount))
+                    return false;
+            }
+            else if (name == "seed")
+            {
+                if (!parseNumber(value, m_seed))
+                    return false;
+            }
+            else if (name == "threads")
+            {
+                if (!parseNumber(value, m_threadCount))
+                    return false;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::string_view BenchmarkSettings::getUsage()
+    {
+        return "Usage: Benchmark [--bodies=128,512,2048] [--steps=120] [--queries=10000] [--seed=1] [--threads=0]\n"
+            "Writes one JSON object per benchmark and scene to the standard output.\n"
+            "--threads sets the thread pool's worker count, 0 running everything on the main thread.\n";
+    }
+
+    BenchmarkSuite::BenchmarkSuite(BenchmarkRunner& runner, BenchmarkSettings settings)
+        : m_runner(runner), m_settings(std::move(settings))
+    {
+    }
+
+    void BenchmarkSuite::run()
+    {
+        for (const EStressShape shape : { EStressShape::BOX, EStressShape::SPHERE, EStressShape::CAPSULE })
+        {
+            for (const EStressLayout layout : { EStressLayout::STACKED, EStressLayout::SCATTERED })
+            {
+                for (const uint32_t bodyCount : m_settings.m_bodyCounts)
+                {
+                    StressScene scene(shape, layout, bodyCount, m_settings.m_seed);
+
+                    // Creating the broadphase proxies isn't part of the queries' cost
+                    ICollider::getBroadphase();
+
+                    runQueries(scene);
+                    runSteps(scene);
+                }
+            }
+        }
+    }
+
+    void BenchmarkSuite::runQueries(StressScene& scene)
+    {
+        const uint32_t queryCount = m_settings.m_queryCount;
+        const float    maxDistance = scene.getHalfExtent() * 2.f;
+
+        std::vector<Ray>     rays(queryCount);
+        std::vector<Vector3> points(queryCount);
+
+        for (uint32_t i = 0; i < queryCount; ++i)
+        {
+            rays[i] = { scene.getRandomPoint(), scene.getRandomDirection() };
+            points[i] = scene.getRandomPoint();
+        }
+
+        std::vector<RaycastHit> hits(queryCount);
+        std::vector<ICollider*> overlaps;
+
+        m_runner.run("raycast", scene, queryCount, [&rays, &hits, maxDistance]
+        {
+            uint64_t hitCount = 0;
+
+            for (size_t i = 0; i < rays.size(); ++i)
+                hitCount += raycast(rays[i].m_origin, rays[i].m_direction, hits[i], maxDistance) ? 1 : 0;
+
+            return hitCount;
+        });
+
+        m_runner.run("raycast_batch", scene, queryCount, [&rays, &hits, maxDistance]
+        {
+            return static_cast<uint64_t>(raycastBatch(rays, hits, maxDistance));
+        });
+
+        m_runner.run("overlap_sphere", scene, queryCount, [&points, &overlaps]
+        {
+            uint64_t overlapCount = 0;
+
+            for (const Vector3& point : points)
+            {
+                overlapSphere({ point, StressScene::BODY_SIZE }, overlaps);
+                overlapCount += overlaps.size();
+            }
+
+            return overlapCount;
+        });
+
+        m_runner.run("overlap_box", scene, queryCount, [&points, &overlaps]
+        {
+            uint64_t overlapCount = 0;
+
+            for (const Vector3& point : points)
+            {
+                overlapBox({ point, Vector3(StressScene::BODY_SIZE * 2.f) }, overlaps);
+                overlapCount += overlaps.size();
+            }
+
+            return overlapCount;
+        });
+    }
+
+    void BenchmarkSuite::runSteps(StressScene& scene)
+    {
+        const uint32_t stepCount = m_settings.m_stepCount;
+
+        // The state hash depends on every step's result, it only matches between runs of a deterministic build
+        m_runner.run("step", scene, stepCount, [stepCount]
+        {
+            for (uint32_t i = 0; i < stepCount; ++i)
+                Rigidbody::step(BenchmarkSettings::STEP_DURATION);
+
+            return Rigidbody::computeStateHash();
+        });
+    }
+}
@@ -0,0 +1,168 @@
+#include "StressScene.h"
+
+#include <Arithmetic.h>
+#include <BoxCollider.h>
+#include <CapsuleCollider.h>
+#include <Rigidbody.h>
+#include <SphereCollider.h>
+
+#include <Debug/Assertion.h>
+
+#include <cmath>
+
+using namespace LibGL::Physics;
+using namespace LibMath;
+
+namespace LibGL::Benchmark
+{
+    StressScene::StressScene(const EStressShape shape, const EStressLayout layout, const uint32_t bodyCount,
+                             const uint32_t     seed)
+        : m_random(seed), m_shape(shape), m_layout(layout), m_bodyCount(bodyCount)
+    {
+        ASSERT(bodyCount > 0, "A stress scene needs at least one body");
+
+        if (layout == EStressLayout::STACKED)
+        {
+            // The towers are laid on a square grid, a body apart from each other
+            const auto towerCount = static_cast<uint32_t>(std::ceil(static_cast<float>(bodyCount) / STACK_HEIGHT));
+            const auto columnCount = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<float>(towerCount))));
+            const float spacing = BODY_SIZE * 2.f;
+
+            m_halfExtent = static_cast<float>(columnCount) * spacing / 2.f + BODY_SIZE;
+            m_height = STACK_HEIGHT * BODY_SIZE;
+
+            for (uint32_t i = 0; i < bodyCount; ++i)
+            {
+                const uint32_t tower = i / static_cast<uint32_t>(STACK_HEIGHT);
+                const uint32_t level = i % static_cast<uint32_t>(STACK_HEIGHT);
+
+                const float offset = static_cast<float>(columnCount - 1) / 2.f;
+                const float x = (static_cast<float>(tower % columnCount) - offset) * spacing;
+                const float z = (static_cast<float>(tower / columnCount) - offset) * spacing;
+
+                addBody({ x, (static_cast<float>(level) + .5f) * BODY_SIZE, z });
+            }
+        }
+        else
+        {
+            // Leaves roughly 8 times a body's volume to each body
+            const float side = std::ceil(std::cbrt(static_cast<float>(bodyCount))) * BODY_SIZE * 2.f;
+
+            m_halfExtent = side / 2.f;
+            m_height = side + BODY_SIZE;
+
+            for (uint32_t i = 0; i < bodyCount; ++i)
+            {
+                Vector3 position = getRandomPoint();
+                position.m_y = max(position.m_y, BODY_SIZE);
+
+                addBody(position);
+            }
+        }
+
+        Entity& ground = m_scene.addNode<Entity>(nullptr, Transform());
+        ground.setPosition({ 0.f, -BODY_SIZE / 2.f, 0.f });
+        ground.addComponent<BoxCollider>(Vector3::zero(), Vector3(m_halfExtent * 2.f, BODY_SIZE, m_halfExtent * 2.f));
+    }
+
+    std::string StressScene::getName() const
+    {
+        return std::string(toString(m_shape)) + "_" + toString(m_layout);
+    }
+
+    uint32_t StressScene::getBodyCount() const
+    {
+        return m_bodyCount;
+    }
+
+    float StressScene::getHalfExtent() const
+    {
+        return m_halfExtent;
+    }
+
+    float StressScene::getHeight() const
+    {
+        return m_height;
+    }
+
+    Vector3 StressScene::getRandomPoint()
+    {
+        const float x = (getRandom() * 2.f - 1.f) * m_halfExtent;
+        const float y = getRandom() * m_height;
+        const float z = (getRandom() * 2.f - 1.f) * m_halfExtent;
+
+        return { x, y, z };
+    }
+
+    Vector3 StressScene::getRandomDirection()
+    {
+        // Rejecting the points outside of the unit sphere keeps the directions uniform
+        while (true)
+        {
+            const float x = getRandom() * 2.f - 1.f;
+            const float y = getRandom() * 2.f - 1.f;
+            const float z = getRandom() * 2.f - 1.f;
+
+            const Vector3 direction(x, y, z);
+            const float   lengthSquared = direction.magnitudeSquared();
+
+            if (lengthSquared > .0001f && lengthSquared <= 1.f)
+                return direction / std::sqrt(lengthSquared);
+        }
+    }
+
+    const char* StressScene::toString(const EStressShape shape)
+    {
+        switch (shape)
+        {
+        case EStressShape::BOX:
+            return "box";
+        case EStressShape::SPHERE:
+            return "sphere";
+        case EStressShape::CAPSULE:
+            return "capsule";
+        default:
+            return "unknown";
+        }
+    }
+
+    const char* StressScene::toString(const EStressLayout layout)
+    {
+        switch (layout)
+        {
+        case EStressLayout::STACKED:
+            return "stacked";
+        case EStressLayout::SCATTERED:
+            return "scattered";
+        default:
+            return "unknown";
+        }
+    }
+
+    void StressScene::addBody(const Vector3& position)
+    {
+        Entity& entity = m_scene.addNode<Entity>(nullptr, Transform());
+        entity.setPosition(position);
+
+        switch (m_shape)
+        {
+        case EStressShape::BOX:
+            entity.addComponent<BoxCollider>(Vector3::zero(), Vector3(BODY_SIZE));
+            break;
+        case EStressShape::SPHERE:
+            entity.addComponent<SphereCollider>(Vector3::zero(), BODY_SIZE / 2.f);
+            break;
+        case EStressShape::CAPSULE:
+            entity.addComponent<CapsuleCollider>(Vector3::zero(), Vector3::up(), BODY_SIZE, BODY_SIZE * .3f);
+            break;
+        }
+
+        entity.addComponent<Rigidbody>();
+    }
+
+    float StressScene::getRandom()
+    {
+        // Keeps the generator's top 24 bits, which a float holds exactly
+        return static_cast<float>(m_random() >> 8) / 16777216.f;
+    }
+}
@@ -0,0 +1,38 @@
+#include "BenchmarkRunner.h"
+#include "BenchmarkSuite.h"
+
+#include <Utility/ServiceLocator.h>
+#include <Utility/ThreadPool.h>
+
+#include <iostream>
+#include <memory>
+
+using namespace LibGL::Benchmark;
+using namespace LibGL::Utility;
+
+int main(const int argc, char* argv[])
+{
+    BenchmarkSettings settings;
+
+    if (!settings.parse(argc, argv))
+    {
+        std::cerr << BenchmarkSettings::getUsage();
+        return 1;
+    }
+
+    // The physics split the batched ray casts and the islands across the workers when the pool is available
+    std::unique_ptr<ThreadPool> threadPool;
+
+    if (settings.m_threadCount > 0)
+    {
+        threadPool = std::make_unique<ThreadPool>(settings.m_threadCount);
+        LibGL::ServiceLocator::provide<ThreadPool>(*threadPool);
+    }
+
+    BenchmarkRunner runner(std::cout, settings.m_threadCount);
+    BenchmarkSuite  suite(runner, std::move(settings));
+
+    suite.run();
+
+    return 0;
+}
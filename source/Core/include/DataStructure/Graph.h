@@ -42,6 +42,19 @@ namespace LibGL::DataStructure
          */
         void removeNode(const NodeT& node);
 
+        /**
+         * \brief Adds an existing node to the graph's root nodes
+         * \param node The node to add to the graph
+         */
+        void attachNode(const std::shared_ptr<NodeT>& node);
+
+        /**
+         * \brief Removes the given node from the graph's root nodes without destroying it
+         * \param node The node to remove from the graph
+         * \return A pointer to the detached node. nullptr if the node wasn't a root node of the graph
+         */
+        std::shared_ptr<NodeT> detachNode(const NodeT& node);
+
         /**
          * \brief Gets the graph's root nodes list
          * \return The graph's root nodes list
@@ -54,6 +67,18 @@ namespace LibGL::DataStructure
          */
         std::vector<std::shared_ptr<const NodeT>> getNodes() const;
 
+        /**
+         * \brief Gets the number of root nodes of the graph
+         * \return The graph's root node count
+         */
+        size_t getNodeCount() const;
+
+        /**
+         * \brief Reserves memory for the given number of root nodes
+         * \param count The number of root nodes to reserve memory for
+         */
+        void reserve(size_t count);
+
         /**
          * \brief Checks whether or not the graph is empty
          * \return True if the graph is empty. False otherwise
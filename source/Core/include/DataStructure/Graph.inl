@@ -26,10 +26,32 @@ namespace LibGL::DataStructure
     template <class NodeT>
     void Graph<NodeT>::removeNode(const NodeT& node)
     {
-        const auto nodeIter = std::find(m_nodes.begin(), m_nodes.end(), std::make_shared<NodeT>(&node));
+        detachNode(node);
+    }
 
-        if (nodeIter != m_nodes.end())
-            m_nodes.erase(nodeIter);
+    template <class NodeT>
+    void Graph<NodeT>::attachNode(const std::shared_ptr<NodeT>& node)
+    {
+        m_nodes.push_back(node);
+    }
+
+    template <class NodeT>
+    std::shared_ptr<NodeT> Graph<NodeT>::detachNode(const NodeT& node)
+    {
+        const auto findFunc = [&node](const std::shared_ptr<NodeT>& ptr)
+        {
+            return ptr.get() == &node;
+        };
+
+        const auto nodeIter = std::find_if(m_nodes.begin(), m_nodes.end(), findFunc);
+
+        if (nodeIter == m_nodes.end())
+            return nullptr;
+
+        std::shared_ptr<NodeT> detachedNode = *nodeIter;
+        m_nodes.erase(nodeIter);
+
+        return detachedNode;
     }
 
     template <class NodeT>
@@ -50,6 +72,18 @@ namespace LibGL::DataStructure
         return nodes;
     }
 
+    template <class NodeT>
+    size_t Graph<NodeT>::getNodeCount() const
+    {
+        return m_nodes.size();
+    }
+
+    template <class NodeT>
+    void Graph<NodeT>::reserve(const size_t count)
+    {
+        m_nodes.reserve(count);
+    }
+
     template <class NodeT>
     bool Graph<NodeT>::isEmpty() const
     {
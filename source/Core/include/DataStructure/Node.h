@@ -12,11 +12,22 @@ namespace LibGL::DataStructure
 
         Node() = default;
         explicit Node(Node* parent);
-        Node(const Node& other) = default;
+
+        /**
+         * \brief Creates a detached copy of the given node.
+         * The children aren't shared with the copied node since a node can only have one parent.
+         * \param other The node to copy
+         */
+        Node(const Node& other);
         Node(Node&& other) noexcept = default;
         virtual ~Node();
 
-        Node& operator=(const Node& other) = default;
+        /**
+         * \brief Copies the given node, keeping the current parent and children
+         * \param other The node to copy
+         * \return A reference to the current node
+         */
+        Node& operator=(const Node& other);
         Node& operator=(Node&& other) noexcept = default;
 
         /**
@@ -78,6 +89,19 @@ namespace LibGL::DataStructure
          */
         void removeChild(Node& child);
 
+        /**
+         * \brief Adds an existing node to this node's children
+         * \param child The node to add to the node's children
+         */
+        void attachChild(const NodePtr& child);
+
+        /**
+         * \brief Removes the given node from this node's children without destroying it
+         * \param child The child to remove from the node's children
+         * \return A pointer to the detached child. nullptr if the node wasn't a child of this node
+         */
+        NodePtr detachChild(Node& child);
+
     protected:
         /**
          * \brief The action to perform after a child was added
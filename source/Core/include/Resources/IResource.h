@@ -1,5 +1,6 @@
 #pragma once
 #include <string>
+#include <typeinfo>
 #include <unordered_map>
 
 #define REGISTER_RESOURCE_TYPE(Type) static uint8_t reg_##Type = (LibGL::Resources::IResource::registerType<Type>(#Type), 0)
@@ -52,11 +53,20 @@ namespace LibGL::Resources
          */
         inline static IResource* create(const std::string& type);
 
+        /**
+         * \brief Gets the name the given resource's type was registered with
+         * \param resource The resource whose type name should be returned
+         * \return The resource's type name on success, an empty string otherwise
+         */
+        inline static std::string getTypeName(const IResource& resource);
+
     private:
         using AllocFunc = IResource* (*)();
         using TypeMap = std::unordered_map<std::string, AllocFunc>;
+        using TypeNameMap = std::unordered_map<size_t, std::string>;
 
-        inline static TypeMap m_resourceTypes{};
+        inline static TypeMap     m_resourceTypes{};
+        inline static TypeNameMap m_typeNames{};
     };
 }
 
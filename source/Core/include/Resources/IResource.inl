@@ -21,10 +21,18 @@ namespace LibGL::Resources
         m_resourceTypes[name] = []() -> IResource* {
             return new T();
         };
+
+        m_typeNames[typeid(T).hash_code()] = name;
     }
 
     inline IResource* IResource::create(const std::string& type)
     {
         return m_resourceTypes.contains(type) ? m_resourceTypes[type]() : nullptr;
     }
+
+    inline std::string IResource::getTypeName(const IResource& resource)
+    {
+        const auto it = m_typeNames.find(typeid(resource).hash_code());
+        return it != m_typeNames.end() ? it->second : std::string();
+    }
 }
@@ -27,6 +27,15 @@ namespace LibGL::Resources
         template <typename T>
         T* load(const std::string& fileName, bool initOnLoad = true);
 
+        /**
+         * \brief Tries to create the resource of the given registered type with the given file name.
+         * \param type The resource's registered type name
+         * \param fileName The name of the resource's file
+         * \param initOnLoad Whether or not the resource should be initialized on load
+         * \return A pointer to the resource on success, nullptr otherwise.
+         */
+        IResource* load(const std::string& type, const std::string& fileName, bool initOnLoad = true);
+
         /**
          * \brief Tries to load the resource with the given file name using multithreading.
          * IMPORTANT: The loaded resource is NOT initialized
@@ -36,6 +45,15 @@ namespace LibGL::Resources
         template <typename T, typename ReturnT = T>
         std::future<ReturnT*> loadInBackground(const std::string& fileName);
 
+        /**
+         * \brief Tries to load the resource of the given registered type with the given file name using multithreading.
+         * IMPORTANT: The loaded resource is NOT initialized
+         * \param type The resource's registered type name
+         * \param fileName The name of the resource's file
+         * \return A future returning a pointer to the resource on success or nullptr otherwise.
+         */
+        std::future<IResource*> loadInBackground(const std::string& type, const std::string& fileName);
+
         /**
          * \brief Tries to find the resource with the given file name.
          * \param fileName The name of the resource's file
@@ -59,12 +77,29 @@ namespace LibGL::Resources
          */
         void remove(const std::string& fileName);
 
+        /**
+         * \brief Finds the file name of the given resource
+         * \param resource The resource to find
+         * \return The name of the resource's file on success, an empty string otherwise.
+         */
+        std::string getPath(const IResource& resource) const;
+
     private:
         using ResourcePtr = IResource*;
         using ResourceMap = std::unordered_map<std::string, ResourcePtr>;
 
         mutable std::mutex m_resourcesMutex;
         ResourceMap        m_resources;
+
+        /**
+         * \brief Tries to load the given newly created resource and stores it under the given file name.
+         * The resource previously stored under this file name is destroyed.
+         * \param resource The resource to load. Destroyed on failure
+         * \param fileName The name of the resource's file
+         * \param initOnLoad Whether or not the resource should be initialized on load
+         * \return A pointer to the resource on success, nullptr otherwise.
+         */
+        IResource* loadResource(IResource* resource, const std::string& fileName, bool initOnLoad);
     };
 }
 
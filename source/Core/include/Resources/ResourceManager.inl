@@ -11,30 +11,7 @@ namespace LibGL::Resources
     {
         static_assert(std::is_same_v<IResource, T> || std::is_base_of_v<IResource, T>);
 
-        {
-            std::lock_guard lock(m_resourcesMutex);
-
-            if (m_resources.contains(fileName))
-            {
-                delete m_resources[fileName];
-                m_resources[fileName] = nullptr;
-            }
-        }
-
-        T* ptr = new T();
-
-        if (!ptr->load(fileName) || (initOnLoad && !ptr->init()))
-        {
-            delete ptr;
-            return nullptr;
-        }
-
-        {
-            std::lock_guard lock(m_resourcesMutex);
-            m_resources[fileName] = ptr;
-        }
-
-        return ptr;
+        return static_cast<T*>(loadResource(new T(), fileName, initOnLoad));
     }
 
     template <typename T, typename ReturnT>
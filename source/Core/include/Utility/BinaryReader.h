@@ -0,0 +1,80 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace LibGL::Utility
+{
+    /**
+     * \brief Reads values from a byte buffer without copying it.
+     * Reading past the end of the buffer invalidates the reader and returns default values.
+     */
+    class BinaryReader
+    {
+    public:
+        BinaryReader(const uint8_t* data, size_t size);
+        BinaryReader(const BinaryReader& other) = default;
+        BinaryReader(BinaryReader&& other) noexcept = default;
+        virtual ~BinaryReader() = default;
+
+        BinaryReader& operator=(const BinaryReader& other) = default;
+        BinaryReader& operator=(BinaryReader&& other) noexcept = default;
+
+        /**
+         * \brief Reads a trivially copyable value
+         * \return The read value
+         */
+        template <typename T>
+        T read();
+
+        /**
+         * \brief Reads a string written by BinaryWriter::writeString
+         * \return A view of the string's characters in the buffer
+         */
+        std::string_view readString();
+
+        /**
+         * \brief Gets a pointer to the next bytes and moves the read position after them
+         * \param size The number of bytes to read
+         * \return A pointer to the first read byte. nullptr if the buffer is too small
+         */
+        const uint8_t* readBytes(size_t size);
+
+        /**
+         * \brief Moves the read position by the given number of bytes
+         * \param size The number of bytes to skip
+         */
+        void skip(size_t size);
+
+        /**
+         * \brief Gets the current read position
+         * \return The read position in bytes from the start of the buffer
+         */
+        size_t getOffset() const;
+
+        /**
+         * \brief Gets the number of bytes left to read
+         * \return The number of remaining bytes
+         */
+        size_t getRemaining() const;
+
+        /**
+         * \brief Checks whether every read so far was within the buffer's bounds and valid
+         * \return True if the reader is valid. False otherwise.
+         */
+        bool isValid() const;
+
+        /**
+         * \brief Invalidates the reader, e.g. when the read data is corrupted
+         */
+        void invalidate();
+
+    private:
+        const uint8_t* m_data;
+        size_t         m_size;
+        size_t         m_offset = 0;
+        bool           m_isValid = true;
+    };
+}
+
+#include "Utility/BinaryReader.inl"
@@ -0,0 +1,21 @@
+#pragma once
+#include "Utility/BinaryReader.h"
+
+#include <cstring>
+#include <type_traits>
+
+namespace LibGL::Utility
+{
+    template <typename T>
+    T BinaryReader::read()
+    {
+        static_assert(std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>);
+
+        T value{};
+
+        if (const uint8_t* bytes = readBytes(sizeof(T)))
+            std::memcpy(&value, bytes, sizeof(T));
+
+        return value;
+    }
+}
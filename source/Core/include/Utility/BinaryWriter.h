@@ -0,0 +1,75 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace LibGL::Utility
+{
+    /**
+     * \brief Serializes values into a contiguous byte buffer
+     */
+    class BinaryWriter
+    {
+    public:
+        BinaryWriter() = default;
+        BinaryWriter(const BinaryWriter& other) = default;
+        BinaryWriter(BinaryWriter&& other) noexcept = default;
+        virtual ~BinaryWriter() = default;
+
+        BinaryWriter& operator=(const BinaryWriter& other) = default;
+        BinaryWriter& operator=(BinaryWriter&& other) noexcept = default;
+
+        /**
+         * \brief Appends the bytes of the given trivially copyable value to the buffer
+         * \param value The value to write
+         */
+        template <typename T>
+        void write(const T& value);
+
+        /**
+         * \brief Appends the given string's length followed by its characters to the buffer
+         * \param str The string to write
+         */
+        void writeString(std::string_view str);
+
+        /**
+         * \brief Appends the given bytes to the buffer
+         * \param data A pointer to the first byte to write
+         * \param size The number of bytes to write
+         */
+        void writeBytes(const void* data, size_t size);
+
+        /**
+         * \brief Overwrites the bytes at the given offset with the given trivially copyable value
+         * \param offset The offset of the value to overwrite
+         * \param value The value to write
+         */
+        template <typename T>
+        void writeAt(size_t offset, const T& value);
+
+        /**
+         * \brief Gets the current size of the buffer
+         * \return The buffer's size in bytes
+         */
+        size_t getSize() const;
+
+        /**
+         * \brief Gets the written bytes
+         * \return A reference to the writer's buffer
+         */
+        const std::vector<uint8_t>& getData() const;
+
+        /**
+         * \brief Writes the buffer to the given file
+         * \param fileName The output file's path
+         * \return True if the file was successfully written. False otherwise.
+         */
+        bool saveToFile(const std::string& fileName) const;
+
+    private:
+        std::vector<uint8_t> m_buffer;
+    };
+}
+
+#include "Utility/BinaryWriter.inl"
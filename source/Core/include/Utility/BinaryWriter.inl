@@ -0,0 +1,22 @@
+#pragma once
+#include "Utility/BinaryWriter.h"
+
+#include <cstring>
+#include <type_traits>
+
+namespace LibGL::Utility
+{
+    template <typename T>
+    void BinaryWriter::write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        writeBytes(&value, sizeof(T));
+    }
+
+    template <typename T>
+    void BinaryWriter::writeAt(const size_t offset, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        std::memcpy(m_buffer.data() + offset, &value, sizeof(T));
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace LibGL::Utility
+{
+    /**
+     * \brief Read-only view of a file mapped in memory
+     */
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        explicit MappedFile(const std::string& fileName);
+        MappedFile(const MappedFile& other) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        ~MappedFile();
+
+        MappedFile& operator=(const MappedFile& other) = delete;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        /**
+         * \brief Checks whether the file is mapped or not
+         * \return True if the file was successfully mapped. False otherwise.
+         */
+        bool isValid() const;
+
+        /**
+         * \brief Gets the mapped file's content
+         * \return A pointer to the first byte of the file
+         */
+        const uint8_t* getData() const;
+
+        /**
+         * \brief Gets the mapped file's size
+         * \return The file's size in bytes
+         */
+        size_t getSize() const;
+
+        /**
+         * \brief Unmaps the file
+         */
+        void close();
+
+    private:
+        const uint8_t* m_data = nullptr;
+        size_t         m_size = 0;
+
+#ifdef _WIN32
+        void* m_file = nullptr;
+        void* m_mapping = nullptr;
+#else
+        int m_file = -1;
+#endif
+    };
+}
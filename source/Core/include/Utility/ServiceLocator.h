@@ -4,6 +4,7 @@
 #include <unordered_map>
 
 #define LGL_SERVICE(Type) LibGL::ServiceLocator::get<Type>()
+#define LGL_TRY_SERVICE(Type) LibGL::ServiceLocator::tryGet<Type>()
 
 namespace LibGL
 {
@@ -23,6 +24,13 @@ namespace LibGL
             return *static_cast<T*>(s_services[typeid(T).hash_code()]);
         }
 
+        template <typename T>
+        static T* tryGet()
+        {
+            const auto it = s_services.find(typeid(T).hash_code());
+            return it != s_services.end() ? static_cast<T*>(it->second) : nullptr;
+        }
+
     private:
         inline static std::unordered_map<size_t, void*> s_services;
     };
@@ -1,4 +1,6 @@
 ﻿#pragma once
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <future>
 #include <mutex>
@@ -28,6 +30,9 @@ namespace LibGL::Utility
         template <typename Func, typename... Args>
         std::future<std::invoke_result_t<Func, Args...>> enqueue(Func&& func, Args&&... args);
 
+        template <typename Func>
+        void parallelFor(size_t count, Func&& func);
+
         bool isBusy() const;
         void stop();
 
@@ -20,4 +20,59 @@ namespace LibGL::Utility
         m_mutexCondition.notify_one();
         return package->get_future();
     }
+
+    template <typename Func>
+    void ThreadPool::parallelFor(const size_t count, Func&& func)
+    {
+        if (count == 0)
+            return;
+
+        if (count == 1 || m_workersCount == 0)
+        {
+            for (size_t i = 0; i < count; ++i)
+                func(i);
+
+            return;
+        }
+
+        struct SharedState
+        {
+            std::atomic<size_t> m_next = 0;
+            std::atomic<size_t> m_done = 0;
+            size_t              m_count = 0;
+        };
+
+        auto state = std::make_shared<SharedState>();
+        state->m_count = count;
+
+        // The calling thread takes part in the work and only waits for the iterations to be done.
+        // Late workers find no work left and never touch func, which makes it safe to call from a worker.
+        auto* funcPtr = &func;
+        const auto work = [state, funcPtr]
+        {
+            for (size_t i = state->m_next++; i < state->m_count; i = state->m_next++)
+            {
+                (*funcPtr)(i);
+
+                if (++state->m_done == state->m_count)
+                    state->m_done.notify_all();
+            }
+        };
+
+        const size_t helpersCount = std::min(static_cast<size_t>(m_workersCount), count - 1);
+
+        {
+            std::lock_guard lock(m_tasksMutex);
+
+            for (size_t i = 0; i < helpersCount; ++i)
+                m_tasks.emplace(work);
+        }
+
+        m_mutexCondition.notify_all();
+
+        work();
+
+        for (size_t done = state->m_done; done < count; done = state->m_done)
+            state->m_done.wait(done);
+    }
 }
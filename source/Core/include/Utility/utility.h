@@ -1,6 +1,8 @@
 #pragma once
+#include <cstdint>
 #include <vector>
 #include <string>
+#include <string_view>
 
 namespace LibGL::Utility
 {
@@ -53,6 +55,13 @@ namespace LibGL::Utility
      * \return A vector containing the file's lines
      */
     std::vector<std::string> readFile(const std::string& fileName);
+
+    /**
+     * \brief Computes the 64 bits FNV-1a hash of the given string
+     * \param str The string to hash
+     * \return The string's hash
+     */
+    constexpr uint64_t hashString(std::string_view str);
 }
 
 #include "Utility/utility.inl"
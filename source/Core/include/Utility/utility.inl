@@ -55,4 +55,17 @@ namespace LibGL::Utility
         trimStringEnd(str, compareFunc);
         trimStringStart(str, compareFunc);
     }
+
+    constexpr uint64_t hashString(const std::string_view str)
+    {
+        uint64_t hash = 14695981039346656037ull;
+
+        for (const char c : str)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 1099511628211ull;
+        }
+
+        return hash;
+    }
 }
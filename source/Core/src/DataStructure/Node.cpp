@@ -6,6 +6,10 @@ namespace LibGL::DataStructure
     {
     }
 
+    Node::Node(const Node&)
+    {
+    }
+
     Node::~Node()
     {
         if (m_parent != nullptr)
@@ -14,6 +18,11 @@ namespace LibGL::DataStructure
         clearChildren();
     }
 
+    Node& Node::operator=(const Node&)
+    {
+        return *this;
+    }
+
     Node* Node::getParent()
     {
         return m_parent;
@@ -42,7 +51,7 @@ namespace LibGL::DataStructure
 
     void Node::removeChild(Node& child)
     {
-        const auto findFunc = [child](const NodePtr& ptr)
+        const auto findFunc = [&child](const NodePtr& ptr)
         {
             return ptr.get() == &child;
         };
@@ -57,6 +66,35 @@ namespace LibGL::DataStructure
         }
     }
 
+    void Node::attachChild(const NodePtr& child)
+    {
+        child->m_parent = this;
+
+        m_children.push_back(child);
+        onChildAdded(*child);
+    }
+
+    Node::NodePtr Node::detachChild(Node& child)
+    {
+        const auto findFunc = [&child](const NodePtr& ptr)
+        {
+            return ptr.get() == &child;
+        };
+
+        auto childIter = std::find_if(m_children.begin(), m_children.end(), findFunc);
+
+        if (childIter == m_children.end())
+            return nullptr;
+
+        NodePtr detachedChild = *childIter;
+
+        onRemoveChild(*detachedChild);
+        detachedChild->m_parent = nullptr;
+        m_children.erase(childIter);
+
+        return detachedChild;
+    }
+
     void Node::clearChildren()
     {
         for (NodePtr& child : m_children)
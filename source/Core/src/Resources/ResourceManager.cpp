@@ -1,5 +1,9 @@
 #include "Resources/ResourceManager.h"
 
+#include "Resources/IResource.h"
+#include "Utility/ServiceLocator.h"
+#include "Utility/ThreadPool.h"
+
 #include <ranges>
 
 namespace LibGL::Resources
@@ -27,12 +31,70 @@ namespace LibGL::Resources
         return *this;
     }
 
+    IResource* ResourceManager::load(const std::string& type, const std::string& fileName, const bool initOnLoad)
+    {
+        return loadResource(IResource::create(type), fileName, initOnLoad);
+    }
+
+    std::future<IResource*> ResourceManager::loadInBackground(const std::string& type, const std::string& fileName)
+    {
+        Utility::ThreadPool& threadPool = LGL_SERVICE(Utility::ThreadPool);
+        return threadPool.enqueue([this, type, fileName]
+        {
+            return load(type, fileName, false);
+        });
+    }
+
     void ResourceManager::remove(const std::string& fileName)
     {
+        std::lock_guard lock(m_resourcesMutex);
+
         if (m_resources.contains(fileName))
         {
             delete m_resources[fileName];
             m_resources.erase(fileName);
         }
     }
+
+    IResource* ResourceManager::loadResource(IResource* resource, const std::string& fileName, const bool initOnLoad)
+    {
+        {
+            std::lock_guard lock(m_resourcesMutex);
+
+            if (m_resources.contains(fileName))
+            {
+                delete m_resources[fileName];
+                m_resources[fileName] = nullptr;
+            }
+        }
+
+        if (resource == nullptr)
+            return nullptr;
+
+        if (!resource->load(fileName) || (initOnLoad && !resource->init()))
+        {
+            delete resource;
+            return nullptr;
+        }
+
+        {
+            std::lock_guard lock(m_resourcesMutex);
+            m_resources[fileName] = resource;
+        }
+
+        return resource;
+    }
+
+    std::string ResourceManager::getPath(const IResource& resource) const
+    {
+        std::lock_guard lock(m_resourcesMutex);
+
+        for (const auto& [fileName, ptr] : m_resources)
+        {
+            if (ptr == &resource)
+                return fileName;
+        }
+
+        return {};
+    }
 }
@@ -0,0 +1,59 @@
+#include "Utility/BinaryReader.h"
+
+namespace LibGL::Utility
+{
+    BinaryReader::BinaryReader(const uint8_t* data, const size_t size)
+        : m_data(data), m_size(data != nullptr ? size : 0)
+    {
+    }
+
+    std::string_view BinaryReader::readString()
+    {
+        const uint32_t length = read<uint32_t>();
+        const uint8_t* chars = readBytes(length);
+
+        if (chars == nullptr)
+            return {};
+
+        return { reinterpret_cast<const char*>(chars), length };
+    }
+
+    const uint8_t* BinaryReader::readBytes(const size_t size)
+    {
+        if (!m_isValid || size > m_size - m_offset)
+        {
+            m_isValid = false;
+            return nullptr;
+        }
+
+        const uint8_t* bytes = m_data + m_offset;
+        m_offset += size;
+
+        return bytes;
+    }
+
+    void BinaryReader::skip(const size_t size)
+    {
+        readBytes(size);
+    }
+
+    size_t BinaryReader::getOffset() const
+    {
+        return m_offset;
+    }
+
+    size_t BinaryReader::getRemaining() const
+    {
+        return m_size - m_offset;
+    }
+
+    bool BinaryReader::isValid() const
+    {
+        return m_isValid;
+    }
+
+    void BinaryReader::invalidate()
+    {
+        m_isValid = false;
+    }
+}
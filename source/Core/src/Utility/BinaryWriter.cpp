@@ -0,0 +1,40 @@
+#include "Utility/BinaryWriter.h"
+
+#include <fstream>
+
+namespace LibGL::Utility
+{
+    void BinaryWriter::writeString(const std::string_view str)
+    {
+        write(static_cast<uint32_t>(str.size()));
+        writeBytes(str.data(), str.size());
+    }
+
+    void BinaryWriter::writeBytes(const void* data, const size_t size)
+    {
+        const auto bytes = static_cast<const uint8_t*>(data);
+        m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+    }
+
+    size_t BinaryWriter::getSize() const
+    {
+        return m_buffer.size();
+    }
+
+    const std::vector<uint8_t>& BinaryWriter::getData() const
+    {
+        return m_buffer;
+    }
+
+    bool BinaryWriter::saveToFile(const std::string& fileName) const
+    {
+        std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+
+        if (!file.is_open())
+            return false;
+
+        file.write(reinterpret_cast<const char*>(m_buffer.data()), static_cast<std::streamsize>(m_buffer.size()));
+
+        return file.good();
+    }
+}
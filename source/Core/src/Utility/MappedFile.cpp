@@ -0,0 +1,152 @@
+#include "Utility/MappedFile.h"
+
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace LibGL::Utility
+{
+    MappedFile::MappedFile(const std::string& fileName)
+    {
+#ifdef _WIN32
+        m_file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                             FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+        if (m_file == INVALID_HANDLE_VALUE)
+        {
+            m_file = nullptr;
+            return;
+        }
+
+        LARGE_INTEGER fileSize;
+
+        if (!GetFileSizeEx(m_file, &fileSize) || fileSize.QuadPart == 0)
+        {
+            close();
+            return;
+        }
+
+        m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if (m_mapping == nullptr)
+        {
+            close();
+            return;
+        }
+
+        m_data = static_cast<const uint8_t*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+        m_size = m_data != nullptr ? static_cast<size_t>(fileSize.QuadPart) : 0;
+#else
+        m_file = open(fileName.c_str(), O_RDONLY);
+
+        if (m_file < 0)
+            return;
+
+        struct stat fileStat{};
+
+        if (fstat(m_file, &fileStat) != 0 || fileStat.st_size == 0)
+        {
+            close();
+            return;
+        }
+
+        void* data = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, m_file, 0);
+
+        if (data == MAP_FAILED)
+        {
+            close();
+            return;
+        }
+
+        m_data = static_cast<const uint8_t*>(data);
+        m_size = static_cast<size_t>(fileStat.st_size);
+#endif
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0)),
+#ifdef _WIN32
+        m_file(std::exchange(other.m_file, nullptr)), m_mapping(std::exchange(other.m_mapping, nullptr))
+#else
+        m_file(std::exchange(other.m_file, -1))
+#endif
+    {
+    }
+
+    MappedFile::~MappedFile()
+    {
+        close();
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (&other == this)
+            return *this;
+
+        close();
+
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+
+#ifdef _WIN32
+        m_file = std::exchange(other.m_file, nullptr);
+        m_mapping = std::exchange(other.m_mapping, nullptr);
+#else
+        m_file = std::exchange(other.m_file, -1);
+#endif
+
+        return *this;
+    }
+
+    bool MappedFile::isValid() const
+    {
+        return m_data != nullptr;
+    }
+
+    const uint8_t* MappedFile::getData() const
+    {
+        return m_data;
+    }
+
+    size_t MappedFile::getSize() const
+    {
+        return m_size;
+    }
+
+    void MappedFile::close()
+    {
+#ifdef _WIN32
+        if (m_data != nullptr)
+            UnmapViewOfFile(m_data);
+
+        if (m_mapping != nullptr)
+            CloseHandle(m_mapping);
+
+        if (m_file != nullptr)
+            CloseHandle(m_file);
+
+        m_mapping = nullptr;
+        m_file = nullptr;
+#else
+        if (m_data != nullptr)
+            munmap(const_cast<uint8_t*>(m_data), m_size);
+
+        if (m_file >= 0)
+            ::close(m_file);
+
+        m_file = -1;
+#endif
+
+        m_data = nullptr;
+        m_size = 0;
+    }
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include <IContext.h>
 #include <InputManager.h>
+#include <PhysicsWorld.h>
 
 #include <Core/Renderer.h>
 #include <Core/SceneRenderer.h>
@@ -23,6 +24,7 @@ namespace LibGL::Demo
         std::unique_ptr<Resources::ResourceManager> m_resourceManager;
         std::unique_ptr<Rendering::Renderer>        m_renderer;
         std::unique_ptr<Rendering::SceneRenderer>   m_sceneRenderer;
+        std::unique_ptr<Physics::PhysicsWorld>      m_physicsWorld;
         std::unique_ptr<Rendering::Camera>          m_camera;
     };
 }
@@ -7,6 +7,8 @@
 #include <BoxCollider.h>
 #include <CapsuleCollider.h>
 #include <InputManager.h>
+#include <MeshCollider.h>
+#include <PhysicsWorld.h>
 #include <Raycast.h>
 #include <Rigidbody.h>
 #include <SphereCollider.h>
@@ -111,6 +113,9 @@ namespace LibGL::Demo
         // Update scene
         m_scene.update();
 
+        // Step the physics at a fixed rate
+        LGL_SERVICE(PhysicsWorld).update(LGL_SERVICE(Timer).getDeltaTime());
+
         // Handle rendering
         render();
 
@@ -263,7 +268,8 @@ namespace LibGL::Demo
         // Place the models
         Model& floorModel = m_scene.addNode<Model>(nullptr, *floorMesh, floorMat);
         floorModel.setScale(Vector3(14.f, 1.f, 14.f));
-        floorModel.addComponent<BoxCollider>(Vector3(0.f, -.05f, 0.f), Vector3(1.f, .1f, 1.f));
+        floorModel.addComponent<MeshCollider>(std::make_shared<const TriangleMesh>(
+            TriangleMesh::fromVertices<Vertex>(floorMesh->getVertices(), floorMesh->getIndices())));
 
         Model& bunnyModel = m_scene.addNode<Model>(nullptr, *bunnyMesh, bunnyMat);
         bunnyModel.setPosition(Vector3(0.f, 1.f, -3.f));
@@ -432,8 +438,8 @@ namespace LibGL::Demo
                 if (!floatEquals(moveSpeed, 0.f) && direction != Vector3::zero())
                     targetVelocity = direction * (moveSpeed / direction.magnitude());
 
-                targetVelocity.m_y += rb->m_velocity.m_y;
-                rb->m_velocity = targetVelocity;
+                targetVelocity.m_y += rb->getVelocity().m_y;
+                rb->setVelocity(targetVelocity);
             }
         }
         else
@@ -5,6 +5,7 @@
 #include <Utility/ServiceLocator.h>
 
 using namespace LibGL::Application;
+using namespace LibGL::Physics;
 using namespace LibGL::Rendering;
 using namespace LibGL::Resources;
 using namespace LibGL::Utility;
@@ -24,6 +25,7 @@ namespace LibGL::Demo
         m_resourceManager(std::make_unique<ResourceManager>()),
         m_renderer(std::make_unique<Renderer>()),
         m_sceneRenderer(std::make_unique<SceneRenderer>()),
+        m_physicsWorld(std::make_unique<PhysicsWorld>()),
         m_camera(std::make_unique<Camera>(nullptr, Transform(),
             perspectiveProjection(90_deg, static_cast<float>(windowWidth) / static_cast<float>(windowHeight), CAM_NEAR,
                 CAM_FAR)))
@@ -45,6 +47,7 @@ namespace LibGL::Demo
         ServiceLocator::provide<ResourceManager>(*m_resourceManager);
         ServiceLocator::provide<Renderer>(*m_renderer);
         ServiceLocator::provide<SceneRenderer>(*m_sceneRenderer);
+        ServiceLocator::provide<PhysicsWorld>(*m_physicsWorld);
 
         // Enable back-face culling
         m_renderer->setCapability(ERenderingCapability::CULL_FACE, true);
@@ -0,0 +1,122 @@
+#pragma once
+#include <cstddef>
+#include <memory> // unique_ptr
+#include <vector>
+
+namespace LibGL
+{
+    class Component;
+    class Entity;
+
+    class Archetype
+    {
+    public:
+        using TypeId = size_t;
+
+        /**
+         * \brief The entity's type followed by the sorted types of its components
+         */
+        using Signature = std::vector<TypeId>;
+
+        class Chunk
+        {
+        public:
+            Chunk(size_t capacity, size_t columnCount);
+
+            /**
+             * \brief Gets the number of rows currently stored in the chunk
+             * \return The chunk's row count
+             */
+            size_t getSize() const;
+
+            /**
+             * \brief Gets the chunk's entities array
+             * \return A pointer to the first entity of the chunk
+             */
+            Entity* const* getEntities() const;
+
+            /**
+             * \brief Gets the given component column of the chunk
+             * \param column The index of the column to get
+             * \return A pointer to the first component of the column
+             */
+            Component* const* getColumn(size_t column) const;
+
+        private:
+            friend class Archetype;
+
+            std::unique_ptr<Entity*[]>    m_entities;
+            std::unique_ptr<Component*[]> m_components;
+            size_t                        m_capacity;
+            size_t                        m_size = 0;
+        };
+
+        /**
+         * \brief The target size in bytes of a chunk
+         */
+        static constexpr size_t CHUNK_SIZE = 16 * 1024;
+
+        explicit Archetype(Signature signature);
+
+        /**
+         * \brief Gets the archetype's signature
+         * \return The archetype's signature
+         */
+        const Signature& getSignature() const;
+
+        /**
+         * \brief Gets the number of component columns of the archetype
+         * \return The archetype's column count
+         */
+        size_t getColumnCount() const;
+
+        /**
+         * \brief Gets the number of entities stored in the archetype
+         * \return The archetype's entity count
+         */
+        size_t getEntityCount() const;
+
+        /**
+         * \brief Gets the number of chunks used by the archetype
+         * \return The archetype's chunk count
+         */
+        size_t getChunkCount() const;
+
+        /**
+         * \brief Gets the chunk at the given index
+         * \param index The index of the chunk to get
+         * \return A reference to the chunk at the given index
+         */
+        const Chunk& getChunk(size_t index) const;
+
+    private:
+        friend class ArchetypeStorage;
+
+        Signature          m_signature;
+        std::vector<Chunk> m_chunks;
+        size_t             m_chunkCapacity;
+        size_t             m_entityCount = 0;
+
+        /**
+         * \brief Appends a row for the given entity and components
+         * \param entity The added entity
+         * \param components The entity's components, sorted by type
+         * \return The index of the added row
+         */
+        size_t add(Entity& entity, const std::vector<Component*>& components);
+
+        /**
+         * \brief Overwrites the components of the given row
+         * \param row The index of the row to update
+         * \param components The entity's components, sorted by type
+         */
+        void set(size_t row, const std::vector<Component*>& components);
+
+        /**
+         * \brief Removes the given row by moving the last row in its place
+         * \param row The index of the row to remove
+         * \return A pointer to the entity moved in the removed row. nullptr if no entity was moved
+         */
+        Entity* remove(size_t row);
+    };
+}
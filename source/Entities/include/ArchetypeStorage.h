@@ -0,0 +1,94 @@
+#pragma once
+#include "Archetype.h"
+
+#include <map>
+#include <unordered_map>
+
+namespace LibGL
+{
+    template <typename... Ts>
+    class Query;
+
+    /**
+     * \brief Optional storage grouping the entities by type and components combination.
+     * Entities are only tracked while an ArchetypeStorage is provided to the ServiceLocator
+     * and once they are attached to a scene.
+     */
+    class ArchetypeStorage
+    {
+    public:
+        ArchetypeStorage() = default;
+        ArchetypeStorage(const ArchetypeStorage& other) = delete;
+        ArchetypeStorage(ArchetypeStorage&& other) noexcept = default;
+        ~ArchetypeStorage() = default;
+
+        ArchetypeStorage& operator=(const ArchetypeStorage& other) = delete;
+        ArchetypeStorage& operator=(ArchetypeStorage&& other) noexcept = default;
+
+        /**
+         * \brief Moves the given entity to the archetype matching its current components
+         * \param entity The entity to update
+         */
+        void update(Entity& entity);
+
+        /**
+         * \brief Moves the given entity and its children to the archetypes matching their current components
+         * \param root The root of the hierarchy to update
+         */
+        void updateHierarchy(Entity& root);
+
+        /**
+         * \brief Removes the given entity from the storage
+         * \param entity The entity to remove
+         */
+        void remove(const Entity& entity);
+
+        /**
+         * \brief Checks whether the given entity is stored or not
+         * \param entity The entity to check
+         * \return True if the entity is stored. False otherwise.
+         */
+        bool contains(const Entity& entity) const;
+
+        /**
+         * \brief Gets the number of archetypes created so far
+         * \return The storage's archetype count
+         */
+        size_t getArchetypeCount() const;
+
+        /**
+         * \brief Gets the archetype at the given index
+         * \param index The index of the archetype to get
+         * \return A reference to the archetype at the given index
+         */
+        const Archetype& getArchetype(size_t index) const;
+
+        /**
+         * \brief Creates a query iterating over the entities matching the given types
+         * \tparam Ts The required entity and/or component types
+         * \return The created query
+         */
+        template <typename... Ts>
+        Query<Ts...> query();
+
+    private:
+        struct Location
+        {
+            size_t m_archetype;
+            size_t m_row;
+        };
+
+        std::vector<std::unique_ptr<Archetype>>     m_archetypes;
+        std::map<Archetype::Signature, size_t>      m_archetypeIndices;
+        std::unordered_map<const Entity*, Location> m_locations;
+
+        /**
+         * \brief Finds the archetype with the given signature or creates it if it doesn't exist
+         * \param signature The archetype's signature
+         * \return The index of the archetype
+         */
+        size_t getOrCreateArchetype(Archetype::Signature signature);
+    };
+}
+
+#include "ArchetypeStorage.inl"
@@ -0,0 +1,12 @@
+#pragma once
+#include "ArchetypeStorage.h"
+#include "Query.h"
+
+namespace LibGL
+{
+    template <typename... Ts>
+    Query<Ts...> ArchetypeStorage::query()
+    {
+        return Query<Ts...>(*this);
+    }
+}
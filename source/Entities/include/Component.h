@@ -1,5 +1,13 @@
 #pragma once
 #include <cstdint>
+#include <memory> // shared_ptr
+
+namespace LibGL::Resources
+{
+    class SceneReader;
+    class SceneSerializer;
+    class SceneWriter;
+}
 
 namespace LibGL
 {
@@ -57,9 +65,14 @@ namespace LibGL
 
     private:
         friend class Entity;
+        friend class Resources::SceneSerializer;
+
+        using CloneFunc = std::shared_ptr<Component> (*)(const Component&, Entity&);
+
         inline static ComponentId s_currentId = 1;
 
         Entity*     m_owner;
+        CloneFunc   m_cloneFunc = nullptr;
         ComponentId m_id;
         bool        m_isActive = true;
 
@@ -76,5 +89,12 @@ namespace LibGL
         virtual void onDisable()
         {
         }
+
+        /**
+         * \brief The action to perform when the owner's transform or one of its ancestors' changes
+         */
+        virtual void onTransformChange()
+        {
+        }
     };
 }
@@ -0,0 +1,39 @@
+#pragma once
+#include "ISystem.h"
+
+#include <utility>
+
+namespace LibGL
+{
+    /**
+     * \brief Updates every active component of the given type as a single batch.
+     * Only components whose exact type is T are updated, which allows their update to be called without virtual dispatch.
+     * Since a component's update can write its owner, component systems are declared as writing the Entity type
+     * and never run concurrently with each other.
+     * \tparam T The updated component type
+     */
+    template <typename T>
+    class ComponentSystem : public ISystem
+    {
+    public:
+        ComponentSystem();
+
+        /**
+         * \brief Updates every active component of the system's type
+         * \param storage The storage containing the scene's entities
+         */
+        void update(ArchetypeStorage& storage) override;
+
+    private:
+        std::vector<std::pair<size_t, size_t>> m_columns;
+        size_t                                 m_checkedArchetypes = 0;
+
+        /**
+         * \brief Finds the component columns of the archetypes created since the last update
+         * \param storage The storage containing the scene's entities
+         */
+        void refresh(const ArchetypeStorage& storage);
+    };
+}
+
+#include "ComponentSystem.inl"
@@ -0,0 +1,65 @@
+#pragma once
+#include "ArchetypeStorage.h"
+#include "Component.h"
+#include "ComponentSystem.h"
+#include "Entity.h"
+
+#include <type_traits>
+
+namespace LibGL
+{
+    template <typename T>
+    ComponentSystem<T>::ComponentSystem()
+    {
+        static_assert(std::is_base_of_v<Component, T> && !std::is_abstract_v<T>);
+
+        // Component updates can move their owner or touch state shared with other components
+        addWrite<T>();
+        addWrite<Entity>();
+        addBatched<T>();
+    }
+
+    template <typename T>
+    void ComponentSystem<T>::update(ArchetypeStorage& storage)
+    {
+        refresh(storage);
+
+        for (const auto& [archetypeIndex, column] : m_columns)
+        {
+            const Archetype& archetype = storage.getArchetype(archetypeIndex);
+
+            for (size_t i = 0; i < archetype.getChunkCount(); ++i)
+            {
+                const Archetype::Chunk& chunk = archetype.getChunk(i);
+                Component* const* components = chunk.getColumn(column);
+
+                for (size_t row = 0; row < chunk.getSize(); ++row)
+                {
+                    // The column's type is exactly T so the update can be resolved statically
+                    T& component = static_cast<T&>(*components[row]);
+
+                    if (component.isActive())
+                        component.T::update();
+                }
+            }
+        }
+    }
+
+    template <typename T>
+    void ComponentSystem<T>::refresh(const ArchetypeStorage& storage)
+    {
+        const TypeId typeId = typeid(T).hash_code();
+
+        for (; m_checkedArchetypes < storage.getArchetypeCount(); ++m_checkedArchetypes)
+        {
+            const Archetype::Signature& signature = storage.getArchetype(m_checkedArchetypes).getSignature();
+
+            // The first element of the signature is the entity's type
+            for (size_t i = 1; i < signature.size(); ++i)
+            {
+                if (signature[i] == typeId)
+                    m_columns.emplace_back(m_checkedArchetypes, i - 1);
+            }
+        }
+    }
+}
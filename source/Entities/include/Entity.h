@@ -6,16 +6,33 @@
 #include <memory> // shared_ptr
 #include <vector>
 
+namespace LibGL::Resources
+{
+    class Scene;
+    class SceneReader;
+    class SceneSerializer;
+    class SceneWriter;
+}
+
 namespace LibGL
 {
+    class SystemScheduler;
+
     class Entity : public DataStructure::Node, public LibMath::Transform
     {
         using ComponentPtr = std::shared_ptr<Component>;
         using ComponentList = std::vector<ComponentPtr>;
 
     public:
+        using Handle = std::shared_ptr<Entity* const>;
+
         Entity() = default;
         Entity(Entity* parent, const Transform& transform);
+
+        /**
+         * \brief Creates a detached deep copy of the given entity, its components and its children
+         * \param other The entity to copy
+         */
         Entity(const Entity& other);
         Entity(Entity&& other) noexcept;
         ~Entity() override;
@@ -26,6 +43,11 @@ namespace LibGL
          */
         explicit operator bool() const;
 
+        /**
+         * \brief Replaces the entity's transform, components and active state by copies of the given entity's
+         * \param other The entity to copy
+         * \return A reference to the current entity
+         */
         Entity& operator=(const Entity& other);
         Entity& operator=(Entity&& other) noexcept;
 
@@ -63,10 +85,31 @@ namespace LibGL
         std::vector<std::shared_ptr<const T>> getComponents() const;
 
         /**
-         * \brief Updates the entity (does nothing by default)
+         * \brief Updates the entity's enabled components and its children.
+         * During a scene update, the components batched by the system scheduler are left to their systems
          */
         virtual void update();
 
+        /**
+         * \brief Creates a detached deep copy of the entity, its components and its children.
+         * Derived entity types should override it to copy their own data.
+         * \return A pointer to the created copy
+         */
+        virtual std::shared_ptr<Entity> clone() const;
+
+        /**
+         * \brief Writes the entity's type specific data (nothing for base entities)
+         * \param writer The scene's writer
+         */
+        void serialize(Resources::SceneWriter& writer) const;
+
+        /**
+         * \brief Creates an entity from the data written by serialize
+         * \param reader The scene's reader
+         * \return A pointer to the created entity
+         */
+        static std::shared_ptr<Entity> deserialize(Resources::SceneReader& reader);
+
         /**
          * \brief Checks whether the entity is active or not
          * \return True if the entity is currently active. False otherwise.
@@ -79,6 +122,13 @@ namespace LibGL
          */
         void setActive(bool active);
 
+        /**
+         * \brief Gets a handle to the entity which can outlive it.
+         * The handle follows the entity when it is moved and points to nullptr once it is destroyed.
+         * \return The entity's handle
+         */
+        Handle getHandle() const;
+
     protected:
         /**
          * \brief Adds the given node as a child of the current node
@@ -92,10 +142,78 @@ namespace LibGL
          */
         void onRemoveChild(Node& child) override;
 
+        /**
+         * \brief The action to perform when the entity's transform changes
+         */
+        void onChange() override;
+
     private:
-        ComponentList m_components;
-        bool          m_isActive;
-        bool          m_isDestroyed;
+        friend class ArchetypeStorage;
+        friend class Component;
+        friend class Resources::Scene;
+        friend class Resources::SceneSerializer;
+
+        // The scheduler running the batched component updates after the current scene update. nullptr otherwise
+        inline static const SystemScheduler* s_batchScheduler = nullptr;
+
+        ComponentList           m_components;
+        std::vector<Component*> m_enabledComponents;
+        std::shared_ptr<Entity*> m_handle = std::make_shared<Entity*>(this);
+        bool                    m_isActive = true;
+        bool                    m_isActiveInHierarchy = true;
+        bool                    m_isDestroyed = false;
+        bool                    m_isUpdatingComponents = false;
+        bool                    m_hasStaleEnabledComponents = false;
+
+        /**
+         * \brief Checks whether the entity's parent is active or not
+         * \return True if the entity has no parent or if its parent is active. False otherwise.
+         */
+        bool isParentActive() const;
+
+        /**
+         * \brief Updates the entity's cached active state and propagates it to its children if it changed
+         * \param isParentActive Whether the entity's parent is active or not
+         */
+        void updateActiveInHierarchy(bool isParentActive);
+
+        /**
+         * \brief Rebuilds the list of the entity's enabled components
+         */
+        void updateEnabledComponents();
+
+        /**
+         * \brief Adds or removes the given component from the list of the entity's enabled components.
+         * While the components are updating, the list is only rebuilt once their update is done
+         * \param component The component whose active state changed
+         */
+        void updateEnabledComponent(Component& component);
+
+        /**
+         * \brief Notifies the components of the entity and of its children that their world transform changed
+         */
+        void notifyTransformChange();
+
+        /**
+         * \brief Moves the entity to the archetype matching its components if it's tracked by an archetype storage
+         */
+        void updateArchetype();
+
+        /**
+         * \brief Replaces the entity's components by copies of the given entity's components
+         * \param other The entity whose components should be copied
+         */
+        void copyComponents(const Entity& other);
+
+        /**
+         * \brief Creates a copy of the given component for the given owner
+         * \tparam T The component's type
+         * \param component The component to copy
+         * \param owner The copy's owner
+         * \return A pointer to the copied component. nullptr if the component isn't copyable
+         */
+        template <typename T>
+        static std::shared_ptr<Component> cloneComponent(const Component& component, Entity& owner);
     };
 }
 
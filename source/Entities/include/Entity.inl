@@ -10,6 +10,9 @@ namespace LibGL
         static_assert(std::is_same_v<Component, T> || std::is_base_of_v<Component, T>);
 
         m_components.push_back(std::make_shared<T>(*this, std::forward<Args>(args)...));
+        m_components.back()->m_cloneFunc = &cloneComponent<T>;
+        updateEnabledComponent(*m_components.back());
+        updateArchetype();
 
         return static_cast<T&>(*m_components.back());
     }
@@ -102,4 +105,19 @@ namespace LibGL
 
         return components;
     }
+
+    template <typename T>
+    std::shared_ptr<Component> Entity::cloneComponent(const Component& component, Entity& owner)
+    {
+        if constexpr (std::is_copy_constructible_v<T>)
+        {
+            std::shared_ptr<T> copy = std::make_shared<T>(static_cast<const T&>(component));
+            copy->m_owner = &owner;
+            return copy;
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
 }
@@ -0,0 +1,100 @@
+#pragma once
+#include "Entity.h"
+
+#include <functional>
+#include <memory> // unique_ptr
+#include <mutex>
+#include <vector>
+
+namespace LibGL
+{
+    namespace Resources
+    {
+        class Scene;
+    }
+
+    /**
+     * \brief Records structural changes to apply to the scene at the next sync point.
+     * Each thread records in its own buffer, so entities and components can be created or destroyed
+     * from the updates, including the ones running on the thread pool.
+     * Entities are recorded by handle so commands targeting an entity destroyed before the playback are skipped.
+     */
+    class EntityCommandBuffer
+    {
+        using Command = std::function<void(Resources::Scene&)>;
+
+    public:
+        EntityCommandBuffer() = default;
+        EntityCommandBuffer(const EntityCommandBuffer& other) = delete;
+        EntityCommandBuffer(EntityCommandBuffer&& other) noexcept = default;
+        ~EntityCommandBuffer() = default;
+
+        EntityCommandBuffer& operator=(const EntityCommandBuffer& other) = delete;
+        EntityCommandBuffer& operator=(EntityCommandBuffer&& other) noexcept = default;
+
+        /**
+         * \brief Gets the calling thread's command buffer
+         * \return A reference to the calling thread's command buffer
+         */
+        static EntityCommandBuffer& getLocal();
+
+        /**
+         * \brief Applies and clears the commands recorded by every thread.
+         * The commands recorded during the playback are applied too.
+         * Must be called while no other thread is recording commands.
+         * \param scene The scene to apply the commands to
+         */
+        static void playbackAll(Resources::Scene& scene);
+
+        /**
+         * \brief Records the creation of an entity of the given type
+         * \param parent The created entity's parent. nullptr to add it to the scene's root
+         * \param args The arguments to pass to the created entity's constructor
+         */
+        template <typename T, typename... Args>
+        void spawn(Entity* parent, Args&&... args);
+
+        /**
+         * \brief Records the destruction of the given entity and its children
+         * \param entity The entity to destroy
+         */
+        void destroy(Entity& entity);
+
+        /**
+         * \brief Records the addition of a component of the given type to the given entity
+         * \param entity The entity to add the component to
+         * \param args The arguments to pass to the created component's constructor
+         */
+        template <typename T, typename... Args>
+        void addComponent(Entity& entity, Args&&... args);
+
+        /**
+         * \brief Records the removal of the given component from its owner
+         * \param entity The component's owner
+         * \param id The id of the component to remove
+         */
+        void removeComponent(Entity& entity, Component::ComponentId id);
+
+        /**
+         * \brief Records the move of the given entity under the given parent
+         * \param entity The entity to move
+         * \param parent The entity's new parent. nullptr to move it to the scene's root
+         */
+        void setParent(Entity& entity, Entity* parent);
+
+        /**
+         * \brief Checks whether the buffer contains commands or not
+         * \return True if no command was recorded since the last playback. False otherwise.
+         */
+        bool isEmpty() const;
+
+    private:
+        inline static std::mutex                                        s_buffersMutex;
+        inline static std::vector<std::unique_ptr<EntityCommandBuffer>> s_buffers;
+
+        std::vector<Command>        m_commands;
+        std::vector<Entity::Handle> m_destroyedEntities;
+    };
+}
+
+#include "EntityCommandBuffer.inl"
@@ -0,0 +1,39 @@
+#pragma once
+#include "EntityCommandBuffer.h"
+#include "Scene.h"
+
+#include <type_traits>
+#include <utility>
+
+namespace LibGL
+{
+    template <typename T, typename... Args>
+    void EntityCommandBuffer::spawn(Entity* parent, Args&&... args)
+    {
+        static_assert(std::is_base_of_v<Entity, T>);
+
+        Entity::Handle parentHandle = parent != nullptr ? parent->getHandle() : nullptr;
+
+        m_commands.emplace_back([parentHandle = std::move(parentHandle), ...args = std::forward<Args>(args)]
+            (Resources::Scene& scene) mutable
+        {
+            if (parentHandle == nullptr)
+                scene.addNode<T>(std::move(args)...);
+            else if (Entity* parentEntity = *parentHandle)
+                parentEntity->addChild<T>(std::move(args)...);
+        });
+    }
+
+    template <typename T, typename... Args>
+    void EntityCommandBuffer::addComponent(Entity& entity, Args&&... args)
+    {
+        static_assert(std::is_base_of_v<Component, T>);
+
+        m_commands.emplace_back([handle = entity.getHandle(), ...args = std::forward<Args>(args)]
+            (Resources::Scene&) mutable
+        {
+            if (Entity* target = *handle)
+                target->addComponent<T>(std::move(args)...);
+        });
+    }
+}
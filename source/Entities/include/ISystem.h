@@ -0,0 +1,88 @@
+#pragma once
+#include "Archetype.h"
+
+#include <vector>
+
+namespace LibGL
+{
+    class ArchetypeStorage;
+
+    /**
+     * \brief Base class of the systems run by the SystemScheduler.
+     * Systems declare the types they read and write so that systems without conflicts can run concurrently.
+     */
+    class ISystem
+    {
+    public:
+        using TypeId = Archetype::TypeId;
+
+        ISystem() = default;
+        ISystem(const ISystem& other) = default;
+        ISystem(ISystem&& other) noexcept = default;
+        virtual ~ISystem() = default;
+
+        ISystem& operator=(const ISystem& other) = default;
+        ISystem& operator=(ISystem&& other) noexcept = default;
+
+        /**
+         * \brief Updates the system.
+         * Systems can run concurrently so structural changes must be recorded in the EntityCommandBuffer.
+         * \param storage The storage containing the scene's entities
+         */
+        virtual void update(ArchetypeStorage& storage) = 0;
+
+        /**
+         * \brief Gets the types read by the system
+         * \return The system's read types
+         */
+        const std::vector<TypeId>& getReads() const;
+
+        /**
+         * \brief Gets the types written by the system
+         * \return The system's written types
+         */
+        const std::vector<TypeId>& getWrites() const;
+
+        /**
+         * \brief Gets the component types whose update is performed by the system instead of their owner
+         * \return The system's batched component types
+         */
+        const std::vector<TypeId>& getBatchedTypes() const;
+
+        /**
+         * \brief Checks whether the system can't run concurrently with the given one
+         * \param other The system to check against
+         * \return True if one of the systems writes a type accessed by the other. False otherwise.
+         */
+        bool conflictsWith(const ISystem& other) const;
+
+    protected:
+        /**
+         * \brief Declares the given type as read by the system
+         * \tparam T The read type
+         */
+        template <typename T>
+        void addRead();
+
+        /**
+         * \brief Declares the given type as written by the system
+         * \tparam T The written type
+         */
+        template <typename T>
+        void addWrite();
+
+        /**
+         * \brief Declares the given component type as updated by the system
+         * \tparam T The batched component type
+         */
+        template <typename T>
+        void addBatched();
+
+    private:
+        std::vector<TypeId> m_reads;
+        std::vector<TypeId> m_writes;
+        std::vector<TypeId> m_batchedTypes;
+    };
+}
+
+#include "ISystem.inl"
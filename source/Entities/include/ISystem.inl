@@ -0,0 +1,25 @@
+#pragma once
+#include "ISystem.h"
+
+#include <typeinfo>
+
+namespace LibGL
+{
+    template <typename T>
+    void ISystem::addRead()
+    {
+        m_reads.push_back(typeid(T).hash_code());
+    }
+
+    template <typename T>
+    void ISystem::addWrite()
+    {
+        m_writes.push_back(typeid(T).hash_code());
+    }
+
+    template <typename T>
+    void ISystem::addBatched()
+    {
+        m_batchedTypes.push_back(typeid(T).hash_code());
+    }
+}
@@ -0,0 +1,98 @@
+#pragma once
+#include "Entity.h"
+#include "Resources/IResource.h"
+
+#include <memory> // shared_ptr
+#include <span>
+#include <vector>
+
+namespace LibGL::Resources
+{
+    class Scene;
+
+    /**
+     * \brief Template entity hierarchy from which identical entities can be instantiated.
+     * Instances copy the template's components while the data shared between them (meshes, materials...)
+     * is only copied once an instance modifies it.
+     */
+    class Prefab final : public IResource
+    {
+    public:
+        Prefab() = default;
+
+        /**
+         * \brief Creates a prefab from a copy of the given entity hierarchy
+         * \param source The entity to use as a template
+         */
+        explicit Prefab(const Entity& source);
+
+        Prefab(const Prefab& other) = delete;
+        Prefab(Prefab&& other) noexcept = default;
+        ~Prefab() override = default;
+
+        Prefab& operator=(const Prefab& other) = delete;
+        Prefab& operator=(Prefab&& other) noexcept = default;
+
+        /**
+         * \brief Loads the prefab's template from the given scene file. The file must contain a single root entity
+         * \param fileName The prefab's file path
+         * \return True if the prefab was successfully loaded. False otherwise.
+         */
+        bool load(const char* fileName) override;
+
+        /**
+         * \brief Saves the prefab's template to the given file
+         * \param fileName The output file's path
+         * \return True if the prefab was successfully saved. False otherwise.
+         */
+        bool save(const std::string& fileName) const;
+
+        /**
+         * \brief Checks whether the prefab has a template or not
+         * \return True if the prefab has a template. False otherwise.
+         */
+        bool isValid() const;
+
+        /**
+         * \brief Creates an instance of the prefab at the root of the given scene
+         * \param scene The scene to add the instance to
+         * \param transform The instance's transform
+         * \return A reference to the created instance
+         */
+        Entity& instantiate(Scene& scene, const LibMath::Transform& transform) const;
+
+        /**
+         * \brief Creates an instance of the prefab as a child of the given entity
+         * \param parent The instance's parent
+         * \param transform The instance's local transform
+         * \return A reference to the created instance
+         */
+        Entity& instantiate(Entity& parent, const LibMath::Transform& transform) const;
+
+        /**
+         * \brief Creates an instance of the prefab for each of the given transforms at the root of the given scene.
+         * The instances are all created before being added to the scene at once.
+         * \param scene The scene to add the instances to
+         * \param transforms The instances' transforms
+         * \return Pointers to the created instances
+         */
+        std::vector<Entity*> instantiate(Scene& scene, std::span<const LibMath::Transform> transforms) const;
+
+    private:
+        std::shared_ptr<Entity> m_template;
+        bool                    m_isActive = true;
+
+        /**
+         * \brief Sets the prefab's template to the given entity
+         * \param entity The prefab's new template
+         */
+        void setTemplate(std::shared_ptr<Entity> entity);
+
+        /**
+         * \brief Creates a detached instance of the prefab
+         * \param transform The instance's transform
+         * \return A pointer to the created instance
+         */
+        std::shared_ptr<Entity> createInstance(const LibMath::Transform& transform) const;
+    };
+}
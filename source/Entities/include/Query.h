@@ -0,0 +1,87 @@
+#pragma once
+#include "ArchetypeStorage.h"
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+namespace LibGL
+{
+    /**
+     * \brief Iterates linearly over the chunks of every archetype matching the given types.
+     * Entity types match on the entity itself while component types match on its components' columns.
+     * \tparam Ts The required entity and/or component types
+     */
+    template <typename... Ts>
+    class Query
+    {
+    public:
+        explicit Query(ArchetypeStorage& storage);
+
+        /**
+         * \brief Calls the given function for each matching entity
+         * \param func The function to call. Receives the entity followed by a reference to each queried type
+         */
+        template <typename Func>
+        void forEach(Func func);
+
+        /**
+         * \brief Calls the given function for each matching entity, dispatching the chunks on the thread pool.
+         * Falls back to forEach when no thread pool is provided
+         * \param func The function to call. Receives the entity followed by a reference to each queried type
+         */
+        template <typename Func>
+        void forEachParallel(Func func);
+
+        /**
+         * \brief Counts the entities matching the query
+         * \return The number of matching entities
+         */
+        size_t count();
+
+    private:
+        static constexpr size_t ENTITY_COLUMN = ~static_cast<size_t>(0);
+
+        enum class EMatchState : uint8_t
+        {
+            UNKNOWN,
+            MATCH,
+            NO_MATCH
+        };
+
+        struct Match
+        {
+            const Archetype*                  m_archetype;
+            std::array<size_t, sizeof...(Ts)> m_columns;
+        };
+
+        ArchetypeStorage*        m_storage;
+        std::vector<EMatchState> m_states;
+        std::vector<Match>       m_matches;
+
+        /**
+         * \brief Checks the archetypes created or filled since the last refresh
+         */
+        void refresh();
+
+        /**
+         * \brief Tries to match the given archetype with the queried types
+         * \param archetype The archetype to check (must not be empty)
+         * \param match The match to fill
+         * \return True if the archetype matches. False otherwise.
+         */
+        static bool tryMatch(const Archetype& archetype, Match& match);
+
+        template <typename T>
+        static bool findColumn(const Archetype& archetype, size_t& column);
+
+        template <typename T>
+        static T& getRow(const Archetype::Chunk& chunk, size_t column, size_t row);
+
+        template <typename Func, size_t... Indices>
+        static void forEachInChunk(const Match& match, const Archetype::Chunk& chunk, Func& func,
+                                   std::index_sequence<Indices...>);
+    };
+}
+
+#include "Query.inl"
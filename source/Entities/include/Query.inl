@@ -0,0 +1,159 @@
+#pragma once
+#include "Component.h"
+#include "Entity.h"
+#include "Query.h"
+
+#include "Utility/ServiceLocator.h"
+#include "Utility/ThreadPool.h"
+
+#include <type_traits>
+#include <utility>
+
+namespace LibGL
+{
+    template <typename... Ts>
+    Query<Ts...>::Query(ArchetypeStorage& storage)
+        : m_storage(&storage)
+    {
+        static_assert(((std::is_base_of_v<Component, Ts> || std::is_base_of_v<Entity, Ts>) && ...));
+    }
+
+    template <typename... Ts>
+    template <typename Func>
+    void Query<Ts...>::forEach(Func func)
+    {
+        refresh();
+
+        for (const Match& match : m_matches)
+        {
+            const Archetype& archetype = *match.m_archetype;
+
+            for (size_t i = 0; i < archetype.getChunkCount(); ++i)
+                forEachInChunk(match, archetype.getChunk(i), func, std::index_sequence_for<Ts...>{});
+        }
+    }
+
+    template <typename... Ts>
+    template <typename Func>
+    void Query<Ts...>::forEachParallel(Func func)
+    {
+        Utility::ThreadPool* threadPool = LGL_TRY_SERVICE(Utility::ThreadPool);
+
+        if (threadPool == nullptr)
+        {
+            forEach(std::move(func));
+            return;
+        }
+
+        refresh();
+
+        std::vector<std::pair<const Match*, const Archetype::Chunk*>> chunks;
+
+        for (const Match& match : m_matches)
+        {
+            for (size_t i = 0; i < match.m_archetype->getChunkCount(); ++i)
+                chunks.emplace_back(&match, &match.m_archetype->getChunk(i));
+        }
+
+        threadPool->parallelFor(chunks.size(), [&chunks, &func](const size_t index)
+        {
+            const auto [match, chunk] = chunks[index];
+            forEachInChunk(*match, *chunk, func, std::index_sequence_for<Ts...>{});
+        });
+    }
+
+    template <typename... Ts>
+    size_t Query<Ts...>::count()
+    {
+        refresh();
+
+        size_t total = 0;
+
+        for (const Match& match : m_matches)
+            total += match.m_archetype->getEntityCount();
+
+        return total;
+    }
+
+    template <typename... Ts>
+    void Query<Ts...>::refresh()
+    {
+        const size_t archetypeCount = m_storage->getArchetypeCount();
+
+        if (m_states.size() < archetypeCount)
+            m_states.resize(archetypeCount, EMatchState::UNKNOWN);
+
+        for (size_t i = 0; i < archetypeCount; ++i)
+        {
+            // Empty archetypes can't be matched since the types are checked on their first row
+            const Archetype& archetype = m_storage->getArchetype(i);
+
+            if (m_states[i] != EMatchState::UNKNOWN || archetype.getEntityCount() == 0)
+                continue;
+
+            Match match{ &archetype, {} };
+
+            if (tryMatch(archetype, match))
+            {
+                m_states[i] = EMatchState::MATCH;
+                m_matches.push_back(match);
+            }
+            else
+            {
+                m_states[i] = EMatchState::NO_MATCH;
+            }
+        }
+    }
+
+    template <typename... Ts>
+    bool Query<Ts...>::tryMatch(const Archetype& archetype, Match& match)
+    {
+        size_t index = 0;
+        return (findColumn<Ts>(archetype, match.m_columns[index++]) && ...);
+    }
+
+    template <typename... Ts>
+    template <typename T>
+    bool Query<Ts...>::findColumn(const Archetype& archetype, size_t& column)
+    {
+        const Archetype::Chunk& chunk = archetype.getChunk(0);
+
+        if constexpr (std::is_base_of_v<Entity, T>)
+        {
+            column = ENTITY_COLUMN;
+            return dynamic_cast<const T*>(chunk.getEntities()[0]) != nullptr;
+        }
+        else
+        {
+            for (column = 0; column < archetype.getColumnCount(); ++column)
+            {
+                if (dynamic_cast<const T*>(chunk.getColumn(column)[0]) != nullptr)
+                    return true;
+            }
+
+            return false;
+        }
+    }
+
+    template <typename... Ts>
+    template <typename T>
+    T& Query<Ts...>::getRow(const Archetype::Chunk& chunk, [[maybe_unused]] const size_t column, const size_t row)
+    {
+        // The types have been checked on match so the rows can be cast without any runtime check
+        if constexpr (std::is_base_of_v<Entity, T>)
+            return static_cast<T&>(*chunk.getEntities()[row]);
+        else
+            return static_cast<T&>(*chunk.getColumn(column)[row]);
+    }
+
+    template <typename... Ts>
+    template <typename Func, size_t... Indices>
+    void Query<Ts...>::forEachInChunk(const Match& match, const Archetype::Chunk& chunk, Func& func,
+                                      std::index_sequence<Indices...>)
+    {
+        Entity* const* entities = chunk.getEntities();
+
+        for (size_t row = 0; row < chunk.getSize(); ++row)
+            func(*entities[row], getRow<Ts>(chunk, match.m_columns[Indices], row)...);
+    }
+}
@@ -7,6 +7,47 @@ namespace LibGL::Resources
     class Scene : public DataStructure::Graph<Entity>
     {
     public:
+        /**
+         * \brief Adds a copy of the given entity to the scene
+         * \param node The entity to add to the scene
+         * \return A reference to the added entity
+         */
+        template <typename DataT>
+        DataT& addNode(DataT& node);
+
+        /**
+         * \brief Adds an entity of the given type to the scene
+         * \param args The arguments to pass to the created entity's constructor
+         * \return A reference to the added entity
+         */
+        template <typename DataT, typename... Args>
+        DataT& addNode(Args&&... args);
+
+        /**
+         * \brief Adds an existing entity to the scene's root entities
+         * \param node The entity to add to the scene
+         */
+        void attachNode(const std::shared_ptr<Entity>& node);
+
+        /**
+         * \brief Adds the given existing entities to the scene's root entities
+         * \param nodes The entities to add to the scene
+         */
+        void attachNodes(const std::vector<std::shared_ptr<Entity>>& nodes);
+
+        /**
+         * \brief Updates the scene's entities, runs the provided SystemScheduler's systems, if any,
+         * then applies the recorded EntityCommandBuffer commands
+         */
         virtual void update();
+
+    private:
+        /**
+         * \brief Registers the given root entity and its children in the archetype storage, if any
+         * \param node The added entity
+         */
+        static void onNodeAdded(Entity& node);
     };
 }
+
+#include "Scene.inl"
@@ -0,0 +1,21 @@
+#pragma once
+#include "Scene.h"
+
+namespace LibGL::Resources
+{
+    template <typename DataT>
+    DataT& Scene::addNode(DataT& node)
+    {
+        DataT& addedNode = Graph::addNode(node);
+        onNodeAdded(addedNode);
+        return addedNode;
+    }
+
+    template <typename DataT, typename... Args>
+    DataT& Scene::addNode(Args&&... args)
+    {
+        DataT& addedNode = Graph::addNode<DataT>(std::forward<Args>(args)...);
+        onNodeAdded(addedNode);
+        return addedNode;
+    }
+}
@@ -0,0 +1,222 @@
+#pragma once
+#include "Utility/BinaryReader.h"
+#include "Utility/BinaryWriter.h"
+
+#include <memory> // shared_ptr
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#define REGISTER_ENTITY_TYPE(Type) static uint8_t regEntity_##Type = (LibGL::Resources::SceneSerializer::registerEntityType<Type>(#Type), 0)
+#define REGISTER_COMPONENT_TYPE(Type) static uint8_t regComponent_##Type = (LibGL::Resources::SceneSerializer::registerComponentType<Type>(#Type), 0)
+
+namespace LibGL
+{
+    class Component;
+    class Entity;
+}
+
+namespace LibGL::Resources
+{
+    class IResource;
+    class Scene;
+
+    /**
+     * \brief A resource referenced by a scene file
+     */
+    struct SceneResource
+    {
+        std::string m_type;
+        std::string m_path;
+    };
+
+    /**
+     * \brief Binary writer collecting the resources referenced by the serialized scene
+     */
+    class SceneWriter : public Utility::BinaryWriter
+    {
+    public:
+        /**
+         * \brief Writes the hash of the given resource's path and adds it to the scene's resource table
+         * \param resource The resource to reference. Can be nullptr
+         */
+        void writeResource(const IResource* resource);
+
+    private:
+        friend class SceneSerializer;
+
+        std::unordered_map<uint64_t, SceneResource> m_resources;
+    };
+
+    /**
+     * \brief Binary reader resolving the resources referenced by the serialized scene
+     */
+    class SceneReader : public Utility::BinaryReader
+    {
+    public:
+        using BinaryReader::BinaryReader;
+
+        /**
+         * \brief Reads a resource reference written by SceneWriter::writeResource
+         * \return A pointer to the referenced resource. nullptr if it isn't loaded or isn't of the given type
+         */
+        template <typename T>
+        T* readResource();
+
+    private:
+        friend class SceneSerializer;
+
+        std::unordered_map<uint64_t, IResource*> m_resources;
+    };
+
+    /**
+     * \brief Saves and loads scenes in a compact binary format.
+     * Entity types must provide a `void serialize(SceneWriter&) const` function and a
+     * `static std::shared_ptr<T> deserialize(SceneReader&)` function returning nullptr on failure.
+     * Component types must provide a `void serialize(SceneWriter&) const` function and a
+     * `static T& deserialize(Entity& owner, SceneReader&)` function adding the component to its owner.
+     */
+    class SceneSerializer
+    {
+    public:
+        using TypeId = uint64_t;
+
+        /**
+         * \brief Registers the given entity type (required for it to be saved and loaded)
+         * \tparam T The entity type to register
+         * \param name The registered entity type's name
+         */
+        template <typename T>
+        static void registerEntityType(const std::string& name);
+
+        /**
+         * \brief Registers the given component type (required for it to be saved and loaded)
+         * \tparam T The component type to register
+         * \param name The registered component type's name
+         */
+        template <typename T>
+        static void registerComponentType(const std::string& name);
+
+        /**
+         * \brief Saves the given scene to the given file
+         * \param scene The scene to save
+         * \param fileName The output file's path
+         * \return True if the scene was successfully saved. False otherwise.
+         */
+        static bool save(const Scene& scene, const std::string& fileName);
+
+        /**
+         * \brief Saves the given root entities to the given file
+         * \param roots The root entities to save
+         * \param fileName The output file's path
+         * \return True if the entities were successfully saved. False otherwise.
+         */
+        static bool save(const std::vector<std::shared_ptr<const Entity>>& roots, const std::string& fileName);
+
+        /**
+         * \brief Loads the entities of the given file into the given scene.
+         * The referenced resources which aren't loaded yet are loaded in parallel when a thread pool is provided.
+         * \param scene The scene to add the loaded entities to
+         * \param fileName The scene file's path
+         * \return True if the scene was successfully loaded. False otherwise.
+         */
+        static bool load(Scene& scene, const std::string& fileName);
+
+        /**
+         * \brief Loads the root entities of the given file without adding them to a scene
+         * \param roots The vector to append the loaded root entities to
+         * \param fileName The scene file's path
+         * \return True if the entities were successfully loaded. False otherwise.
+         */
+        static bool load(std::vector<std::shared_ptr<Entity>>& roots, const std::string& fileName);
+
+        /**
+         * \brief Reads the table of the resources referenced by the given scene file without loading them
+         * \param fileName The scene file's path
+         * \param resources The vector to append the referenced resources to
+         * \return True if the resource table was successfully read. False otherwise.
+         */
+        static bool readResourceTable(const std::string& fileName, std::vector<SceneResource>& resources);
+
+        /**
+         * \brief Reads the table of the resources referenced by the given scene data without loading them
+         * \param data The scene file's content
+         * \param resources The vector to append the referenced resources to
+         * \return True if the resource table was successfully read. False otherwise.
+         */
+        static bool readResourceTable(std::span<const uint8_t> data, std::vector<SceneResource>& resources);
+
+        /**
+         * \brief Reads the header and the resources of the given scene data before its root entities are read one
+         * at a time with loadEntity (e.g. to spread a large scene's load over several frames)
+         * \param reader The scene's reader
+         * \param rootCount The number of root entities to read
+         * \return True if the header and the resource table were successfully read. False otherwise.
+         */
+        static bool beginLoad(SceneReader& reader, uint32_t& rootCount);
+
+        /**
+         * \brief Reads an entity, its components and its children
+         * \param reader The scene's reader
+         * \return A pointer to the read entity. nullptr on failure
+         */
+        static std::shared_ptr<Entity> loadEntity(SceneReader& reader);
+
+    private:
+        using EntitySaveFunc = void (*)(const Entity&, SceneWriter&);
+        using EntityLoadFunc = std::shared_ptr<Entity> (*)(SceneReader&);
+        using ComponentSaveFunc = void (*)(const Component&, SceneWriter&);
+        using ComponentLoadFunc = Component& (*)(Entity&, SceneReader&);
+
+        struct EntityType
+        {
+            EntitySaveFunc m_save;
+            EntityLoadFunc m_load;
+        };
+
+        struct ComponentType
+        {
+            ComponentSaveFunc m_save;
+            ComponentLoadFunc m_load;
+        };
+
+        static constexpr uint32_t MAGIC = 0x534C474C; // "LGLS"
+        static constexpr uint32_t VERSION = 5;
+
+        inline static std::unordered_map<TypeId, EntityType>    s_entityTypes{};
+        inline static std::unordered_map<TypeId, ComponentType> s_componentTypes{};
+        inline static std::unordered_map<size_t, TypeId>        s_typeIds{};
+
+        /**
+         * \brief Checks the scene file's header
+         * \param reader The scene's reader
+         * \return True if the header is valid. False otherwise.
+         */
+        static bool readHeader(SceneReader& reader);
+
+        /**
+         * \brief Writes the given entity, its components and its children
+         * \param entity The entity to write
+         * \param writer The scene's writer
+         */
+        static void saveEntity(const Entity& entity, SceneWriter& writer);
+
+        /**
+         * \brief Reads the scene's resource table and loads the missing resources
+         * \param reader The scene's reader
+         * \return True if the resource table was successfully read. False otherwise.
+         */
+        static bool loadResources(SceneReader& reader);
+
+        /**
+         * \brief Moves the reader to the end of a block, skipping the unread bytes
+         * \param reader The scene's reader
+         * \param blockEnd The offset of the end of the block
+         * \return True if the block was read within its bounds. False otherwise.
+         */
+        static bool endBlock(SceneReader& reader, size_t blockEnd);
+    };
+}
+
+#include "SceneSerializer.inl"
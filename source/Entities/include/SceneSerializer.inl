@@ -0,0 +1,71 @@
+#pragma once
+#include "SceneSerializer.h"
+
+#include "Component.h"
+#include "Entity.h"
+
+#include "Debug/Assertion.h"
+#include "Resources/IResource.h"
+#include "Utility/utility.h"
+
+#include <type_traits>
+
+namespace LibGL::Resources
+{
+    template <typename T>
+    T* SceneReader::readResource()
+    {
+        static_assert(std::is_base_of_v<IResource, T>);
+
+        const auto it = m_resources.find(read<uint64_t>());
+        return it != m_resources.end() ? dynamic_cast<T*>(it->second) : nullptr;
+    }
+
+    template <typename T>
+    void SceneSerializer::registerEntityType(const std::string& name)
+    {
+        static_assert(std::is_base_of_v<Entity, T>);
+
+        const TypeId typeId = Utility::hashString(name);
+
+        ASSERT(!s_entityTypes.contains(typeId), "Entity type \"%s\" has already been registered", name.c_str());
+
+        s_entityTypes[typeId] =
+        {
+            [](const Entity& entity, SceneWriter& writer)
+            {
+                static_cast<const T&>(entity).serialize(writer);
+            },
+            [](SceneReader& reader) -> std::shared_ptr<Entity>
+            {
+                return T::deserialize(reader);
+            }
+        };
+
+        s_typeIds[typeid(T).hash_code()] = typeId;
+    }
+
+    template <typename T>
+    void SceneSerializer::registerComponentType(const std::string& name)
+    {
+        static_assert(std::is_base_of_v<Component, T>);
+
+        const TypeId typeId = Utility::hashString(name);
+
+        ASSERT(!s_componentTypes.contains(typeId), "Component type \"%s\" has already been registered", name.c_str());
+
+        s_componentTypes[typeId] =
+        {
+            [](const Component& component, SceneWriter& writer)
+            {
+                static_cast<const T&>(component).serialize(writer);
+            },
+            [](Entity& owner, SceneReader& reader) -> Component&
+            {
+                return T::deserialize(owner, reader);
+            }
+        };
+
+        s_typeIds[typeid(T).hash_code()] = typeId;
+    }
+}
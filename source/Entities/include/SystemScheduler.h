@@ -0,0 +1,65 @@
+#pragma once
+#include "ISystem.h"
+
+#include <memory> // unique_ptr
+#include <unordered_set>
+
+namespace LibGL
+{
+    class Component;
+
+    /**
+     * \brief Runs the registered systems on the scene's archetype storage.
+     * Systems are grouped in stages of non-conflicting systems which are run concurrently on the thread pool, if any.
+     * Conflicting systems keep their registration order.
+     */
+    class SystemScheduler
+    {
+    public:
+        SystemScheduler() = default;
+        SystemScheduler(const SystemScheduler& other) = delete;
+        SystemScheduler(SystemScheduler&& other) noexcept = default;
+        ~SystemScheduler() = default;
+
+        SystemScheduler& operator=(const SystemScheduler& other) = delete;
+        SystemScheduler& operator=(SystemScheduler&& other) noexcept = default;
+
+        /**
+         * \brief Registers a system of the given type
+         * \param args The arguments to pass to the created system's constructor
+         * \return A reference to the added system
+         */
+        template <typename T, typename... Args>
+        T& addSystem(Args&&... args);
+
+        /**
+         * \brief Unregisters the systems of the given type
+         */
+        template <typename T>
+        void removeSystem();
+
+        /**
+         * \brief Runs every registered system on the ArchetypeStorage provided to the ServiceLocator, if any
+         */
+        void update();
+
+        /**
+         * \brief Checks whether the given component's update is performed by a system or by its owner
+         * \param component The component to check
+         * \return True if the component's update is performed by a system. False otherwise.
+         */
+        bool isBatched(const Component& component) const;
+
+    private:
+        std::vector<std::unique_ptr<ISystem>> m_systems;
+        std::vector<std::vector<ISystem*>>    m_stages;
+        std::unordered_set<ISystem::TypeId>   m_batchedTypes;
+
+        /**
+         * \brief Groups the registered systems in stages of non-conflicting systems
+         */
+        void buildStages();
+    };
+}
+
+#include "SystemScheduler.inl"
@@ -0,0 +1,30 @@
+#pragma once
+#include "SystemScheduler.h"
+
+#include <type_traits>
+#include <utility>
+
+namespace LibGL
+{
+    template <typename T, typename... Args>
+    T& SystemScheduler::addSystem(Args&&... args)
+    {
+        static_assert(std::is_base_of_v<ISystem, T>);
+
+        m_systems.push_back(std::make_unique<T>(std::forward<Args>(args)...));
+        buildStages();
+
+        return static_cast<T&>(*m_systems.back());
+    }
+
+    template <typename T>
+    void SystemScheduler::removeSystem()
+    {
+        std::erase_if(m_systems, [](const std::unique_ptr<ISystem>& system)
+        {
+            return dynamic_cast<const T*>(system.get()) != nullptr;
+        });
+
+        buildStages();
+    }
+}
@@ -0,0 +1,226 @@
+#pragma once
+#include "SceneSerializer.h"
+
+#include "Vector/Vector3.h"
+
+#include <future>
+#include <memory> // weak_ptr
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace LibGL
+{
+    class Entity;
+}
+
+namespace LibGL::Resources
+{
+    class IResource;
+    class Scene;
+
+    /**
+     * \brief Streams a scene split into square cells on the XZ plane, each cell being stored in its own scene file.
+     * Cells are read in the background when they get within the load radius of the view, their entities being created
+     * one root at a time within the frame budget, and unloaded once they get out of the (larger) unload radius.
+     */
+    class WorldStreamer
+    {
+    public:
+        struct CellCoord
+        {
+            int32_t m_x;
+            int32_t m_z;
+
+            bool operator==(const CellCoord& other) const = default;
+        };
+
+        WorldStreamer() = delete;
+        WorldStreamer(Scene& scene, std::string directory, float cellSize);
+
+        WorldStreamer(const WorldStreamer& other) = delete;
+        WorldStreamer(WorldStreamer&& other) noexcept = default;
+        ~WorldStreamer();
+
+        WorldStreamer& operator=(const WorldStreamer& other) = delete;
+        WorldStreamer& operator=(WorldStreamer&& other) noexcept = default;
+
+        /**
+         * \brief Requests the cells around the given position, unloads the distant ones
+         * and processes the loaded data within the frame budget
+         * \param viewPosition The world position around which the cells should be loaded
+         */
+        void update(const LibMath::Vector3& viewPosition);
+
+        /**
+         * \brief Unloads all the loaded cells and drops the pending ones
+         */
+        void unloadAll();
+
+        /**
+         * \brief Sets the distances within which the cells are loaded and beyond which they are unloaded
+         * \param loadRadius The distance from the view within which the cells are loaded
+         * \param unloadRadius The distance from the view beyond which the cells are unloaded (at least the load radius)
+         */
+        void setRadii(float loadRadius, float unloadRadius);
+
+        /**
+         * \brief Sets the time that can be spent on the main thread each frame to create and destroy entities.
+         * At least one operation is done each frame to ensure the streaming progresses.
+         * \param milliseconds The streamer's frame budget in milliseconds
+         */
+        void setFrameBudget(float milliseconds);
+
+        /**
+         * \brief Sets the maximum number of cells being read in the background at the same time
+         * \param count The streamer's maximum pending cell count
+         */
+        void setMaxPendingCells(size_t count);
+
+        /**
+         * \brief Gets the cell containing the given world position
+         * \param position The world position whose cell should be returned
+         * \return The coordinates of the cell containing the position
+         */
+        CellCoord getCell(const LibMath::Vector3& position) const;
+
+        /**
+         * \brief Gets the path of the given cell's scene file
+         * \param cell The cell whose path should be returned
+         * \return The path of the cell's scene file
+         */
+        std::string getCellPath(CellCoord cell) const;
+
+        /**
+         * \brief Checks whether the entities of the given cell are in the scene or not
+         * \param cell The cell to check
+         * \return True if the cell is loaded. False otherwise.
+         */
+        bool isCellLoaded(CellCoord cell) const;
+
+        /**
+         * \brief Gets the number of loaded cells
+         * \return The number of cells whose entities are in the scene
+         */
+        size_t getLoadedCellCount() const;
+
+        /**
+         * \brief Saves the root entities of the given scene to the files of the cells containing them
+         * \param scene The scene to partition
+         * \param directory The directory in which the cell files should be saved
+         * \param cellSize The size of a cell in world units
+         * \return True if all the cells were successfully saved. False otherwise.
+         */
+        static bool partition(const Scene& scene, const std::string& directory, float cellSize);
+
+    private:
+        enum class ECellState : uint8_t
+        {
+            READING_FILE,
+            LOADING_RESOURCES,
+            LOADING_ENTITIES,
+            LOADED
+        };
+
+        struct CellFile
+        {
+            std::vector<uint8_t>       m_data;
+            std::vector<SceneResource> m_resources;
+        };
+
+        struct Cell
+        {
+            std::future<std::optional<CellFile>> m_file;
+            std::vector<uint8_t>                 m_data;
+            std::optional<SceneReader>           m_reader;
+            std::vector<std::string>             m_resources;
+            std::vector<std::weak_ptr<Entity>>   m_roots;
+            uint32_t                             m_remainingRoots = 0;
+            float                                m_distanceSqr = 0.f;
+            ECellState                           m_state = ECellState::READING_FILE;
+        };
+
+        struct CellHash
+        {
+            size_t operator()(const CellCoord& cell) const;
+        };
+
+        using CellMap = std::unordered_map<CellCoord, Cell, CellHash>;
+
+        CellMap                                                         m_cells;
+        std::unordered_map<std::string, std::shared_future<IResource*>> m_pendingResources;
+        std::string                                                     m_directory;
+        Scene*                                                          m_scene;
+        size_t                                                          m_maxPendingCells = 4;
+        float                                                           m_cellSize;
+        float                                                           m_loadRadius;
+        float                                                           m_unloadRadius;
+        float                                                           m_frameBudget = 2.f;
+
+        /**
+         * \brief Requests the missing cells within the load radius of the given position, closest first
+         * \param viewPosition The view's world position
+         */
+        void requestCells(const LibMath::Vector3& viewPosition);
+
+        /**
+         * \brief Starts reading the file and the resource table of the given cell in the background
+         * \param coord The cell to read
+         */
+        void requestCell(CellCoord coord);
+
+        /**
+         * \brief Starts loading the resources of the given cell which aren't loaded or being loaded yet
+         * \param cell The cell whose resources should be loaded
+         * \param resources The cell's resource table
+         */
+        void loadResources(Cell& cell, const std::vector<SceneResource>& resources);
+
+        /**
+         * \brief Advances the given cell to its next state if its data is ready, or adds its next root entity
+         * to the scene once its resources are loaded
+         * \param coord The cell's coordinates
+         * \param cell The cell to advance
+         * \return True if some work was done on the main thread. False otherwise.
+         */
+        bool advanceCell(CellCoord coord, Cell& cell);
+
+        /**
+         * \brief Removes the given cell's entities from the scene
+         * \param cell The cell to unload
+         */
+        void unloadCell(Cell& cell) const;
+
+        /**
+         * \brief Computes the squared horizontal distance between the given position and the given cell
+         * \param coord The cell's coordinates
+         * \param position The world position to compute the distance from
+         * \return The squared distance between the position and the closest point of the cell
+         */
+        float getDistanceSqr(CellCoord coord, const LibMath::Vector3& position) const;
+
+        /**
+         * \brief Initializes the given resource loaded in the background, removing it on failure
+         * \param path The resource's path
+         * \param resource The loaded resource. nullptr if the resource couldn't be loaded
+         */
+        static void initResource(const std::string& path, IResource* resource);
+
+        /**
+         * \brief Gets the cell containing the given world position
+         * \param position The world position whose cell should be returned
+         * \param cellSize The size of a cell in world units
+         * \return The coordinates of the cell containing the position
+         */
+        static CellCoord getCell(const LibMath::Vector3& position, float cellSize);
+
+        /**
+         * \brief Gets the path of the given cell's scene file in the given directory
+         * \param directory The directory containing the cell files
+         * \param cell The cell whose path should be returned
+         * \return The path of the cell's scene file
+         */
+        static std::string getCellPath(const std::string& directory, CellCoord cell);
+    };
+}
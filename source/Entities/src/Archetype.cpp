@@ -0,0 +1,121 @@
+#include "Archetype.h"
+
+#include "Debug/Assertion.h"
+
+#include <algorithm>
+
+namespace LibGL
+{
+    Archetype::Chunk::Chunk(const size_t capacity, const size_t columnCount)
+        : m_entities(std::make_unique<Entity*[]>(capacity)),
+        m_components(std::make_unique<Component*[]>(capacity * columnCount)), m_capacity(capacity)
+    {
+    }
+
+    size_t Archetype::Chunk::getSize() const
+    {
+        return m_size;
+    }
+
+    Entity* const* Archetype::Chunk::getEntities() const
+    {
+        return m_entities.get();
+    }
+
+    Component* const* Archetype::Chunk::getColumn(const size_t column) const
+    {
+        return m_components.get() + column * m_capacity;
+    }
+
+    Archetype::Archetype(Signature signature)
+        : m_signature(std::move(signature))
+    {
+        ASSERT(!m_signature.empty());
+
+        // Each row holds the entity and one pointer per column
+        const size_t rowSize = sizeof(void*) * m_signature.size();
+        m_chunkCapacity = std::max(CHUNK_SIZE / rowSize, static_cast<size_t>(1));
+    }
+
+    const Archetype::Signature& Archetype::getSignature() const
+    {
+        return m_signature;
+    }
+
+    size_t Archetype::getColumnCount() const
+    {
+        return m_signature.size() - 1;
+    }
+
+    size_t Archetype::getEntityCount() const
+    {
+        return m_entityCount;
+    }
+
+    size_t Archetype::getChunkCount() const
+    {
+        return m_chunks.size();
+    }
+
+    const Archetype::Chunk& Archetype::getChunk(const size_t index) const
+    {
+        return m_chunks[index];
+    }
+
+    size_t Archetype::add(Entity& entity, const std::vector<Component*>& components)
+    {
+        if (m_chunks.empty() || m_chunks.back().m_size == m_chunkCapacity)
+            m_chunks.emplace_back(m_chunkCapacity, getColumnCount());
+
+        Chunk& chunk = m_chunks.back();
+        chunk.m_entities[chunk.m_size] = &entity;
+        ++chunk.m_size;
+
+        const size_t row = m_entityCount++;
+        set(row, components);
+
+        return row;
+    }
+
+    void Archetype::set(const size_t row, const std::vector<Component*>& components)
+    {
+        ASSERT(components.size() == getColumnCount());
+
+        Chunk&       chunk = m_chunks[row / m_chunkCapacity];
+        const size_t chunkRow = row % m_chunkCapacity;
+
+        for (size_t column = 0; column < components.size(); ++column)
+            chunk.m_components[column * m_chunkCapacity + chunkRow] = components[column];
+    }
+
+    Entity* Archetype::remove(const size_t row)
+    {
+        ASSERT(row < m_entityCount);
+
+        const size_t lastRow = --m_entityCount;
+        Chunk&       lastChunk = m_chunks.back();
+        Entity*      movedEntity = nullptr;
+
+        // Fill the hole with the last row to keep the chunks tightly packed
+        if (row != lastRow)
+        {
+            Chunk&       chunk = m_chunks[row / m_chunkCapacity];
+            const size_t chunkRow = row % m_chunkCapacity;
+            const size_t lastChunkRow = lastRow % m_chunkCapacity;
+
+            movedEntity = lastChunk.m_entities[lastChunkRow];
+            chunk.m_entities[chunkRow] = movedEntity;
+
+            for (size_t column = 0; column < getColumnCount(); ++column)
+            {
+                chunk.m_components[column * m_chunkCapacity + chunkRow] =
+                    lastChunk.m_components[column * m_chunkCapacity + lastChunkRow];
+            }
+        }
+
+        if (--lastChunk.m_size == 0)
+            m_chunks.pop_back();
+
+        return movedEntity;
+    }
+}
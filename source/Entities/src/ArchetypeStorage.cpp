@@ -0,0 +1,97 @@
+#include "ArchetypeStorage.h"
+
+#include "Entity.h"
+
+#include <algorithm>
+
+namespace LibGL
+{
+    void ArchetypeStorage::update(Entity& entity)
+    {
+        // Sort the components by type to get the same column layout for every entity of the archetype
+        std::vector<Component*> components;
+        components.reserve(entity.m_components.size());
+
+        for (const auto& component : entity.m_components)
+            components.push_back(component.get());
+
+        const auto getTypeId = [](const Component* component)
+        {
+            return typeid(*component).hash_code();
+        };
+
+        std::ranges::stable_sort(components, {}, getTypeId);
+
+        Archetype::Signature signature;
+        signature.reserve(components.size() + 1);
+        signature.push_back(typeid(entity).hash_code());
+
+        for (const Component* component : components)
+            signature.push_back(getTypeId(component));
+
+        const size_t archetypeIndex = getOrCreateArchetype(std::move(signature));
+
+        if (const auto it = m_locations.find(&entity); it != m_locations.end())
+        {
+            if (it->second.m_archetype == archetypeIndex)
+            {
+                m_archetypes[archetypeIndex]->set(it->second.m_row, components);
+                return;
+            }
+
+            remove(entity);
+        }
+
+        const size_t row = m_archetypes[archetypeIndex]->add(entity, components);
+        m_locations[&entity] = { archetypeIndex, row };
+    }
+
+    void ArchetypeStorage::updateHierarchy(Entity& root)
+    {
+        update(root);
+
+        for (const auto& child : root.getChildren())
+            updateHierarchy(reinterpret_cast<Entity&>(*child));
+    }
+
+    void ArchetypeStorage::remove(const Entity& entity)
+    {
+        const auto it = m_locations.find(&entity);
+
+        if (it == m_locations.end())
+            return;
+
+        const auto [archetypeIndex, row] = it->second;
+        m_locations.erase(it);
+
+        if (const Entity* movedEntity = m_archetypes[archetypeIndex]->remove(row))
+            m_locations[movedEntity].m_row = row;
+    }
+
+    bool ArchetypeStorage::contains(const Entity& entity) const
+    {
+        return m_locations.contains(&entity);
+    }
+
+    size_t ArchetypeStorage::getArchetypeCount() const
+    {
+        return m_archetypes.size();
+    }
+
+    const Archetype& ArchetypeStorage::getArchetype(const size_t index) const
+    {
+        return *m_archetypes[index];
+    }
+
+    size_t ArchetypeStorage::getOrCreateArchetype(Archetype::Signature signature)
+    {
+        if (const auto it = m_archetypeIndices.find(signature); it != m_archetypeIndices.end())
+            return it->second;
+
+        const size_t index = m_archetypes.size();
+        m_archetypeIndices[signature] = index;
+        m_archetypes.push_back(std::make_unique<Archetype>(std::move(signature)));
+
+        return index;
+    }
+}
@@ -5,12 +5,12 @@
 namespace LibGL
 {
     Component::Component(const Component& other)
-        : m_owner(other.m_owner), m_id(s_currentId++), m_isActive(other.m_isActive)
+        : m_owner(other.m_owner), m_cloneFunc(other.m_cloneFunc), m_id(s_currentId++), m_isActive(other.m_isActive)
     {
     }
 
     Component::Component(Component&& other) noexcept
-        : m_owner(other.m_owner), m_id(other.m_id), m_isActive(other.m_isActive)
+        : m_owner(other.m_owner), m_cloneFunc(other.m_cloneFunc), m_id(other.m_id), m_isActive(other.m_isActive)
     {
         other.m_id = 0;
     }
@@ -21,6 +21,7 @@ namespace LibGL
             return *this;
 
         m_owner = other.m_owner;
+        m_cloneFunc = other.m_cloneFunc;
         m_isActive = other.m_isActive;
         m_id = s_currentId++;
 
@@ -33,6 +34,7 @@ namespace LibGL
             return *this;
 
         m_owner = other.m_owner;
+        m_cloneFunc = other.m_cloneFunc;
         m_isActive = other.m_isActive;
         m_id = other.m_id;
 
@@ -68,6 +70,7 @@ namespace LibGL
             return;
 
         m_isActive = active;
+        m_owner->updateEnabledComponent(*this);
 
         m_isActive ? onEnable() : onDisable();
     }
@@ -1,32 +1,65 @@
 #include "Entity.h"
 
+#include "ArchetypeStorage.h"
+#include "SceneSerializer.h"
+#include "SystemScheduler.h"
+#include "Debug/Log.h"
+#include "Utility/ServiceLocator.h"
+
+#include <algorithm>
+
 namespace LibGL
 {
+    REGISTER_ENTITY_TYPE(Entity);
+
     Entity::Entity(Entity* parent, const Transform& transform)
-        : Node(parent), Transform(transform), m_isActive(true), m_isDestroyed(false)
+        : Node(parent), Transform(transform), m_isActive(true),
+        m_isActiveInHierarchy(parent == nullptr || parent->isActive()), m_isDestroyed(false)
     {
     }
 
     Entity::Entity(const Entity& other)
-        : Node(other), Transform(other), m_components(other.m_components), m_isActive(other.m_isActive), m_isDestroyed(false)
+        : Node(other), Transform(other), m_isActive(other.m_isActive), m_isActiveInHierarchy(other.m_isActive),
+        m_isDestroyed(false)
     {
-        if (!m_components.empty())
-            for (const auto& component : m_components)
-                component->m_owner = this;
+        // The copy isn't attached to the copied entity's parent
+        setParent(nullptr, false);
+
+        copyComponents(other);
+
+        for (const ConstNodePtr& child : other.getChildren())
+            attachChild(reinterpret_cast<const Entity&>(*child).clone());
     }
 
     Entity::Entity(Entity&& other) noexcept
         : Node(std::forward<Node&&>(other)), Transform(std::forward<Transform&&>(other)),
-        m_components(std::move(other.m_components)), m_isActive(other.m_isActive), m_isDestroyed(false)
+        m_components(std::move(other.m_components)), m_enabledComponents(std::move(other.m_enabledComponents)),
+        m_isActive(other.m_isActive), m_isActiveInHierarchy(other.m_isActiveInHierarchy), m_isDestroyed(false)
     {
         if (!m_components.empty())
             for (const auto& component : m_components)
                 component->m_owner = this;
+
+        // The new entity takes the moved one's place in the handles and the queries
+        std::swap(m_handle, other.m_handle);
+        *m_handle = this;
+        *other.m_handle = &other;
+
+        if (ArchetypeStorage* storage = LGL_TRY_SERVICE(ArchetypeStorage); storage && storage->contains(other))
+        {
+            storage->remove(other);
+            storage->update(*this);
+        }
     }
 
     Entity::~Entity()
     {
         m_isDestroyed = true;
+        m_isActiveInHierarchy = false;
+        *m_handle = nullptr;
+
+        if (ArchetypeStorage* storage = LGL_TRY_SERVICE(ArchetypeStorage))
+            storage->remove(*this);
 
         if (!m_components.empty())
             m_components.clear();
@@ -42,19 +75,19 @@ namespace LibGL
         if (&other == this)
             return *this;
 
+        Transform* parent = Transform::getParent();
+
         Node::operator=(other);
         Transform::operator=(other);
+        setParent(parent, false);
 
-        m_components.clear();
-
-        m_components = other.m_components;
-
-        if (!m_components.empty())
-            for (const auto& component : m_components)
-                component->m_owner = this;
+        copyComponents(other);
 
         m_isActive = other.m_isActive;
 
+        updateActiveInHierarchy(isParentActive());
+        updateArchetype();
+
         return *this;
     }
 
@@ -76,21 +109,31 @@ namespace LibGL
 
         m_isActive = other.m_isActive;
 
+        updateEnabledComponents();
+        updateActiveInHierarchy(isParentActive());
+
+        // The entity takes the moved one's place in the handles and the queries
+        std::swap(m_handle, other.m_handle);
+        *m_handle = this;
+        *other.m_handle = &other;
+
+        if (ArchetypeStorage* storage = LGL_TRY_SERVICE(ArchetypeStorage); storage && storage->contains(other))
+        {
+            storage->remove(other);
+            storage->update(*this);
+        }
+        else
+        {
+            updateArchetype();
+        }
+
         return *this;
     }
 
 
     void Entity::removeComponent(const Component& component)
     {
-        if (m_components.empty())
-            return;
-
-        const auto findFunc = [component](const ComponentPtr& ptr)
-        {
-            return *ptr == component;
-        };
-
-        std::erase_if(m_components, findFunc);
+        removeComponent(component.getId());
     }
 
     void Entity::removeComponent(const Component::ComponentId id)
@@ -103,7 +146,26 @@ namespace LibGL
             return ptr->getId() == id;
         };
 
-        std::erase_if(m_components, findFunc);
+        const auto componentIter = std::ranges::find_if(m_components, findFunc);
+
+        if (componentIter == m_components.end())
+            return;
+
+        // Keep the component alive until the list is consistent since its destructor calls back into the entity
+        const ComponentPtr removedComponent = std::move(*componentIter);
+        m_components.erase(componentIter);
+
+        if (m_isUpdatingComponents)
+        {
+            std::ranges::replace(m_enabledComponents, removedComponent.get(), nullptr);
+            m_hasStaleEnabledComponents = true;
+        }
+        else
+        {
+            std::erase(m_enabledComponents, removedComponent.get());
+        }
+
+        updateArchetype();
     }
 
     void Entity::update()
@@ -111,34 +173,187 @@ namespace LibGL
         if (!isActive())
             return;
 
-        for (const auto& component : m_components)
+        // The components enabled, disabled or removed by an update only change the list once the loop is done
+        m_isUpdatingComponents = true;
+
+        for (Component* component : m_enabledComponents)
         {
-            if (component->isActive())
+            if (component == nullptr || !component->m_isActive)
+                continue;
+
+            // Components updated by a system are skipped to avoid updating them twice
+            if (s_batchScheduler == nullptr || !s_batchScheduler->isBatched(*component))
                 component->update();
         }
 
+        m_isUpdatingComponents = false;
+
+        if (m_hasStaleEnabledComponents)
+        {
+            m_hasStaleEnabledComponents = false;
+            updateEnabledComponents();
+        }
+
         for (NodePtr& child : getChildren())
             reinterpret_cast<Entity&>(*child).update();
     }
 
+    std::shared_ptr<Entity> Entity::clone() const
+    {
+        return std::make_shared<Entity>(*this);
+    }
+
+    void Entity::serialize([[maybe_unused]] Resources::SceneWriter& writer) const
+    {
+    }
+
+    std::shared_ptr<Entity> Entity::deserialize([[maybe_unused]] Resources::SceneReader& reader)
+    {
+        return std::make_shared<Entity>(nullptr, Transform());
+    }
+
     bool Entity::isActive() const
     {
-        const auto* parent = reinterpret_cast<const Entity*>(Node::getParent());
-        return !m_isDestroyed && m_isActive && (parent == nullptr || parent->isActive());
+        return m_isActiveInHierarchy;
     }
 
     void Entity::setActive(const bool active)
     {
         m_isActive = active;
+        updateActiveInHierarchy(isParentActive());
+    }
+
+    Entity::Handle Entity::getHandle() const
+    {
+        return m_handle;
     }
 
     void Entity::onChildAdded(Node& child)
     {
-        reinterpret_cast<Entity&>(child).setParent(this, false);
+        Entity& childEntity = reinterpret_cast<Entity&>(child);
+        childEntity.setParent(this, false);
+        childEntity.updateActiveInHierarchy(m_isActiveInHierarchy);
+
+        // Only the entities attached to a tracked hierarchy are stored in the archetypes
+        if (ArchetypeStorage* storage = LGL_TRY_SERVICE(ArchetypeStorage); storage && storage->contains(*this))
+            storage->updateHierarchy(childEntity);
     }
 
     void Entity::onRemoveChild(Node& child)
     {
-        reinterpret_cast<Entity&>(child).setParent(nullptr, false);
+        Entity& childEntity = reinterpret_cast<Entity&>(child);
+        childEntity.setParent(nullptr, false);
+        childEntity.updateActiveInHierarchy(true);
+    }
+
+    void Entity::onChange()
+    {
+        Transform::onChange();
+        notifyTransformChange();
+    }
+
+    bool Entity::isParentActive() const
+    {
+        const auto* parent = reinterpret_cast<const Entity*>(Node::getParent());
+        return parent == nullptr || parent->isActive();
+    }
+
+    void Entity::updateActiveInHierarchy(const bool isParentActive)
+    {
+        const bool isActive = !m_isDestroyed && m_isActive && isParentActive;
+
+        if (isActive == m_isActiveInHierarchy)
+            return;
+
+        m_isActiveInHierarchy = isActive;
+
+        for (NodePtr& child : getChildren())
+            reinterpret_cast<Entity&>(*child).updateActiveInHierarchy(isActive);
+    }
+
+    void Entity::updateEnabledComponents()
+    {
+        m_enabledComponents.clear();
+
+        for (const auto& component : m_components)
+        {
+            if (component->m_isActive)
+                m_enabledComponents.push_back(component.get());
+        }
+    }
+
+    void Entity::updateEnabledComponent(Component& component)
+    {
+        if (m_isUpdatingComponents)
+        {
+            m_hasStaleEnabledComponents = true;
+            return;
+        }
+
+        if (!component.m_isActive)
+        {
+            std::erase(m_enabledComponents, &component);
+            return;
+        }
+
+        if (std::ranges::find(m_enabledComponents, &component) != m_enabledComponents.end())
+            return;
+
+        // The enabled components are a subsequence of the components - insert it after its enabled predecessors
+        auto enabledIter = m_enabledComponents.begin();
+
+        for (const auto& other : m_components)
+        {
+            if (other.get() == &component)
+                break;
+
+            if (enabledIter != m_enabledComponents.end() && *enabledIter == other.get())
+                ++enabledIter;
+        }
+
+        m_enabledComponents.insert(enabledIter, &component);
+    }
+
+    void Entity::notifyTransformChange()
+    {
+        for (const auto& component : m_components)
+            component->onTransformChange();
+
+        for (NodePtr& child : getChildren())
+            reinterpret_cast<Entity&>(*child).notifyTransformChange();
+    }
+
+    void Entity::updateArchetype()
+    {
+        if (m_isDestroyed)
+            return;
+
+        if (ArchetypeStorage* storage = LGL_TRY_SERVICE(ArchetypeStorage); storage && storage->contains(*this))
+            storage->update(*this);
+    }
+
+    void Entity::copyComponents(const Entity& other)
+    {
+        // Keep the previous components alive until the list is consistent
+        // since their destructor calls back into the entity
+        ComponentList previousComponents;
+        previousComponents.swap(m_components);
+
+        m_components.reserve(other.m_components.size());
+
+        for (const auto& component : other.m_components)
+        {
+            ComponentPtr copy = component->m_cloneFunc != nullptr ? component->m_cloneFunc(*component, *this) : nullptr;
+
+            if (copy == nullptr)
+            {
+                DEBUG_LOG("Component of type \"%s\" isn't copyable - Skipping it\n", typeid(*component).name());
+                continue;
+            }
+
+            m_components.push_back(std::move(copy));
+        }
+
+        updateEnabledComponents();
     }
 }
@@ -0,0 +1,158 @@
+#include "EntityCommandBuffer.h"
+
+#include "Entity.h"
+#include "Scene.h"
+
+#include <algorithm>
+#include <unordered_set>
+#include <utility>
+
+namespace LibGL
+{
+    EntityCommandBuffer& EntityCommandBuffer::getLocal()
+    {
+        thread_local EntityCommandBuffer* localBuffer = nullptr;
+
+        if (localBuffer == nullptr)
+        {
+            std::lock_guard lock(s_buffersMutex);
+            localBuffer = s_buffers.emplace_back(std::make_unique<EntityCommandBuffer>()).get();
+        }
+
+        return *localBuffer;
+    }
+
+    void EntityCommandBuffer::playbackAll(Resources::Scene& scene)
+    {
+        // Make sure the calling thread has a buffer so the commands it records during the playback are applied too
+        getLocal();
+
+        std::vector<EntityCommandBuffer*> buffers;
+
+        // Commands recorded during the playback are applied in the same sync point,
+        // including the ones recorded by buffers created during the playback
+        const auto hasCommands = [&buffers]
+        {
+            buffers.clear();
+
+            std::lock_guard lock(s_buffersMutex);
+
+            for (const auto& buffer : s_buffers)
+                buffers.push_back(buffer.get());
+
+            return std::ranges::any_of(buffers, [](const EntityCommandBuffer* buffer)
+            {
+                return !buffer->isEmpty();
+            });
+        };
+
+        while (hasCommands())
+        {
+            for (EntityCommandBuffer* buffer : buffers)
+            {
+                std::vector<Command> commands = std::move(buffer->m_commands);
+                buffer->m_commands.clear();
+
+                for (Command& command : commands)
+                    command(scene);
+            }
+
+            // Destructions are applied last so the other commands never refer to a destroyed entity
+            std::vector<Entity*> destroyedEntities;
+            std::unordered_set<const Entity*> destroyedSet;
+
+            for (EntityCommandBuffer* buffer : buffers)
+            {
+                for (const Entity::Handle& handle : buffer->m_destroyedEntities)
+                {
+                    if (Entity* entity = *handle; entity != nullptr && destroyedSet.insert(entity).second)
+                        destroyedEntities.push_back(entity);
+                }
+
+                buffer->m_destroyedEntities.clear();
+            }
+
+            // Destroying an entity destroys its children so skip the ones with a destroyed ancestor
+            const auto isAncestorDestroyed = [&destroyedSet](const Entity* entity)
+            {
+                for (const DataStructure::Node* parent = entity->Node::getParent(); parent != nullptr;
+                     parent = parent->getParent())
+                {
+                    if (destroyedSet.contains(reinterpret_cast<const Entity*>(parent)))
+                        return true;
+                }
+
+                return false;
+            };
+
+            std::erase_if(destroyedEntities, isAncestorDestroyed);
+
+            for (Entity* entity : destroyedEntities)
+            {
+                if (DataStructure::Node* parent = entity->Node::getParent())
+                    parent->removeChild(*entity);
+                else
+                    scene.removeNode(*entity);
+            }
+        }
+    }
+
+    void EntityCommandBuffer::destroy(Entity& entity)
+    {
+        m_destroyedEntities.push_back(entity.getHandle());
+    }
+
+    void EntityCommandBuffer::removeComponent(Entity& entity, const Component::ComponentId id)
+    {
+        m_commands.emplace_back([handle = entity.getHandle(), id](Resources::Scene&)
+        {
+            if (Entity* target = *handle)
+                target->removeComponent(id);
+        });
+    }
+
+    void EntityCommandBuffer::setParent(Entity& entity, Entity* parent)
+    {
+        Entity::Handle parentHandle = parent != nullptr ? parent->getHandle() : nullptr;
+
+        m_commands.emplace_back([handle = entity.getHandle(), parentHandle = std::move(parentHandle)]
+            (Resources::Scene& scene)
+        {
+            Entity* target = *handle;
+            Entity* newParent = parentHandle != nullptr ? *parentHandle : nullptr;
+
+            // Skip the command if the entity or its new parent were destroyed since it was recorded
+            if (target == nullptr || (parentHandle != nullptr && newParent == nullptr))
+                return;
+
+            // Moving an entity under one of its descendants would create a cycle
+            for (const DataStructure::Node* node = newParent; node != nullptr; node = node->getParent())
+            {
+                if (node == target)
+                    return;
+            }
+
+            DataStructure::Node* oldParent = target->Node::getParent();
+
+            if (oldParent == newParent)
+                return;
+
+            const std::shared_ptr<Entity> entityPtr = oldParent != nullptr
+                ? std::static_pointer_cast<Entity>(oldParent->detachChild(*target))
+                : scene.detachNode(*target);
+
+            if (entityPtr == nullptr)
+                return;
+
+            if (newParent != nullptr)
+                newParent->attachChild(entityPtr);
+            else
+                scene.attachNode(entityPtr);
+        });
+    }
+
+    bool EntityCommandBuffer::isEmpty() const
+    {
+        return m_commands.empty() && m_destroyedEntities.empty();
+    }
+}
@@ -0,0 +1,40 @@
+#include "ISystem.h"
+
+#include <algorithm>
+
+namespace LibGL
+{
+    const std::vector<ISystem::TypeId>& ISystem::getReads() const
+    {
+        return m_reads;
+    }
+
+    const std::vector<ISystem::TypeId>& ISystem::getWrites() const
+    {
+        return m_writes;
+    }
+
+    const std::vector<ISystem::TypeId>& ISystem::getBatchedTypes() const
+    {
+        return m_batchedTypes;
+    }
+
+    bool ISystem::conflictsWith(const ISystem& other) const
+    {
+        const auto isWrittenBy = [](const TypeId type, const ISystem& system)
+        {
+            return std::ranges::find(system.m_writes, type) != system.m_writes.end();
+        };
+
+        for (const TypeId type : m_writes)
+        {
+            if (isWrittenBy(type, other) || std::ranges::find(other.m_reads, type) != other.m_reads.end())
+                return true;
+        }
+
+        return std::ranges::any_of(m_reads, [&other, &isWrittenBy](const TypeId type)
+        {
+            return isWrittenBy(type, other);
+        });
+    }
+}
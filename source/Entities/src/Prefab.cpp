@@ -0,0 +1,111 @@
+#include "Prefab.h"
+
+#include "Scene.h"
+#include "SceneSerializer.h"
+
+#include "Debug/Assertion.h"
+#include "Debug/Log.h"
+
+namespace LibGL::Resources
+{
+    REGISTER_RESOURCE_TYPE(Prefab);
+
+    Prefab::Prefab(const Entity& source)
+    {
+        setTemplate(source.clone());
+        m_isActive = source.isActive();
+    }
+
+    bool Prefab::load(const char* fileName)
+    {
+        std::vector<std::shared_ptr<Entity>> roots;
+
+        if (!SceneSerializer::load(roots, fileName))
+            return false;
+
+        if (roots.size() != 1)
+        {
+            DEBUG_LOG("Prefab file \"%s\" must contain a single root entity\n", fileName);
+            return false;
+        }
+
+        m_isActive = roots[0]->isActive();
+        setTemplate(std::move(roots[0]));
+
+        return true;
+    }
+
+    bool Prefab::save(const std::string& fileName) const
+    {
+        if (!isValid())
+            return false;
+
+        // The template itself is always inactive so an active copy is saved instead if needed
+        const std::shared_ptr<Entity> root = m_template->clone();
+        root->setActive(m_isActive);
+
+        return SceneSerializer::save({ root }, fileName);
+    }
+
+    bool Prefab::isValid() const
+    {
+        return m_template != nullptr;
+    }
+
+    Entity& Prefab::instantiate(Scene& scene, const LibMath::Transform& transform) const
+    {
+        const std::shared_ptr<Entity> instance = createInstance(transform);
+        scene.attachNode(instance);
+
+        return *instance;
+    }
+
+    Entity& Prefab::instantiate(Entity& parent, const LibMath::Transform& transform) const
+    {
+        const std::shared_ptr<Entity> instance = createInstance(transform);
+        parent.attachChild(instance);
+
+        return *instance;
+    }
+
+    std::vector<Entity*> Prefab::instantiate(Scene& scene, const std::span<const LibMath::Transform> transforms) const
+    {
+        std::vector<std::shared_ptr<Entity>> instances;
+        instances.reserve(transforms.size());
+
+        for (const LibMath::Transform& transform : transforms)
+            instances.push_back(createInstance(transform));
+
+        scene.attachNodes(instances);
+
+        std::vector<Entity*> result;
+        result.reserve(instances.size());
+
+        for (const auto& instance : instances)
+            result.push_back(instance.get());
+
+        return result;
+    }
+
+    void Prefab::setTemplate(std::shared_ptr<Entity> entity)
+    {
+        m_template = std::move(entity);
+
+        // The template is kept inactive to exclude its components from the world (e.g. colliders)
+        m_template->setActive(false);
+    }
+
+    std::shared_ptr<Entity> Prefab::createInstance(const LibMath::Transform& transform) const
+    {
+        ASSERT(isValid(), "Unable to instantiate an empty prefab");
+
+        std::shared_ptr<Entity> instance = m_template->clone();
+
+        instance->setPosition(transform.getPosition());
+        instance->setRotation(transform.getRotation());
+        instance->setScale(transform.getScale());
+        instance->setActive(m_isActive);
+
+        return instance;
+    }
+}
@@ -1,10 +1,51 @@
 #include "Scene.h"
 
+#include "ArchetypeStorage.h"
+#include "EntityCommandBuffer.h"
+#include "SystemScheduler.h"
+#include "Utility/ServiceLocator.h"
+
 namespace LibGL::Resources
 {
     void Scene::update()
     {
+        SystemScheduler* scheduler = LGL_TRY_SERVICE(SystemScheduler);
+
+        // Systems only run when a storage is provided so components are never skipped otherwise.
+        // The scheduler is resolved once here rather than by each entity
+        Entity::s_batchScheduler = LGL_TRY_SERVICE(ArchetypeStorage) != nullptr ? scheduler : nullptr;
+
         for (const auto& node : getNodes())
             node->update();
+
+        Entity::s_batchScheduler = nullptr;
+
+        if (scheduler != nullptr)
+            scheduler->update();
+
+        EntityCommandBuffer::playbackAll(*this);
+    }
+
+    void Scene::attachNode(const std::shared_ptr<Entity>& node)
+    {
+        Graph::attachNode(node);
+        onNodeAdded(*node);
+    }
+
+    void Scene::attachNodes(const std::vector<std::shared_ptr<Entity>>& nodes)
+    {
+        reserve(getNodeCount() + nodes.size());
+
+        for (const auto& node : nodes)
+        {
+            Graph::attachNode(node);
+            onNodeAdded(*node);
+        }
+    }
+
+    void Scene::onNodeAdded(Entity& node)
+    {
+        if (ArchetypeStorage* storage = LGL_TRY_SERVICE(ArchetypeStorage))
+            storage->updateHierarchy(node);
     }
 }
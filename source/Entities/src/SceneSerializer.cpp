@@ -0,0 +1,357 @@
+#include "SceneSerializer.h"
+
+#include "Scene.h"
+
+#include "Debug/Log.h"
+#include "Resources/ResourceManager.h"
+#include "Utility/MappedFile.h"
+#include "Utility/ServiceLocator.h"
+#include "Utility/ThreadPool.h"
+
+#include <future>
+
+using namespace LibMath;
+using namespace LibGL::Utility;
+
+namespace LibGL::Resources
+{
+    void SceneWriter::writeResource(const IResource* resource)
+    {
+        if (resource == nullptr)
+        {
+            write<uint64_t>(0);
+            return;
+        }
+
+        std::string path = LGL_SERVICE(ResourceManager).getPath(*resource);
+        std::string type = IResource::getTypeName(*resource);
+
+        if (path.empty() || type.empty())
+        {
+            DEBUG_LOG("Unable to reference resource - It is either unmanaged or of an unregistered type\n");
+            write<uint64_t>(0);
+            return;
+        }
+
+        const uint64_t hash = hashString(path);
+
+        write(hash);
+        m_resources.try_emplace(hash, SceneResource{ std::move(type), std::move(path) });
+    }
+
+    bool SceneSerializer::save(const Scene& scene, const std::string& fileName)
+    {
+        return save(scene.getNodes(), fileName);
+    }
+
+    bool SceneSerializer::save(const std::vector<std::shared_ptr<const Entity>>& roots, const std::string& fileName)
+    {
+        // Write the entities first to know which resources should be in the table
+        SceneWriter entitiesWriter;
+
+        entitiesWriter.write(static_cast<uint32_t>(roots.size()));
+
+        for (const auto& root : roots)
+            saveEntity(*root, entitiesWriter);
+
+        BinaryWriter fileWriter;
+        fileWriter.write(MAGIC);
+        fileWriter.write(VERSION);
+
+        fileWriter.write(static_cast<uint32_t>(entitiesWriter.m_resources.size()));
+
+        for (const auto& [hash, entry] : entitiesWriter.m_resources)
+        {
+            fileWriter.write(hash);
+            fileWriter.writeString(entry.m_type);
+            fileWriter.writeString(entry.m_path);
+        }
+
+        fileWriter.writeBytes(entitiesWriter.getData().data(), entitiesWriter.getSize());
+
+        return fileWriter.saveToFile(fileName);
+    }
+
+    bool SceneSerializer::load(Scene& scene, const std::string& fileName)
+    {
+        std::vector<std::shared_ptr<Entity>> roots;
+
+        // Only add the entities once the whole file was read to leave the scene untouched on failure
+        if (!load(roots, fileName))
+            return false;
+
+        scene.attachNodes(roots);
+        return true;
+    }
+
+    bool SceneSerializer::load(std::vector<std::shared_ptr<Entity>>& roots, const std::string& fileName)
+    {
+        const MappedFile file(fileName);
+
+        if (!file.isValid())
+        {
+            DEBUG_LOG("Unable to open scene file \"%s\"\n", fileName.c_str());
+            return false;
+        }
+
+        SceneReader reader(file.getData(), file.getSize());
+        uint32_t    rootCount;
+
+        if (!beginLoad(reader, rootCount))
+        {
+            DEBUG_LOG("Invalid scene file \"%s\"\n", fileName.c_str());
+            return false;
+        }
+
+        std::vector<std::shared_ptr<Entity>> loadedRoots;
+        loadedRoots.reserve(std::min<size_t>(rootCount, reader.getRemaining()));
+
+        for (uint32_t i = 0; i < rootCount; ++i)
+        {
+            std::shared_ptr<Entity> entity = loadEntity(reader);
+
+            if (entity == nullptr)
+            {
+                DEBUG_LOG("Invalid scene file \"%s\"\n", fileName.c_str());
+                return false;
+            }
+
+            loadedRoots.push_back(std::move(entity));
+        }
+
+        roots.insert(roots.end(), loadedRoots.begin(), loadedRoots.end());
+        return true;
+    }
+
+    bool SceneSerializer::readResourceTable(const std::string& fileName, std::vector<SceneResource>& resources)
+    {
+        const MappedFile file(fileName);
+
+        if (!file.isValid())
+            return false;
+
+        return readResourceTable({ file.getData(), file.getSize() }, resources);
+    }
+
+    bool SceneSerializer::readResourceTable(const std::span<const uint8_t> data, std::vector<SceneResource>& resources)
+    {
+        SceneReader reader(data.data(), data.size());
+
+        if (!readHeader(reader))
+            return false;
+
+        const uint32_t resourceCount = reader.read<uint32_t>();
+
+        for (uint32_t i = 0; i < resourceCount && reader.isValid(); ++i)
+        {
+            reader.skip(sizeof(uint64_t));
+
+            SceneResource resource;
+            resource.m_type = reader.readString();
+            resource.m_path = reader.readString();
+
+            if (reader.isValid())
+                resources.push_back(std::move(resource));
+        }
+
+        return reader.isValid();
+    }
+
+    bool SceneSerializer::beginLoad(SceneReader& reader, uint32_t& rootCount)
+    {
+        if (!readHeader(reader) || !loadResources(reader))
+            return false;
+
+        rootCount = reader.read<uint32_t>();
+        return reader.isValid();
+    }
+
+    bool SceneSerializer::readHeader(SceneReader& reader)
+    {
+        return reader.read<uint32_t>() == MAGIC && reader.read<uint32_t>() == VERSION;
+    }
+
+    void SceneSerializer::saveEntity(const Entity& entity, SceneWriter& writer)
+    {
+        const auto typeIt = s_typeIds.find(typeid(entity).hash_code());
+        const auto entityTypeIt = typeIt != s_typeIds.end() ? s_entityTypes.find(typeIt->second) : s_entityTypes.end();
+
+        if (entityTypeIt == s_entityTypes.end())
+        {
+            DEBUG_LOG("Unregistered entity type \"%s\" - Saving it as a base entity\n", typeid(entity).name());
+            writer.write(hashString("Entity"));
+        }
+        else
+        {
+            writer.write(entityTypeIt->first);
+        }
+
+        writer.write(entity.getPosition());
+        writer.write(entity.getRotation());
+        writer.write(entity.getScale());
+        writer.write(static_cast<uint8_t>(entity.m_isActive));
+
+        // Prefix the type specific data with its size to allow skipping unknown types
+        size_t sizeOffset = writer.getSize();
+        writer.write<uint32_t>(0);
+
+        if (entityTypeIt != s_entityTypes.end())
+            entityTypeIt->second.m_save(entity, writer);
+
+        writer.writeAt(sizeOffset, static_cast<uint32_t>(writer.getSize() - sizeOffset - sizeof(uint32_t)));
+
+        sizeOffset = writer.getSize();
+        writer.write<uint32_t>(0);
+
+        uint32_t componentCount = 0;
+
+        for (const auto& component : entity.m_components)
+        {
+            const auto componentTypeIt = s_typeIds.find(typeid(*component).hash_code());
+
+            if (componentTypeIt == s_typeIds.end() || !s_componentTypes.contains(componentTypeIt->second))
+            {
+                DEBUG_LOG("Unregistered component type \"%s\" - Skipping it\n", typeid(*component).name());
+                continue;
+            }
+
+            writer.write(componentTypeIt->second);
+            writer.write(static_cast<uint8_t>(component->m_isActive));
+
+            const size_t componentSizeOffset = writer.getSize();
+            writer.write<uint32_t>(0);
+
+            s_componentTypes[componentTypeIt->second].m_save(*component, writer);
+
+            writer.writeAt(componentSizeOffset,
+                static_cast<uint32_t>(writer.getSize() - componentSizeOffset - sizeof(uint32_t)));
+
+            ++componentCount;
+        }
+
+        writer.writeAt(sizeOffset, componentCount);
+
+        const auto children = entity.getChildren();
+        writer.write(static_cast<uint32_t>(children.size()));
+
+        for (const auto& child : children)
+            saveEntity(reinterpret_cast<const Entity&>(*child), writer);
+    }
+
+    std::shared_ptr<Entity> SceneSerializer::loadEntity(SceneReader& reader)
+    {
+        const TypeId     typeId = reader.read<TypeId>();
+        const Vector3    position = reader.read<Vector3>();
+        const Quaternion rotation = reader.read<Quaternion>();
+        const Vector3    scale = reader.read<Vector3>();
+        const bool       isActive = reader.read<uint8_t>() != 0;
+        const uint32_t   dataSize = reader.read<uint32_t>();
+        const size_t     dataEnd = reader.getOffset() + dataSize;
+
+        if (!reader.isValid())
+            return nullptr;
+
+        std::shared_ptr<Entity> entity;
+
+        if (const auto it = s_entityTypes.find(typeId); it != s_entityTypes.end())
+            entity = it->second.m_load(reader);
+
+        if (entity == nullptr)
+        {
+            DEBUG_LOG("Unable to load entity - Replacing it with a base entity\n");
+            entity = std::make_shared<Entity>(nullptr, Transform());
+        }
+
+        if (!endBlock(reader, dataEnd))
+            return nullptr;
+
+        entity->setPosition(position);
+        entity->setRotation(rotation);
+        entity->setScale(scale);
+
+        const uint32_t componentCount = reader.read<uint32_t>();
+
+        for (uint32_t i = 0; i < componentCount && reader.isValid(); ++i)
+        {
+            const TypeId   componentTypeId = reader.read<TypeId>();
+            const bool     isComponentActive = reader.read<uint8_t>() != 0;
+            const uint32_t componentSize = reader.read<uint32_t>();
+            const size_t   componentEnd = reader.getOffset() + componentSize;
+
+            if (const auto it = s_componentTypes.find(componentTypeId); it != s_componentTypes.end() && reader.isValid())
+                it->second.m_load(*entity, reader).setActive(isComponentActive);
+            else
+                DEBUG_LOG("Unknown component type - Skipping it\n");
+
+            if (!endBlock(reader, componentEnd))
+                return nullptr;
+        }
+
+        const uint32_t childCount = reader.read<uint32_t>();
+
+        for (uint32_t i = 0; i < childCount && reader.isValid(); ++i)
+        {
+            std::shared_ptr<Entity> child = loadEntity(reader);
+
+            if (child == nullptr)
+                return nullptr;
+
+            entity->attachChild(child);
+        }
+
+        entity->setActive(isActive);
+
+        return reader.isValid() ? entity : nullptr;
+    }
+
+    bool SceneSerializer::loadResources(SceneReader& reader)
+    {
+        ResourceManager&  resourceManager = LGL_SERVICE(ResourceManager);
+        const ThreadPool* threadPool = LGL_TRY_SERVICE(ThreadPool);
+        const uint32_t    resourceCount = reader.read<uint32_t>();
+
+        std::vector<std::pair<uint64_t, std::future<IResource*>>> pendingResources;
+
+        for (uint32_t i = 0; i < resourceCount && reader.isValid(); ++i)
+        {
+            const uint64_t    hash = reader.read<uint64_t>();
+            const std::string type(reader.readString());
+            const std::string path(reader.readString());
+
+            if (!reader.isValid())
+                break;
+
+            if (IResource* resource = resourceManager.get<IResource>(path))
+                reader.m_resources[hash] = resource;
+            else if (threadPool != nullptr)
+                pendingResources.emplace_back(hash, resourceManager.loadInBackground(type, path));
+            else
+                reader.m_resources[hash] = resourceManager.load(type, path);
+        }
+
+        // The resources are initialized on the calling thread since it can require a graphics context
+        for (auto& [hash, task] : pendingResources)
+        {
+            IResource* resource = task.get();
+
+            if (resource == nullptr || !resource->init())
+            {
+                DEBUG_LOG("Unable to load scene resource\n");
+                continue;
+            }
+
+            reader.m_resources[hash] = resource;
+        }
+
+        return reader.isValid();
+    }
+
+    bool SceneSerializer::endBlock(SceneReader& reader, const size_t blockEnd)
+    {
+        if (reader.getOffset() > blockEnd)
+            return false;
+
+        reader.skip(blockEnd - reader.getOffset());
+        return reader.isValid();
+    }
+}
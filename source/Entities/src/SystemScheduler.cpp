@@ -0,0 +1,71 @@
+#include "SystemScheduler.h"
+
+#include "ArchetypeStorage.h"
+#include "Component.h"
+
+#include "Utility/ServiceLocator.h"
+#include "Utility/ThreadPool.h"
+
+namespace LibGL
+{
+    void SystemScheduler::update()
+    {
+        ArchetypeStorage* storage = LGL_TRY_SERVICE(ArchetypeStorage);
+
+        if (storage == nullptr)
+            return;
+
+        Utility::ThreadPool* threadPool = LGL_TRY_SERVICE(Utility::ThreadPool);
+
+        for (const auto& stage : m_stages)
+        {
+            if (threadPool == nullptr || stage.size() == 1)
+            {
+                for (ISystem* system : stage)
+                    system->update(*storage);
+
+                continue;
+            }
+
+            threadPool->parallelFor(stage.size(), [&stage, storage](const size_t index)
+            {
+                stage[index]->update(*storage);
+            });
+        }
+    }
+
+    bool SystemScheduler::isBatched(const Component& component) const
+    {
+        return m_batchedTypes.contains(typeid(component).hash_code());
+    }
+
+    void SystemScheduler::buildStages()
+    {
+        m_stages.clear();
+        m_batchedTypes.clear();
+
+        for (const auto& system : m_systems)
+        {
+            // Run the system after the last stage containing a conflicting system to preserve the registration order
+            size_t stageIndex = 0;
+
+            for (size_t i = 0; i < m_stages.size(); ++i)
+            {
+                for (const ISystem* other : m_stages[i])
+                {
+                    if (system->conflictsWith(*other))
+                    {
+                        stageIndex = i + 1;
+                        break;
+                    }
+                }
+            }
+
+            if (stageIndex == m_stages.size())
+                m_stages.emplace_back();
+
+            m_stages[stageIndex].push_back(system.get());
+            m_batchedTypes.insert(system->getBatchedTypes().begin(), system->getBatchedTypes().end());
+        }
+    }
+}
@@ -0,0 +1,424 @@
+#include "WorldStreamer.h"
+
+#include "Scene.h"
+
+#include "Debug/Assertion.h"
+#include "Debug/Log.h"
+#include "Resources/ResourceManager.h"
+#include "Utility/MappedFile.h"
+#include "Utility/ServiceLocator.h"
+#include "Utility/ThreadPool.h"
+
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+
+using namespace LibMath;
+using namespace LibGL::Utility;
+
+namespace LibGL::Resources
+{
+    WorldStreamer::WorldStreamer(Scene& scene, std::string directory, const float cellSize)
+        : m_directory(std::move(directory)), m_scene(&scene), m_cellSize(cellSize), m_loadRadius(cellSize),
+        m_unloadRadius(cellSize * 1.5f)
+    {
+        ASSERT(cellSize > 0.f, "World streamer cell size must be positive");
+    }
+
+    WorldStreamer::~WorldStreamer()
+    {
+        // Resources loaded in the background are only initialized on the main thread
+        for (auto& [path, resource] : m_pendingResources)
+            initResource(path, resource.get());
+    }
+
+    void WorldStreamer::update(const Vector3& viewPosition)
+    {
+        using clock = std::chrono::steady_clock;
+
+        const clock::time_point                        start = clock::now();
+        const std::chrono::duration<float, std::milli> budget(m_frameBudget);
+        bool                                           hasWorked = false;
+
+        const auto isOverBudget = [&]
+        {
+            return hasWorked && clock::now() - start >= budget;
+        };
+
+        const float unloadRadiusSqr = m_unloadRadius * m_unloadRadius;
+
+        for (auto it = m_cells.begin(); it != m_cells.end();)
+        {
+            Cell& cell = it->second;
+            cell.m_distanceSqr = getDistanceSqr(it->first, viewPosition);
+
+            if (cell.m_distanceSqr <= unloadRadiusSqr)
+            {
+                ++it;
+                continue;
+            }
+
+            // Pending cells are simply dropped while the ones with entities must remove them from the scene
+            if (!cell.m_roots.empty())
+            {
+                if (isOverBudget())
+                {
+                    ++it;
+                    continue;
+                }
+
+                unloadCell(cell);
+                hasWorked = true;
+            }
+
+            it = m_cells.erase(it);
+        }
+
+        for (auto it = m_pendingResources.begin(); it != m_pendingResources.end() && !isOverBudget();)
+        {
+            if (it->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            {
+                ++it;
+                continue;
+            }
+
+            initResource(it->first, it->second.get());
+            hasWorked = true;
+
+            it = m_pendingResources.erase(it);
+        }
+
+        requestCells(viewPosition);
+
+        std::vector<CellMap::value_type*> cells;
+        cells.reserve(m_cells.size());
+
+        for (auto& entry : m_cells)
+        {
+            if (entry.second.m_state != ECellState::LOADED)
+                cells.push_back(&entry);
+        }
+
+        const auto getDistance = [](const CellMap::value_type* entry)
+        {
+            return entry->second.m_distanceSqr;
+        };
+
+        std::ranges::sort(cells, {}, getDistance);
+
+        // A cell keeps advancing until it is waiting for its data, so a large cell is spread over several frames
+        for (CellMap::value_type* entry : cells)
+        {
+            while (!isOverBudget() && advanceCell(entry->first, entry->second))
+                hasWorked = true;
+
+            if (isOverBudget())
+                break;
+        }
+    }
+
+    void WorldStreamer::unloadAll()
+    {
+        for (auto& [coord, cell] : m_cells)
+            unloadCell(cell);
+
+        m_cells.clear();
+    }
+
+    void WorldStreamer::setRadii(const float loadRadius, const float unloadRadius)
+    {
+        ASSERT(unloadRadius >= loadRadius, "World streamer unload radius must be at least the load radius");
+
+        m_loadRadius = loadRadius;
+        m_unloadRadius = unloadRadius;
+    }
+
+    void WorldStreamer::setFrameBudget(const float milliseconds)
+    {
+        m_frameBudget = milliseconds;
+    }
+
+    void WorldStreamer::setMaxPendingCells(const size_t count)
+    {
+        m_maxPendingCells = count;
+    }
+
+    WorldStreamer::CellCoord WorldStreamer::getCell(const Vector3& position) const
+    {
+        return getCell(position, m_cellSize);
+    }
+
+    std::string WorldStreamer::getCellPath(const CellCoord cell) const
+    {
+        return getCellPath(m_directory, cell);
+    }
+
+    bool WorldStreamer::isCellLoaded(const CellCoord cell) const
+    {
+        const auto it = m_cells.find(cell);
+        return it != m_cells.end() && it->second.m_state == ECellState::LOADED;
+    }
+
+    size_t WorldStreamer::getLoadedCellCount() const
+    {
+        const auto isLoaded = [](const CellMap::value_type& entry)
+        {
+            return entry.second.m_state == ECellState::LOADED;
+        };
+
+        return static_cast<size_t>(std::ranges::count_if(m_cells, isLoaded));
+    }
+
+    bool WorldStreamer::partition(const Scene& scene, const std::string& directory, const float cellSize)
+    {
+        ASSERT(cellSize > 0.f, "World streamer cell size must be positive");
+
+        std::unordered_map<CellCoord, std::vector<std::shared_ptr<const Entity>>, CellHash> cells;
+
+        for (const auto& node : scene.getNodes())
+            cells[getCell(node->getWorldPosition(), cellSize)].push_back(node);
+
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+
+        bool success = true;
+
+        for (const auto& [coord, roots] : cells)
+            success = SceneSerializer::save(roots, getCellPath(directory, coord)) && success;
+
+        return success;
+    }
+
+    size_t WorldStreamer::CellHash::operator()(const CellCoord& cell) const
+    {
+        const uint64_t x = static_cast<uint32_t>(cell.m_x);
+        const uint64_t z = static_cast<uint32_t>(cell.m_z);
+
+        return std::hash<uint64_t>{}(x << 32 | z);
+    }
+
+    void WorldStreamer::requestCells(const Vector3& viewPosition)
+    {
+        const auto isPending = [](const CellMap::value_type& entry)
+        {
+            return entry.second.m_state != ECellState::LOADED;
+        };
+
+        size_t pendingCount = static_cast<size_t>(std::ranges::count_if(m_cells, isPending));
+
+        if (pendingCount >= m_maxPendingCells)
+            return;
+
+        const CellCoord center = getCell(viewPosition);
+        const int32_t   range = static_cast<int32_t>(std::ceil(m_loadRadius / m_cellSize));
+        const float     loadRadiusSqr = m_loadRadius * m_loadRadius;
+
+        std::vector<std::pair<float, CellCoord>> candidates;
+
+        for (int32_t z = center.m_z - range; z <= center.m_z + range; ++z)
+        {
+            for (int32_t x = center.m_x - range; x <= center.m_x + range; ++x)
+            {
+                const CellCoord coord{ x, z };
+                const float     distanceSqr = getDistanceSqr(coord, viewPosition);
+
+                if (distanceSqr <= loadRadiusSqr && !m_cells.contains(coord))
+                    candidates.emplace_back(distanceSqr, coord);
+            }
+        }
+
+        std::ranges::sort(candidates, {}, &std::pair<float, CellCoord>::first);
+
+        for (const auto& [distanceSqr, coord] : candidates)
+        {
+            if (pendingCount++ >= m_maxPendingCells)
+                break;
+
+            requestCell(coord);
+            m_cells[coord].m_distanceSqr = distanceSqr;
+        }
+    }
+
+    void WorldStreamer::requestCell(const CellCoord coord)
+    {
+        auto readFile = [path = getCellPath(coord)]() -> std::optional<CellFile>
+        {
+            const MappedFile file(path);
+
+            if (!file.isValid())
+                return std::nullopt;
+
+            // The file is copied to read it from the disk here rather than when the entities are created
+            CellFile cellFile{ { file.getData(), file.getData() + file.getSize() }, {} };
+
+            if (!SceneSerializer::readResourceTable(cellFile.m_data, cellFile.m_resources))
+                return std::nullopt;
+
+            return cellFile;
+        };
+
+        Cell& cell = m_cells[coord];
+
+        if (ThreadPool* threadPool = LGL_TRY_SERVICE(ThreadPool))
+        {
+            cell.m_file = threadPool->enqueue(std::move(readFile));
+        }
+        else
+        {
+            std::promise<std::optional<CellFile>> promise;
+            promise.set_value(readFile());
+            cell.m_file = promise.get_future();
+        }
+    }
+
+    void WorldStreamer::loadResources(Cell& cell, const std::vector<SceneResource>& resources)
+    {
+        ResourceManager& resourceManager = LGL_SERVICE(ResourceManager);
+        const bool       hasThreadPool = LGL_TRY_SERVICE(ThreadPool) != nullptr;
+
+        for (const SceneResource& resource : resources)
+        {
+            // Resources loaded in the background are registered before being initialized
+            if (!m_pendingResources.contains(resource.m_path))
+            {
+                if (resourceManager.get<IResource>(resource.m_path) != nullptr)
+                    continue;
+
+                if (hasThreadPool)
+                {
+                    m_pendingResources[resource.m_path] =
+                        resourceManager.loadInBackground(resource.m_type, resource.m_path).share();
+                }
+                else
+                {
+                    std::promise<IResource*> promise;
+                    promise.set_value(resourceManager.load(resource.m_type, resource.m_path, false));
+                    m_pendingResources[resource.m_path] = promise.get_future().share();
+                }
+            }
+
+            cell.m_resources.push_back(resource.m_path);
+        }
+    }
+
+    bool WorldStreamer::advanceCell(const CellCoord coord, Cell& cell)
+    {
+        if (cell.m_state == ECellState::READING_FILE)
+        {
+            if (cell.m_file.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                return false;
+
+            std::optional<CellFile> file = cell.m_file.get();
+
+            // Cells without a file are empty
+            if (!file)
+            {
+                cell.m_state = ECellState::LOADED;
+                return false;
+            }
+
+            cell.m_data = std::move(file->m_data);
+            loadResources(cell, file->m_resources);
+            cell.m_state = ECellState::LOADING_RESOURCES;
+        }
+
+        if (cell.m_state == ECellState::LOADING_RESOURCES)
+        {
+            const auto isPending = [this](const std::string& path)
+            {
+                return m_pendingResources.contains(path);
+            };
+
+            if (std::ranges::any_of(cell.m_resources, isPending))
+                return false;
+
+            cell.m_resources.clear();
+
+            // The resources are all loaded at this point so the scene's table only has to be resolved
+            SceneReader& reader = cell.m_reader.emplace(cell.m_data.data(), cell.m_data.size());
+
+            if (!SceneSerializer::beginLoad(reader, cell.m_remainingRoots))
+            {
+                DEBUG_LOG("Unable to load world cell (%d, %d)\n", coord.m_x, coord.m_z);
+                cell.m_remainingRoots = 0;
+            }
+
+            cell.m_state = ECellState::LOADING_ENTITIES;
+            return true;
+        }
+
+        if (cell.m_state != ECellState::LOADING_ENTITIES)
+            return false;
+
+        // The roots are added as soon as they are created since their components are already part of the world
+        if (cell.m_remainingRoots > 0)
+        {
+            if (std::shared_ptr<Entity> root = SceneSerializer::loadEntity(*cell.m_reader))
+            {
+                m_scene->attachNode(root);
+                cell.m_roots.push_back(root);
+                --cell.m_remainingRoots;
+            }
+            else
+            {
+                DEBUG_LOG("Unable to load world cell (%d, %d)\n", coord.m_x, coord.m_z);
+                cell.m_remainingRoots = 0;
+            }
+        }
+
+        if (cell.m_remainingRoots == 0)
+        {
+            cell.m_reader.reset();
+            cell.m_data = {};
+            cell.m_state = ECellState::LOADED;
+        }
+
+        return true;
+    }
+
+    void WorldStreamer::unloadCell(Cell& cell) const
+    {
+        for (const std::weak_ptr<Entity>& root : cell.m_roots)
+        {
+            if (const std::shared_ptr<Entity> entity = root.lock())
+                m_scene->removeNode(*entity);
+        }
+
+        cell.m_roots.clear();
+    }
+
+    float WorldStreamer::getDistanceSqr(const CellCoord coord, const Vector3& position) const
+    {
+        const float minX = static_cast<float>(coord.m_x) * m_cellSize;
+        const float minZ = static_cast<float>(coord.m_z) * m_cellSize;
+
+        const float distanceX = std::max({ minX - position.m_x, 0.f, position.m_x - (minX + m_cellSize) });
+        const float distanceZ = std::max({ minZ - position.m_z, 0.f, position.m_z - (minZ + m_cellSize) });
+
+        return distanceX * distanceX + distanceZ * distanceZ;
+    }
+
+    void WorldStreamer::initResource(const std::string& path, IResource* resource)
+    {
+        if (resource != nullptr && resource->init())
+            return;
+
+        DEBUG_LOG("Unable to load world resource \"%s\"\n", path.c_str());
+
+        if (resource != nullptr)
+            LGL_SERVICE(ResourceManager).remove(path);
+    }
+
+    WorldStreamer::CellCoord WorldStreamer::getCell(const Vector3& position, const float cellSize)
+    {
+        return {
+            static_cast<int32_t>(std::floor(position.m_x / cellSize)),
+            static_cast<int32_t>(std::floor(position.m_z / cellSize))
+        };
+    }
+
+    std::string WorldStreamer::getCellPath(const std::string& directory, const CellCoord cell)
+    {
+        return directory + "/cell_" + std::to_string(cell.m_x) + "_" + std::to_string(cell.m_z) + ".lgls";
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include "Vector/Vector3.h"
+
+namespace LibGL::Physics
+{
+    struct AABB
+    {
+        LibMath::Vector3 m_min;
+        LibMath::Vector3 m_max;
+
+        /**
+         * \brief Creates a box from its center and half size
+         * \param center The box's center
+         * \param halfSize The box's half size on each axis
+         * \return The created box
+         */
+        static AABB fromCenter(const LibMath::Vector3& center, const LibMath::Vector3& halfSize);
+
+        /**
+         * \brief Checks whether the given box overlaps the current one or not
+         * \param other The box to check against
+         * \return True if the boxes overlap. False otherwise.
+         */
+        bool overlaps(const AABB& other) const;
+
+        /**
+         * \brief Checks whether the given box is fully inside the current one or not
+         * \param other The box to check against
+         * \return True if the given box is inside the current one. False otherwise.
+         */
+        bool contains(const AABB& other) const;
+
+        /**
+         * \brief Computes the smallest box containing both the current and given boxes
+         * \param other The box to merge with
+         * \return The box containing both boxes
+         */
+        AABB merged(const AABB& other) const;
+
+        /**
+         * \brief Computes a copy of the box grown by the given margin on each side
+         * \param margin The distance to add on each side of the box
+         * \return The expanded box
+         */
+        AABB expanded(float margin) const;
+
+        /**
+         * \brief Computes a copy of the box grown by the given half size on each side
+         * \param halfSize The distance to add on each side of the box along each axis
+         * \return The expanded box
+         */
+        AABB expanded(const LibMath::Vector3& halfSize) const;
+
+        /**
+         * \brief Computes the box covering the current one moved along the given direction
+         * \param direction The normalized direction in which the box moves
+         * \param distance The distance travelled by the box. Can be infinite
+         * \return The box covering the moving box
+         */
+        AABB swept(const LibMath::Vector3& direction, float distance) const;
+
+        /**
+         * \brief Computes the box's surface area (the insertion cost used by the tree)
+         * \return The box's surface area
+         */
+        float getSurfaceArea() const;
+
+        /**
+         * \brief Checks whether the given ray segment intersects the box or not
+         * \param origin The ray's origin
+         * \param direction The ray's normalized direction
+         * \param maxDistance The length of the ray segment
+         * \param distance The distance from the origin to the entry point. 0 if the origin is inside the box
+         * \return True if the segment intersects the box. False otherwise.
+         */
+        bool raycast(const LibMath::Vector3& origin, const LibMath::Vector3& direction, float maxDistance,
+                     float&                  distance) const;
+    };
+}
@@ -0,0 +1,12 @@
+#pragma once
+#include "Vector/Vector3.h"
+
+namespace LibGL::Physics
+{
+    struct Bounds
+    {
+        LibMath::Vector3 m_center;
+        LibMath::Vector3 m_boxSize;
+        float            m_sphereRadius;
+    };
+}
@@ -15,6 +15,8 @@ namespace LibGL::Physics
     class BoxCollider final : public ICollider
     {
     public:
+        using ICollider::check;
+
         BoxCollider(Entity& owner, const LibMath::Vector3& center, const LibMath::Vector3& size);
 
         /**
@@ -33,11 +35,25 @@ namespace LibGL::Physics
         bool check(const Ray& ray, float& distanceSqr) const override;
 
         /**
-         * \brief Checks if a given collider is colliding with the box collider.
-         * \param other The collider to check collision for.
-         * \return True if the collider is colliding with the box collider. False otherwise.
+         * \brief Checks if a given world space sphere is colliding with the box collider.
+         * \param sphere The sphere to check collision for.
+         * \return True if the sphere is colliding with the box collider. False otherwise.
+         */
+        bool check(const SphereShape& sphere) const override;
+
+        /**
+         * \brief Checks if a given world space box is colliding with the box collider.
+         * \param box The box to check collision for.
+         * \return True if the box is colliding with the box collider. False otherwise.
          */
-        bool check(const ICollider& other) const override;
+        bool check(const BoxShape& box) const override;
+
+        /**
+         * \brief Checks if a given world space capsule is colliding with the box collider.
+         * \param capsule The capsule to check collision for.
+         * \return True if the capsule is colliding with the box collider. False otherwise.
+         */
+        bool check(const CapsuleShape& capsule) const override;
 
         /**
          * \brief Checks if a given box collider is colliding with the current box collider.
@@ -60,6 +76,19 @@ namespace LibGL::Physics
          */
         bool checkCapsule(const CapsuleCollider& other) const;
 
+        /**
+         * \brief Gets the box's corner furthest along the given direction
+         * \param direction The direction in which to search
+         * \return The box's support point in world space
+         */
+        LibMath::Vector3 getSupportPoint(const LibMath::Vector3& direction) const override;
+
+        /**
+         * \brief Gets the radius by which the box's core is inflated
+         * \return 0 since the box is its own core
+         */
+        float getSupportRadius() const override;
+
         /**
          * \brief Computes the closest point to the given position inside the collider
          * \param point The point of which we want the closest in-bounds point
@@ -74,6 +103,26 @@ namespace LibGL::Physics
          */
         LibMath::Vector3 getClosestPointOnSurface(const LibMath::Vector3& point) const override;
 
+        /**
+         * \brief Gets the box's axis aligned bounding box in world space
+         * \return The box's world space bounding box
+         */
+        AABB getAABB() const override;
+
+        /**
+         * \brief Writes the collider's data
+         * \param writer The scene's writer
+         */
+        void serialize(Resources::SceneWriter& writer) const;
+
+        /**
+         * \brief Adds a box collider created from the data written by serialize to the given entity
+         * \param owner The collider's owner
+         * \param reader The scene's reader
+         * \return A reference to the created collider
+         */
+        static BoxCollider& deserialize(Entity& owner, Resources::SceneReader& reader);
+
     private:
         LibMath::Vector3 m_center;
         LibMath::Vector3 m_size;
@@ -15,6 +15,8 @@ namespace LibGL::Physics
     class CapsuleCollider final : public ICollider
     {
     public:
+        using ICollider::check;
+
         CapsuleCollider(Entity& owner, const LibMath::Vector3& center, const LibMath::Vector3& upDir, float height, float radius);
 
         /**
@@ -54,12 +56,25 @@ namespace LibGL::Physics
         bool check(const Ray& ray, float& distanceSqr) const override;
 
         /**
-         * \brief Checks if a given collider is colliding with the capsule collider.
-         * \param other The collider to check collision for.
-         * \return True if the collider is colliding with the capsule collider.
-         * False otherwise.
+         * \brief Checks if a given world space sphere is colliding with the capsule collider.
+         * \param sphere The sphere to check collision for.
+         * \return True if the sphere is colliding with the capsule collider. False otherwise.
          */
-        bool check(const ICollider& other) const override;
+        bool check(const SphereShape& sphere) const override;
+
+        /**
+         * \brief Checks if a given world space box is colliding with the capsule collider.
+         * \param box The box to check collision for.
+         * \return True if the box is colliding with the capsule collider. False otherwise.
+         */
+        bool check(const BoxShape& box) const override;
+
+        /**
+         * \brief Checks if a given world space capsule is colliding with the capsule collider.
+         * \param capsule The capsule to check collision for.
+         * \return True if the capsule is colliding with the capsule collider. False otherwise.
+         */
+        bool check(const CapsuleShape& capsule) const override;
 
         /**
          * \brief Checks if a given box collider is colliding with the capsule collider.
@@ -85,6 +100,19 @@ namespace LibGL::Physics
          */
         bool checkCapsule(const CapsuleCollider& other) const;
 
+        /**
+         * \brief Gets the end of the capsule's center segment furthest along the given direction
+         * \param direction The direction in which to search
+         * \return The capsule's support point in world space
+         */
+        LibMath::Vector3 getSupportPoint(const LibMath::Vector3& direction) const override;
+
+        /**
+         * \brief Gets the radius by which the capsule's core is inflated
+         * \return The capsule's world space radius
+         */
+        float getSupportRadius() const override;
+
         /**
          * \brief Computes the closest point to the given position inside the collider
          * \param point The point of which we want the closest in-bounds point
@@ -99,6 +127,34 @@ namespace LibGL::Physics
          */
         LibMath::Vector3 getClosestPointOnSurface(const LibMath::Vector3& point) const override;
 
+        /**
+         * \brief Writes the collider's data
+         * \param writer The scene's writer
+         */
+        void serialize(Resources::SceneWriter& writer) const;
+
+        /**
+         * \brief Adds a capsule collider created from the data written by serialize to the given entity
+         * \param owner The collider's owner
+         * \param reader The scene's reader
+         * \return A reference to the created collider
+         */
+        static CapsuleCollider& deserialize(Entity& owner, Resources::SceneReader& reader);
+
+    protected:
+        /**
+         * \brief Computes the capsule's radius scaled by the owner's scale perpendicular to its up direction
+         * \param worldBounds The capsule's world space bounds
+         * \return The capsule's world space radius
+         */
+        float computeWorldRadius(const Bounds& worldBounds) const override;
+
+        /**
+         * \brief Computes the capsule's up direction in world space
+         * \return The capsule's world space up direction
+         */
+        LibMath::Vector3 computeWorldAxis() const override;
+
     private:
         LibMath::Vector3 m_center = LibMath::Vector3::zero();
         LibMath::Vector3 m_upDirection = LibMath::Vector3::up();
@@ -1,4 +1,7 @@
 #pragma once
+#include "CollisionLayers.h"
+#include "Shapes.h"
+
 #include "Vector/Vector3.h"
 
 #include <vector>
@@ -7,6 +10,33 @@ namespace LibGL::Physics
 {
     class ICollider;
 
+    /**
+     * \brief Fills the given list with all active colliders in the given layers overlapping the given box.
+     * The list is cleared first and its capacity is reused, avoiding allocations for repeated queries.
+     * \param box The box to check against
+     * \param results The list in which the overlapping colliders should be stored
+     * \param layerMask The layers of the colliders to check against
+     */
+    void overlapBox(const BoxShape& box, std::vector<ICollider*>& results, uint32_t layerMask = ALL_LAYERS);
+
+    /**
+     * \brief Fills the given list with all active colliders in the given layers overlapping the given sphere.
+     * The list is cleared first and its capacity is reused, avoiding allocations for repeated queries.
+     * \param sphere The sphere to check against
+     * \param results The list in which the overlapping colliders should be stored
+     * \param layerMask The layers of the colliders to check against
+     */
+    void overlapSphere(const SphereShape& sphere, std::vector<ICollider*>& results, uint32_t layerMask = ALL_LAYERS);
+
+    /**
+     * \brief Fills the given list with all active colliders in the given layers overlapping the given capsule.
+     * The list is cleared first and its capacity is reused, avoiding allocations for repeated queries.
+     * \param capsule The capsule to check against
+     * \param results The list in which the overlapping colliders should be stored
+     * \param layerMask The layers of the colliders to check against
+     */
+    void overlapCapsule(const CapsuleShape& capsule, std::vector<ICollider*>& results, uint32_t layerMask = ALL_LAYERS);
+
     /**
      * \brief Gets all active colliders overlapping the given box.
      * \param center The center of the box
@@ -0,0 +1,101 @@
+#pragma once
+#include "Bounds.h"
+#include "Vector/Vector3.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace LibGL::Physics
+{
+    /**
+     * \brief World space data of the loaded colliders, stored as parallel arrays indexed by the colliders' data index.
+     * Each entry is computed once after its owner's transform changed and read by the collision checks until then.
+     */
+    class ColliderWorldData
+    {
+    public:
+        /**
+         * \brief Reserves an (invalid) entry for a new collider, reusing a released one if possible
+         * \return The index of the reserved entry
+         */
+        uint32_t allocate();
+
+        /**
+         * \brief Releases the given entry so it can be reused by another collider
+         * \param index The entry to release
+         */
+        void release(uint32_t index);
+
+        /**
+         * \brief Flags the given entry as outdated
+         * \param index The entry to invalidate
+         */
+        void invalidate(uint32_t index);
+
+        /**
+         * \brief Checks whether the given entry is up-to-date or not
+         * \param index The entry to check
+         * \return True if the entry is valid. False otherwise.
+         */
+        bool isValid(uint32_t index) const;
+
+        /**
+         * \brief Stores the given world space data in the given entry and flags it as valid
+         * \param index The entry to update
+         * \param bounds The collider's world space bounds
+         * \param radius The collider's world space shape radius
+         * \param axis The collider's world space main axis
+         */
+        void update(uint32_t index, const Bounds& bounds, float radius, const LibMath::Vector3& axis);
+
+        /**
+         * \brief Gets the world space bounds stored in the given entry
+         * \param index The entry to read
+         * \return The entry's world space bounds
+         */
+        Bounds getBounds(uint32_t index) const;
+
+        /**
+         * \brief Gets the world space center stored in the given entry
+         * \param index The entry to read
+         * \return The entry's world space center
+         */
+        const LibMath::Vector3& getCenter(uint32_t index) const;
+
+        /**
+         * \brief Gets the world space bounding sphere radius stored in the given entry
+         * \param index The entry to read
+         * \return The entry's bounding sphere radius
+         */
+        float getSphereRadius(uint32_t index) const;
+
+        /**
+         * \brief Gets the world space shape radius stored in the given entry
+         * \param index The entry to read
+         * \return The entry's shape radius
+         */
+        float getRadius(uint32_t index) const;
+
+        /**
+         * \brief Gets the world space main axis stored in the given entry
+         * \param index The entry to read
+         * \return The entry's main axis
+         */
+        const LibMath::Vector3& getAxis(uint32_t index) const;
+
+        /**
+         * \brief Gets the number of entries, including the released ones
+         * \return The number of entries
+         */
+        size_t size() const;
+
+    private:
+        std::vector<LibMath::Vector3> m_centers;
+        std::vector<LibMath::Vector3> m_boxSizes;
+        std::vector<LibMath::Vector3> m_axes;
+        std::vector<float>            m_sphereRadii;
+        std::vector<float>            m_radii;
+        std::vector<uint8_t>          m_isValid;
+        std::vector<uint32_t>         m_freeIndices;
+    };
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include "EShapeType.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace LibGL::Physics
+{
+    class ICollider;
+    struct WorldShape;
+
+    /**
+     * \brief Table of the collision checks indexed by the shape types of the checked colliders,
+     * making each pair check a single indirect call. Unsupported pairs never collide.
+     * New collider types register their shape type and their checks against the existing types.
+     */
+    class CollisionDispatcher
+    {
+    public:
+        using CheckFunc = bool (*)(const ICollider& first, const ICollider& second);
+
+        static constexpr size_t MAX_SHAPE_TYPES = 16;
+
+        CollisionDispatcher() = delete;
+
+        /**
+         * \brief Reserves a shape type for a new collider type
+         * \return The new collider type's shape type
+         */
+        static EShapeType registerShapeType();
+
+        /**
+         * \brief Sets the function checking the collisions between colliders of the given shape types.
+         * The function is also used for the swapped pair, receiving the colliders in the registered order.
+         * \param first The shape type of the function's first collider
+         * \param second The shape type of the function's second collider
+         * \param func The function checking whether the given colliders overlap
+         */
+        static void registerCheck(EShapeType first, EShapeType second, CheckFunc func);
+
+        /**
+         * \brief Checks whether a check is registered for the given shape types
+         * \param first The first shape type
+         * \param second The second shape type
+         * \return True if colliders of the given shape types can collide. False otherwise.
+         */
+        static bool isSupported(EShapeType first, EShapeType second);
+
+        /**
+         * \brief Checks whether the given colliders overlap using the check registered for their shape types
+         * \param first The first collider to check
+         * \param second The second collider to check
+         * \return True if the colliders overlap. False otherwise or if their shape types aren't supported.
+         */
+        static bool check(const ICollider& first, const ICollider& second);
+
+    private:
+        struct Entry
+        {
+            CheckFunc m_func;
+            bool      m_isSwapped;
+        };
+
+        using Table = std::array<std::array<Entry, MAX_SHAPE_TYPES>, MAX_SHAPE_TYPES>;
+
+        static Table   s_checks;
+        static uint8_t s_shapeTypeCount;
+
+        /**
+         * \brief Builds the table of the built-in shape types' checks
+         * \return The table with the built-in checks
+         */
+        static constexpr Table makeBuiltinChecks();
+
+        /**
+         * \brief Check used for the pairs without a registered check
+         * \return False
+         */
+        static bool checkUnsupported(const ICollider&, const ICollider&);
+
+        /**
+         * \brief Adapts a check between world shapes to a check between colliders
+         * \tparam Func The world shapes check
+         * \param first The first collider to check
+         * \param second The second collider to check
+         * \return True if the colliders' world shapes overlap. False otherwise.
+         */
+        template <bool (*Func)(const WorldShape&, const WorldShape&)>
+        static bool checkWorldShapes(const ICollider& first, const ICollider& second);
+    };
+}
@@ -0,0 +1,111 @@
+#pragma once
+#include "PairCache.h"
+
+#include "Vector/Vector3.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace LibGL::Physics
+{
+    class ICollider;
+
+    /**
+     * \brief Description of a contact sent to one of the touching colliders
+     */
+    struct Collision
+    {
+        // The collider touched by the receiving one
+        ICollider* m_other;
+
+        // The direction in which the receiving collider should move to separate from the other one
+        LibMath::Vector3 m_normal;
+
+        // The middle of the colliders' deepest points. Zero once the colliders separated
+        LibMath::Vector3 m_point;
+
+        float m_depth;
+    };
+
+    /**
+     * \brief Tracks which broadphase pairs touch from one step to the next and sends the colliders' events.
+     * Triggers touch when their shapes overlap while the other pairs touch when their contact manifold has points.
+     * The events found by an update are queued and only sent on dispatch, once the step is done.
+     */
+    class CollisionEvents
+    {
+    public:
+        CollisionEvents() = default;
+        CollisionEvents(const CollisionEvents& other) = default;
+        CollisionEvents(CollisionEvents&& other) noexcept = default;
+        ~CollisionEvents() = default;
+
+        CollisionEvents& operator=(const CollisionEvents& other) = default;
+        CollisionEvents& operator=(CollisionEvents&& other) noexcept = default;
+
+        /**
+         * \brief Compares the broadphase pairs touching now to the ones touching on the previous update
+         * and queues the matching enter, stay and exit events
+         */
+        void update();
+
+        /**
+         * \brief Sends the queued events to both colliders of each pair, in the order they were found.
+         * Colliders destroyed by a callback don't receive their remaining events
+         */
+        void dispatch();
+
+        /**
+         * \brief Forgets the given collider's pairs and queued events without sending exit events
+         * \param collider The destroyed collider
+         */
+        void removeCollider(const ICollider& collider);
+
+        /**
+         * \brief Gets the number of pairs touching since the last update
+         * \return The touching pair count
+         */
+        size_t getTouchingPairCount() const;
+
+    private:
+        struct TouchingPair
+        {
+            ICollider* m_first;
+            ICollider* m_second;
+            uint64_t   m_lastUpdate;
+            bool       m_isTrigger;
+        };
+
+        struct QueuedEvent
+        {
+            ICollider*       m_first;
+            ICollider*       m_second;
+            LibMath::Vector3 m_normal;
+            LibMath::Vector3 m_point;
+            float            m_depth;
+            EPairState       m_state;
+            bool             m_isTrigger;
+        };
+
+        std::unordered_map<uint64_t, TouchingPair> m_touchingPairs;
+        std::vector<QueuedEvent>                   m_queue;
+        std::vector<uint64_t>                      m_endedKeys;
+        uint64_t                                   m_updateCount = 0;
+
+        /**
+         * \brief Sends the given event to both of its colliders
+         * \param index The index of the queued event
+         */
+        void send(size_t index) const;
+
+        /**
+         * \brief Computes the lookup key of the given pair from its colliders' world data indices,
+         * which unlike proxy ids are kept when the broadphase is replaced
+         * \param first The first collider of the pair
+         * \param second The second collider of the pair
+         * \return The pair's key, independent of the colliders' order
+         */
+        static uint64_t getKey(const ICollider& first, const ICollider& second);
+    };
+}
@@ -0,0 +1,11 @@
+#pragma once
+#include <cstdint>
+
+namespace LibGL::Physics
+{
+    // The layers given to new colliders
+    constexpr uint32_t DEFAULT_LAYER = 1;
+
+    // A mask matching every layer
+    constexpr uint32_t ALL_LAYERS = ~0u;
+}
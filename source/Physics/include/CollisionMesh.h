@@ -0,0 +1,57 @@
+#pragma once
+#include "TriangleMesh.h"
+#include "Resources/IResource.h"
+
+#include <memory> // shared_ptr
+
+namespace LibGL::Physics
+{
+    /**
+     * \brief Triangle mesh resource shared by the mesh colliders using the same geometry.
+     * Scenes reference it by path instead of embedding its triangles for each collider.
+     */
+    class CollisionMesh final : public Resources::IResource
+    {
+    public:
+        CollisionMesh() = default;
+
+        /**
+         * \brief Creates a collision mesh resource from the given mesh
+         * \param mesh The resource's mesh
+         */
+        explicit CollisionMesh(TriangleMesh mesh);
+
+        CollisionMesh(const CollisionMesh& other) = delete;
+        CollisionMesh(CollisionMesh&& other) noexcept = default;
+        ~CollisionMesh() override = default;
+
+        CollisionMesh& operator=(const CollisionMesh& other) = delete;
+        CollisionMesh& operator=(CollisionMesh&& other) noexcept = default;
+
+        /**
+         * \brief Loads the mesh and its hierarchy from the given collision mesh file
+         * \param fileName The collision mesh's file path
+         * \return True if the mesh was successfully loaded. False otherwise.
+         */
+        bool load(const char* fileName) override;
+
+        /**
+         * \brief Saves the mesh and its hierarchy to the given file
+         * \param fileName The output file's path
+         * \return True if the mesh was successfully saved. False otherwise.
+         */
+        bool save(const std::string& fileName) const;
+
+        /**
+         * \brief Gets the resource's mesh
+         * \return The resource's mesh
+         */
+        const std::shared_ptr<const TriangleMesh>& getMesh() const;
+
+    private:
+        static constexpr uint32_t MAGIC = 0x434C474C; // "LGLC"
+        static constexpr uint32_t VERSION = 1;
+
+        std::shared_ptr<const TriangleMesh> m_mesh = std::make_shared<const TriangleMesh>(TriangleMesh({}, {}));
+    };
+}
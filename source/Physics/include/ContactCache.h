@@ -0,0 +1,78 @@
+#pragma once
+#include "ContactManifold.h"
+#include "PairCache.h"
+
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+
+namespace LibGL::Physics
+{
+    class ICollider;
+
+    /**
+     * \brief Contact manifolds of the broadphase pairs, kept while the pairs exist so their points persist across frames
+     */
+    class ContactCache
+    {
+    public:
+        ContactCache() = default;
+        ContactCache(const ContactCache& other) = default;
+        ContactCache(ContactCache&& other) noexcept = default;
+        ~ContactCache() = default;
+
+        ContactCache& operator=(const ContactCache& other) = default;
+        ContactCache& operator=(ContactCache&& other) noexcept = default;
+
+        /**
+         * \brief Gets the manifold between the given colliders, creating it if needed.
+         * The manifold's first collider is the one with the lowest proxy id
+         * \param first The first collider
+         * \param second The second collider
+         * \return The colliders' manifold
+         */
+        ContactManifold& getManifold(const ICollider& first, const ICollider& second);
+
+        /**
+         * \brief Finds the existing manifold between the given colliders
+         * \param first The first collider
+         * \param second The second collider
+         * \return The colliders' manifold. Nullptr if it wasn't created
+         */
+        const ContactManifold* findManifold(const ICollider& first, const ICollider& second) const;
+
+        /**
+         * \brief Removes the manifolds of the given pairs
+         * \param pairs The pairs whose manifold should be removed
+         */
+        void removePairs(std::span<const OverlapPair> pairs);
+
+        /**
+         * \brief Removes the manifolds involving the given proxy
+         * \param proxyId The proxy whose manifolds should be removed
+         */
+        void removeProxy(int32_t proxyId);
+
+        /**
+         * \brief Removes all the manifolds
+         */
+        void clear();
+
+        /**
+         * \brief Gets the number of stored manifolds
+         * \return The manifold count
+         */
+        size_t getManifoldCount() const;
+
+    private:
+        std::unordered_map<uint64_t, ContactManifold> m_manifolds;
+
+        /**
+         * \brief Computes the key of the given pair, independent of the proxies' order
+         * \param first The first proxy
+         * \param second The second proxy
+         * \return The pair's key
+         */
+        static uint64_t getKey(int32_t first, int32_t second);
+    };
+}
@@ -0,0 +1,125 @@
+#pragma once
+#include "Vector/Vector3.h"
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace LibGL::Physics
+{
+    class ICollider;
+    struct Contact;
+
+    struct ContactPoint
+    {
+        // The colliders' deepest points in world space
+        LibMath::Vector3 m_positionA;
+        LibMath::Vector3 m_positionB;
+
+        // The deepest points relative to their collider's center, used to follow the colliders between frames
+        LibMath::Vector3 m_anchorA;
+        LibMath::Vector3 m_anchorB;
+
+        float m_depth;
+
+        // The impulses applied by the solver on the previous steps, reused as a starting guess
+        float            m_normalImpulse;
+        LibMath::Vector3 m_tangentImpulse;
+    };
+
+    /**
+     * \brief Contact points between two colliders kept across frames.
+     * Each update adds the colliders' current deepest points and drops the old ones which separated or slid away,
+     * building up to four points describing a resting face.
+     */
+    class ContactManifold
+    {
+    public:
+        static constexpr uint8_t MAX_POINTS = 4;
+
+        /**
+         * \brief Creates an empty manifold between the given colliders
+         * \param first The first collider, from which the normal points
+         * \param second The second collider
+         */
+        ContactManifold(const ICollider& first, const ICollider& second);
+
+        ContactManifold(const ContactManifold& other) = default;
+        ContactManifold(ContactManifold&& other) noexcept = default;
+        ~ContactManifold() = default;
+
+        ContactManifold& operator=(const ContactManifold& other) = default;
+        ContactManifold& operator=(ContactManifold&& other) noexcept = default;
+
+        /**
+         * \brief Moves the stored points with their colliders and adds the colliders' current contact
+         * \return True if the colliders touch. False otherwise.
+         */
+        bool update();
+
+        /**
+         * \brief Gets the manifold's first collider
+         * \return The first collider
+         */
+        const ICollider& getFirst() const;
+
+        /**
+         * \brief Gets the manifold's second collider
+         * \return The second collider
+         */
+        const ICollider& getSecond() const;
+
+        /**
+         * \brief Gets the direction in which the second collider should move to separate from the first one
+         * \return The manifold's normal
+         */
+        const LibMath::Vector3& getNormal() const;
+
+        /**
+         * \brief Gets the manifold's current contact points
+         * \return The manifold's contact points
+         */
+        std::span<const ContactPoint> getPoints() const;
+
+        /**
+         * \brief Gets the manifold's current contact points, whose impulses are updated by the solver
+         * \return The manifold's contact points
+         */
+        std::span<ContactPoint> getPoints();
+
+        /**
+         * \brief Gets the depth of the manifold's deepest point
+         * \return The manifold's max depth. 0 without contact points
+         */
+        float getMaxDepth() const;
+
+    private:
+        // Points which drifted further than this distance from their first position are dropped
+        static constexpr float PERSISTENCE_THRESHOLD = .02f;
+
+        std::array<ContactPoint, MAX_POINTS> m_points;
+        LibMath::Vector3                     m_normal;
+        const ICollider*                     m_first;
+        const ICollider*                     m_second;
+        uint8_t                              m_pointCount = 0;
+
+        /**
+         * \brief Moves the stored points with their colliders and removes the separated or slid ones
+         */
+        void refreshPoints();
+
+        /**
+         * \brief Adds the given contact to the points, replacing a close point or the least useful one when full
+         * \param contact The contact to add
+         */
+        void addPoint(const Contact& contact);
+
+        /**
+         * \brief Picks the point to replace by a new one when the manifold is full.
+         * The deepest point is kept and the remaining ones cover the largest area
+         * \param point The point to add
+         * \return The index of the point to replace
+         */
+        uint8_t getReplacedIndex(const ContactPoint& point) const;
+    };
+}
@@ -0,0 +1,129 @@
+#pragma once
+#include "Vector/Vector3.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace LibGL::Physics
+{
+    class ContactManifold;
+    struct ContactPoint;
+
+    /**
+     * \brief Sequential impulse solver resolving all the contacts of a step together.
+     * The velocities are solved first, starting from the impulses found on the previous steps,
+     * then the remaining penetration is removed by moving the bodies without adding velocity.
+     */
+    class ContactSolver
+    {
+    public:
+        // Index of the body standing for the colliders without a rigidbody
+        static constexpr uint32_t STATIC_BODY = 0;
+
+        inline static uint8_t s_velocityIterations = 8;
+        inline static uint8_t s_positionIterations = 3;
+
+        // Ratio of the penetration removed by each position iteration
+        inline static float s_correctionFactor = .2f;
+
+        // Penetration left uncorrected to keep the resting contacts alive between steps
+        inline static float s_allowedPenetration = .01f;
+
+        // Largest distance a body can be moved by a single correction
+        inline static float s_maxCorrection = .2f;
+
+        struct Body
+        {
+            LibMath::Vector3 m_velocity;
+            LibMath::Vector3 m_displacement;
+            float            m_inverseMass;
+        };
+
+        ContactSolver();
+        ContactSolver(const ContactSolver& other) = default;
+        ContactSolver(ContactSolver&& other) noexcept = default;
+        ~ContactSolver() = default;
+
+        ContactSolver& operator=(const ContactSolver& other) = default;
+        ContactSolver& operator=(ContactSolver&& other) noexcept = default;
+
+        /**
+         * \brief Removes the bodies and contacts of the previous step, keeping the static body
+         */
+        void clear();
+
+        /**
+         * \brief Adds a body to the solver
+         * \param velocity The body's velocity at the start of the step
+         * \param inverseMass The body's inverse mass. 0 for bodies unaffected by the contacts
+         * \return The body's index
+         */
+        uint32_t addBody(const LibMath::Vector3& velocity, float inverseMass);
+
+        /**
+         * \brief Gets the given body's solved state
+         * \param index The body's index
+         * \return The body's velocity and displacement
+         */
+        const Body& getBody(uint32_t index) const;
+
+        /**
+         * \brief Checks whether the given body can be moved by the contacts
+         * \param index The body's index
+         * \return True if the body has a finite mass. False otherwise.
+         */
+        bool isDynamic(uint32_t index) const;
+
+        /**
+         * \brief Adds the given manifold's points to the contacts to solve
+         * \param manifold The manifold whose points should be solved. Must outlive the step
+         * \param firstBody The index of the body owning the manifold's first collider
+         * \param secondBody The index of the body owning the manifold's second collider
+         * \param friction The contacts' friction coefficient
+         */
+        void addManifold(ContactManifold& manifold, uint32_t firstBody, uint32_t secondBody, float friction);
+
+        /**
+         * \brief Applies the previous steps' impulses then iteratively solves the contacts' velocities
+         */
+        void solveVelocities();
+
+        /**
+         * \brief Moves the bodies by their solved velocity
+         * \param deltaTime The step's duration
+         */
+        void integratePositions(float deltaTime);
+
+        /**
+         * \brief Iteratively moves the bodies apart to remove the contacts' penetration
+         */
+        void solvePositions();
+
+        /**
+         * \brief Gets the number of contact points to solve
+         * \return The solver's contact count
+         */
+        size_t getContactCount() const;
+
+    private:
+        struct Constraint
+        {
+            ContactPoint*    m_point;
+            LibMath::Vector3 m_normal;
+            uint32_t         m_first;
+            uint32_t         m_second;
+            float            m_mass;
+            float            m_friction;
+        };
+
+        std::vector<Body>       m_bodies;
+        std::vector<Constraint> m_constraints;
+
+        /**
+         * \brief Applies opposite velocity changes to the given contact's bodies
+         * \param constraint The contact whose bodies should be pushed
+         * \param impulse The impulse applied to the contact's second body
+         */
+        void applyImpulse(const Constraint& constraint, const LibMath::Vector3& impulse);
+    };
+}
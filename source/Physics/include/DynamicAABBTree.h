@@ -0,0 +1,174 @@
+#pragma once
+#include "IBroadphase.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace LibGL::Physics
+{
+    /**
+     * \brief Bounding volume hierarchy of colliders used to cull the collision and ray queries.
+     * Leaves store enlarged ("fat") boxes so small movements don't require any update
+     * and the tree is kept balanced with rotations to keep the queries logarithmic.
+     */
+    class DynamicAABBTree final : public IBroadphase
+    {
+    public:
+        static constexpr int32_t NULL_NODE = NULL_PROXY;
+
+        /**
+         * \brief Creates an empty tree
+         * \param margin The distance by which the leaves' boxes are enlarged on each side
+         */
+        explicit DynamicAABBTree(float margin = .1f);
+
+        DynamicAABBTree(const DynamicAABBTree& other) = default;
+        DynamicAABBTree(DynamicAABBTree&& other) noexcept = default;
+        ~DynamicAABBTree() override = default;
+
+        DynamicAABBTree& operator=(const DynamicAABBTree& other) = default;
+        DynamicAABBTree& operator=(DynamicAABBTree&& other) noexcept = default;
+
+        /**
+         * \brief Adds a leaf for the given collider to the tree
+         * \param bounds The collider's world space bounding box
+         * \param collider The collider represented by the leaf
+         * \return The id of the created proxy
+         */
+        int32_t createProxy(const AABB& bounds, ICollider* collider) override;
+
+        /**
+         * \brief Removes the given proxy from the tree
+         * \param proxyId The proxy to remove
+         */
+        void destroyProxy(int32_t proxyId) override;
+
+        /**
+         * \brief Updates the given proxy's bounds. The proxy is only reinserted if it left its fat box
+         * \param proxyId The proxy to update
+         * \param bounds The proxy's new world space bounding box
+         * \return True if the proxy was reinserted. False otherwise.
+         */
+        bool moveProxy(int32_t proxyId, const AABB& bounds) override;
+
+        /**
+         * \brief Gets the collider represented by the given proxy
+         * \param proxyId The proxy whose collider should be returned
+         * \return The proxy's collider
+         */
+        ICollider* getCollider(int32_t proxyId) const override;
+
+        /**
+         * \brief Gets the enlarged bounding box stored for the given proxy
+         * \param proxyId The proxy whose bounds should be returned
+         * \return The proxy's fat bounding box
+         */
+        const AABB& getFatBounds(int32_t proxyId) const override;
+
+        /**
+         * \brief Appends the colliders whose fat box overlaps the given box to the given list
+         * \param bounds The box to check against
+         * \param colliders The list to which the overlapping colliders should be added
+         */
+        void query(const AABB& bounds, std::vector<ICollider*>& colliders) const override;
+
+        /**
+         * \brief Calls the given function for each collider whose fat box is hit by the given ray segment
+         * \param origin The ray's origin
+         * \param direction The ray's normalized direction
+         * \param maxDistance The length of the ray segment
+         * \param callback The function to call for each hit collider
+         */
+        void raycast(const LibMath::Vector3& origin, const LibMath::Vector3& direction, float maxDistance,
+                     const RaycastCallback&  callback) const override;
+
+        /**
+         * \brief Calls the given function for each collider whose fat box is hit by any of the packet's ray segments.
+         * The packet walks the tree once, testing each node against all its rays at the same time.
+         * \param packet The rays to cast. Their max distances can be shortened by the callback
+         * \param callback The function to call for each hit collider
+         */
+        void raycast(RayPacket& packet, const PacketRaycastCallback& callback) const override;
+
+        /**
+         * \brief Gets the number of proxies in the tree
+         * \return The tree's proxy count
+         */
+        size_t getProxyCount() const override;
+
+        /**
+         * \brief Gets the height of the tree
+         * \return The length of the tree's longest branch. 0 for an empty tree
+         */
+        int32_t getHeight() const;
+
+    private:
+        struct Node
+        {
+            AABB       m_bounds;
+            ICollider* m_collider = nullptr;
+
+            // The next free node when the node isn't used
+            int32_t m_parent = NULL_NODE;
+            int32_t m_left = NULL_NODE;
+            int32_t m_right = NULL_NODE;
+
+            // -1 for free nodes, 0 for leaves
+            int32_t m_height = -1;
+
+            bool isLeaf() const;
+        };
+
+        static constexpr size_t STACK_SIZE = 256;
+
+        std::vector<Node> m_nodes;
+        int32_t           m_root = NULL_NODE;
+        int32_t           m_freeList = NULL_NODE;
+        size_t            m_proxyCount = 0;
+
+        /**
+         * \brief Gets a free node from the pool, growing it if needed
+         * \return The allocated node's index
+         */
+        int32_t allocateNode();
+
+        /**
+         * \brief Returns the given node to the pool
+         * \param nodeId The node to free
+         */
+        void freeNode(int32_t nodeId);
+
+        /**
+         * \brief Inserts the given leaf next to the sibling whose merge costs the least surface area
+         * \param leafId The leaf to insert
+         */
+        void insertLeaf(int32_t leafId);
+
+        /**
+         * \brief Detaches the given leaf from the tree, its parent being replaced by its sibling
+         * \param leafId The leaf to remove
+         */
+        void removeLeaf(int32_t leafId);
+
+        /**
+         * \brief Refits the bounds and heights of the given node's ancestors, balancing them on the way up
+         * \param nodeId The first node to refit
+         */
+        void refit(int32_t nodeId);
+
+        /**
+         * \brief Rotates the given node's children if their heights differ by more than one
+         * \param nodeId The node to balance
+         * \return The index of the node which replaced the given one in the hierarchy
+         */
+        int32_t balance(int32_t nodeId);
+
+        /**
+         * \brief Replaces the given child of the given parent (or the root if the parent is null)
+         * \param parentId The parent whose child should be replaced
+         * \param oldChildId The child to replace
+         * \param newChildId The new child
+         */
+        void replaceChild(int32_t parentId, int32_t oldChildId, int32_t newChildId);
+    };
+}
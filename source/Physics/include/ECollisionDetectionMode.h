@@ -5,6 +5,8 @@ namespace LibGL::Physics
     enum class ECollisionDetectionMode
     {
         DISCRETE,
+
+        // Sweeps the rigidbody's colliders along each step to stop at the first static collider they would hit
         CONTINUOUS,
         NONE
     };
@@ -0,0 +1,13 @@
+#pragma once
+#include <cstdint>
+
+namespace LibGL::Physics
+{
+    // Custom collider types get the values following the built-in ones from CollisionDispatcher::registerShapeType
+    enum class EShapeType : uint8_t
+    {
+        BOX,
+        SPHERE,
+        CAPSULE
+    };
+}
@@ -0,0 +1,280 @@
+#pragma once
+#include "Vector/Vector3.h"
+
+#include <array>
+#include <cstdint>
+
+namespace LibGL::Physics
+{
+    class ICollider;
+    struct TriangleShape;
+
+    /**
+     * \brief Deepest points of two touching colliders along their contact normal
+     */
+    struct Contact
+    {
+        // The direction in which the second collider should move to separate from the first one
+        LibMath::Vector3 m_normal;
+
+        // The first collider's point furthest inside the second one and vice versa
+        LibMath::Vector3 m_pointA;
+        LibMath::Vector3 m_pointB;
+
+        // The distance to move the colliders by along the normal to separate them. Negative while they are apart
+        float m_depth;
+    };
+
+    /**
+     * \brief Convex collision queries using the colliders' support points.
+     * Each collider is described as a core shape (a point, segment or box) inflated by a radius.
+     * The GJK distance between the cores gives exact contacts for rounded shapes while EPA
+     * finds the penetration of the inflated shapes once their cores overlap.
+     */
+    class Gjk
+    {
+    public:
+        Gjk() = delete;
+
+        /**
+         * \brief Computes the distance between the given colliders using GJK
+         * \param first The first collider
+         * \param second The second collider
+         * \param pointA The first collider's point closest to the second one
+         * \param pointB The second collider's point closest to the first one
+         * \return The distance between the colliders. 0 if they overlap, in which case the closest points are undefined
+         */
+        static float computeDistance(const ICollider& first, const ICollider& second, LibMath::Vector3& pointA,
+                                     LibMath::Vector3& pointB);
+
+        /**
+         * \brief Computes the contact between the given colliders, running EPA when their cores overlap
+         * \param first The first collider
+         * \param second The second collider
+         * \param contact The colliders' contact normal, deepest points and depth
+         * \param maxSeparation The largest distance between the colliders still reported as a contact
+         * \return True if the colliders are closer than the max separation. False otherwise.
+         */
+        static bool computeContact(const ICollider& first, const ICollider& second, Contact& contact,
+                                   float maxSeparation = 0.f);
+
+        /**
+         * \brief Finds when the first collider, moving by the given displacement, starts touching the second one.
+         * Since the colliders only translate, the distance between them is convex along the displacement
+         * and conservative advancement by the current distance over the closing speed can't skip the impact
+         * \param first The moving collider
+         * \param second The collider to hit
+         * \param displacement The first collider's displacement relative to the second one
+         * \param fraction The ratio of the displacement travelled before the colliders touch
+         * \param normal The direction from the first collider to the second one at the time of impact
+         * \return True if the colliders start touching during the displacement.
+         * False if they don't or if they already touch before moving
+         */
+        static bool computeTimeOfImpact(const ICollider& first, const ICollider& second,
+                                        const LibMath::Vector3& displacement, float& fraction,
+                                        LibMath::Vector3& normal);
+
+        /**
+         * \brief Computes the contact between the given triangle and collider, running EPA when they overlap.
+         * Used by the colliders made of triangles, which can't be queried as a single convex shape
+         * \param first The triangle, in world space
+         * \param second The convex collider
+         * \param contact The shapes' contact normal, deepest points and depth
+         * \param maxSeparation The largest distance between the shapes still reported as a contact
+         * \return True if the shapes are closer than the max separation. False otherwise.
+         */
+        static bool computeContact(const TriangleShape& first, const ICollider& second, Contact& contact,
+                                   float maxSeparation = 0.f);
+
+        /**
+         * \brief Finds when the given collider, moving by the given displacement, starts touching the given triangle
+         * \param first The moving collider
+         * \param second The triangle to hit, in world space
+         * \param displacement The collider's displacement
+         * \param fraction The ratio of the displacement travelled before the shapes touch
+         * \param normal The direction from the collider to the triangle at the time of impact
+         * \return True if the shapes start touching during the displacement.
+         * False if they don't or if they already touch before moving
+         */
+        static bool computeTimeOfImpact(const ICollider& first, const TriangleShape& second,
+                                        const LibMath::Vector3& displacement, float& fraction,
+                                        LibMath::Vector3& normal);
+
+    private:
+        static constexpr int   MAX_GJK_ITERATIONS = 32;
+        static constexpr int   MAX_TOI_ITERATIONS = 32;
+        static constexpr int   MAX_EPA_VERTICES = 64;
+        static constexpr int   MAX_EPA_FACES = 2 * MAX_EPA_VERTICES;
+        static constexpr float GJK_TOLERANCE = 1e-4f;
+        static constexpr float EPA_TOLERANCE = 1e-4f;
+        static constexpr float TOI_TOLERANCE = 1e-3f;
+
+        // Closer distances, relative to the size of the cores' difference, are considered as an overlap
+        static constexpr float OVERLAP_DISTANCE = 1e-5f;
+
+        /**
+         * \brief Shape read through its support points: a collider, optionally translated, or a triangle
+         */
+        struct SupportShape
+        {
+            const ICollider*     m_collider = nullptr;
+            const TriangleShape* m_triangle = nullptr;
+            LibMath::Vector3     m_offset = LibMath::Vector3::zero();
+
+            /**
+             * \brief Gets a point inside the shape's core, from which the searches start
+             * \return The shape's center
+             */
+            LibMath::Vector3 getCenter() const;
+
+            /**
+             * \brief Gets the point of the shape's core furthest along the given direction
+             * \param direction The direction in which to search
+             * \return The core's support point
+             */
+            LibMath::Vector3 getSupportPoint(const LibMath::Vector3& direction) const;
+
+            /**
+             * \brief Gets the radius by which the shape's core is inflated
+             * \return The shape's support radius
+             */
+            float getSupportRadius() const;
+        };
+
+        struct SupportPoint
+        {
+            LibMath::Vector3 m_pointA;
+            LibMath::Vector3 m_pointB;
+
+            // The point of the Minkowski difference, i.e. m_pointA - m_pointB
+            LibMath::Vector3 m_point;
+        };
+
+        struct Simplex
+        {
+            std::array<SupportPoint, 4> m_vertices;
+            std::array<float, 4>        m_weights{};
+            uint8_t                     m_count = 0;
+        };
+
+        struct Face
+        {
+            LibMath::Vector3 m_normal;
+            float            m_distance;
+            uint8_t          m_a;
+            uint8_t          m_b;
+            uint8_t          m_c;
+        };
+
+        struct Edge
+        {
+            uint8_t m_a;
+            uint8_t m_b;
+        };
+
+        /**
+         * \brief Computes the contact between the given shapes, running EPA when their cores overlap
+         * \param first The first shape
+         * \param second The second shape
+         * \param contact The shapes' contact normal, deepest points and depth
+         * \param maxSeparation The largest distance between the shapes still reported as a contact
+         * \return True if the shapes are closer than the max separation. False otherwise.
+         */
+        static bool computeContact(const SupportShape& first, const SupportShape& second, Contact& contact,
+                                   float maxSeparation);
+
+        /**
+         * \brief Finds when the first shape, moving by the given displacement, starts touching the second one
+         * \param first The moving shape
+         * \param second The shape to hit
+         * \param displacement The first shape's displacement relative to the second one
+         * \param fraction The ratio of the displacement travelled before the shapes touch
+         * \param normal The direction from the first shape to the second one at the time of impact
+         * \return True if the shapes start touching during the displacement. False otherwise.
+         */
+        static bool computeTimeOfImpact(const SupportShape& first, const SupportShape& second,
+                                        const LibMath::Vector3& displacement, float& fraction,
+                                        LibMath::Vector3& normal);
+
+        /**
+         * \brief Runs GJK between the given shapes' cores
+         * \param first The first shape
+         * \param second The second shape
+         * \param simplex The final simplex, whose weights give the closest points when the cores are apart
+         * \return The distance between the cores. 0 if they overlap
+         */
+        static float runGjk(const SupportShape& first, const SupportShape& second, Simplex& simplex);
+
+        /**
+         * \brief Runs EPA on the given inflated shapes, starting from the given simplex
+         * \param first The first shape
+         * \param second The second shape
+         * \param simplex The simplex enclosing the origin found by GJK
+         * \param contact The shapes' contact
+         * \return True if the penetration could be computed. False otherwise.
+         */
+        static bool runEpa(const SupportShape& first, const SupportShape& second, Simplex& simplex, Contact& contact);
+
+        /**
+         * \brief Gets the support point of the difference of the given shapes' cores in the given direction
+         * \param first The first shape
+         * \param second The second shape
+         * \param direction The direction in which to search
+         * \return The cores' support point
+         */
+        static SupportPoint getCoreSupport(const SupportShape& first, const SupportShape& second,
+                                           const LibMath::Vector3& direction);
+
+        /**
+         * \brief Gets the support point of the difference of the given inflated shapes in the given direction
+         * \param first The first shape
+         * \param second The second shape
+         * \param direction The direction in which to search
+         * \return The inflated shapes' support point
+         */
+        static SupportPoint getShapeSupport(const SupportShape& first, const SupportShape& second,
+                                            const LibMath::Vector3& direction);
+
+        /**
+         * \brief Reduces the simplex to the vertices supporting its point closest to the origin and updates their weights
+         * \param simplex The simplex to reduce
+         * \return The simplex's point closest to the origin
+         */
+        static LibMath::Vector3 solveSimplex(Simplex& simplex);
+
+        /**
+         * \brief Reduces the given segment simplex to the vertices supporting its point closest to the origin
+         * \param simplex The simplex to reduce
+         */
+        static void solveSegment(Simplex& simplex);
+
+        /**
+         * \brief Reduces the given triangle simplex to the vertices supporting its point closest to the origin
+         * \param simplex The simplex to reduce
+         */
+        static void solveTriangle(Simplex& simplex);
+
+        /**
+         * \brief Reduces the given tetrahedron simplex to the face closest to the origin, if the origin is outside of it
+         * \param simplex The simplex to reduce
+         */
+        static void solveTetrahedron(Simplex& simplex);
+
+        /**
+         * \brief Grows the given simplex into a tetrahedron using the inflated shapes' support points.
+         * Used when the cores only touch, leaving a degenerate simplex
+         * \param first The first shape
+         * \param second The second shape
+         * \param simplex The simplex to grow
+         * \return True if a tetrahedron with a volume could be built. False otherwise.
+         */
+        static bool growSimplex(const SupportShape& first, const SupportShape& second, Simplex& simplex);
+
+        /**
+         * \brief Computes the outward normal and distance to the origin of the given polytope face
+         * \param vertices The polytope's vertices
+         * \param face The face to update
+         */
+        static void updateFace(const std::array<SupportPoint, MAX_EPA_VERTICES>& vertices, Face& face);
+    };
+}
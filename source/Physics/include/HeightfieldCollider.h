@@ -0,0 +1,148 @@
+#pragma once
+#include "ITriangleCollider.h"
+
+#include <cstdint>
+#include <utility> // pair
+#include <vector>
+
+namespace LibGL
+{
+    class Entity;
+}
+
+namespace LibGL::Physics
+{
+    /**
+     * \brief Terrain collider built from a grid of heights, transformed by its owner.
+     * The grid starts at the owner's origin and extends along its right and front axes, each cell being split
+     * in two triangles. The regular grid replaces the hierarchy used by the meshes: the cells under a box or
+     * along a ray are found directly from their coordinates. Everything under the surface is inside the collider.
+     */
+    class HeightfieldCollider final : public ITriangleCollider
+    {
+    public:
+        using ITriangleCollider::check;
+
+        /**
+         * \brief Creates a heightfield collider from the given grid of heights
+         * \param owner The collider's owner
+         * \param columnCount The number of samples along the owner's right axis. At least 2
+         * \param rowCount The number of samples along the owner's front axis. At least 2
+         * \param heights The height of each sample, row after row
+         * \param cellSize The distance between two neighbouring samples
+         */
+        HeightfieldCollider(Entity& owner, uint32_t columnCount, uint32_t rowCount, std::vector<float> heights,
+                            float cellSize);
+
+        /**
+         * \brief Gets the world space bounding box of the transformed terrain
+         * \return The collider's world space bounding box
+         */
+        AABB getAABB() const override;
+
+        /**
+         * \brief Checks if a given point is under the terrain's surface.
+         * \param point The point to check collision for.
+         * \return True if the point is above the grid and under its surface. False otherwise.
+         */
+        bool check(const LibMath::Vector3& point) const override;
+
+        /**
+         * \brief Checks if a given ray hits the terrain's surface, walking through the cells crossed by the ray.
+         * \param ray The ray to check collision for.
+         * \param distanceSqr The squared distance from the origin to the closest intersection point. Infinity if no intersection
+         * \return True if the ray is colliding with the collider. False otherwise.
+         */
+        bool check(const Ray& ray, float& distanceSqr) const override;
+
+        /**
+         * \brief Computes the closest point to the given position inside the terrain.
+         * Exact for uniformly scaled owners
+         * \param point The point of which we want the closest in-bounds point
+         * \return The given point if it is under the surface. The closest point on the surface otherwise.
+         */
+        LibMath::Vector3 getClosestPoint(const LibMath::Vector3& point) const override;
+
+        /**
+         * \brief Computes the closest point to the given position on the terrain's surface.
+         * Exact for uniformly scaled owners
+         * \param point The point of which we want the closest on-surface point
+         * \return The closest point to the given position on the terrain's surface
+         */
+        LibMath::Vector3 getClosestPointOnSurface(const LibMath::Vector3& point) const override;
+
+        /**
+         * \brief Calls the given function for each of the terrain's world space triangles whose box overlaps the given one
+         * \param bounds The world space box to check against
+         * \param callback The function to call with each overlapping triangle. Returns true to stop the query
+         * \return True if the query was stopped by the callback. False otherwise.
+         */
+        bool queryTriangles(const AABB& bounds, const TriangleCallback& callback) const override;
+
+        /**
+         * \brief Computes the terrain's local height at the given local position, clamped to the grid
+         * \param x The position along the owner's right axis
+         * \param z The position along the owner's front axis
+         * \return The surface's height at the given position
+         */
+        float getHeight(float x, float z) const;
+
+        /**
+         * \brief Writes the collider's data
+         * \param writer The scene's writer
+         */
+        void serialize(Resources::SceneWriter& writer) const;
+
+        /**
+         * \brief Adds a heightfield collider created from the data written by serialize to the given entity
+         * \param owner The collider's owner
+         * \param reader The scene's reader
+         * \return A reference to the created collider
+         */
+        static HeightfieldCollider& deserialize(Entity& owner, Resources::SceneReader& reader);
+
+    private:
+        static const EShapeType s_shapeType;
+
+        std::vector<float> m_heights;
+        uint32_t           m_columnCount;
+        uint32_t           m_rowCount;
+        float              m_cellSize;
+        float              m_minHeight;
+        float              m_maxHeight;
+
+        /**
+         * \brief Gets the local triangles of the given cell
+         * \param column The cell's column
+         * \param row The cell's row
+         * \return The cell's two triangles
+         */
+        std::pair<TriangleShape, TriangleShape> getCellTriangles(uint32_t column, uint32_t row) const;
+
+        /**
+         * \brief Calls the given function for each cell overlapping the given local box
+         * \param bounds The local box to check against
+         * \param callback The function to call with each cell's column and row. Returns true to stop the query
+         * \return True if the query was stopped by the callback. False otherwise.
+         */
+        template <typename Func>
+        bool forEachCell(const AABB& bounds, Func&& callback) const;
+
+        /**
+         * \brief Gets the bounding box of the grid in local space
+         * \return The grid's local bounding box
+         */
+        AABB getLocalBounds() const;
+
+        /**
+         * \brief Computes the bounds of the given grid
+         * \param columnCount The number of samples along the right axis
+         * \param rowCount The number of samples along the front axis
+         * \param heights The samples' heights
+         * \param cellSize The distance between two neighbouring samples
+         * \return The grid's bounds
+         */
+        static Bounds calculateBounds(uint32_t columnCount, uint32_t rowCount, const std::vector<float>& heights,
+                                      float    cellSize);
+    };
+}
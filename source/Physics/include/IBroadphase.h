@@ -0,0 +1,158 @@
+#pragma once
+#include "AABB.h"
+#include "PairCache.h"
+#include "RayPacket.h"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace LibGL::Physics
+{
+    class ICollider;
+
+    /**
+     * \brief Base class of the structures culling the collider pairs and queries before the exact checks.
+     * Each collider is represented by a proxy storing its enlarged ("fat") world space box
+     * and the proxies whose boxes overlap are kept in a persistent pair cache.
+     */
+    class IBroadphase
+    {
+    public:
+        static constexpr int32_t NULL_PROXY = -1;
+
+        /**
+         * \brief Called for each proxy hit by a ray with its collider and the current max distance.
+         * Returns the new max distance, used to skip the farther proxies. A negative value stops the ray cast.
+         */
+        using RaycastCallback = std::function<float(ICollider*, float)>;
+
+        /**
+         * \brief Called for each proxy hit by some rays of a packet with its collider and the mask of the hitting lanes.
+         * Shortening a lane's max distance in the packet skips the farther proxies for that lane.
+         */
+        using PacketRaycastCallback = std::function<void(ICollider*, uint8_t)>;
+
+        /**
+         * \brief Creates an empty broadphase
+         * \param margin The distance by which the proxies' boxes are enlarged on each side
+         */
+        explicit IBroadphase(float margin);
+
+        IBroadphase(const IBroadphase& other) = default;
+        IBroadphase(IBroadphase&& other) noexcept = default;
+        virtual ~IBroadphase() = default;
+
+        IBroadphase& operator=(const IBroadphase& other) = default;
+        IBroadphase& operator=(IBroadphase&& other) noexcept = default;
+
+        /**
+         * \brief Adds a proxy for the given collider
+         * \param bounds The collider's world space bounding box
+         * \param collider The collider represented by the proxy
+         * \return The id of the created proxy
+         */
+        virtual int32_t createProxy(const AABB& bounds, ICollider* collider) = 0;
+
+        /**
+         * \brief Removes the given proxy and drops its pairs
+         * \param proxyId The proxy to remove
+         */
+        virtual void destroyProxy(int32_t proxyId) = 0;
+
+        /**
+         * \brief Updates the given proxy's bounds. Nothing is updated as long as the bounds stay in the proxy's fat box
+         * \param proxyId The proxy to update
+         * \param bounds The proxy's new world space bounding box
+         * \return True if the proxy's fat box changed. False otherwise.
+         */
+        virtual bool moveProxy(int32_t proxyId, const AABB& bounds) = 0;
+
+        /**
+         * \brief Gets the collider represented by the given proxy
+         * \param proxyId The proxy whose collider should be returned
+         * \return The proxy's collider
+         */
+        virtual ICollider* getCollider(int32_t proxyId) const = 0;
+
+        /**
+         * \brief Gets the enlarged bounding box stored for the given proxy
+         * \param proxyId The proxy whose bounds should be returned
+         * \return The proxy's fat bounding box
+         */
+        virtual const AABB& getFatBounds(int32_t proxyId) const = 0;
+
+        /**
+         * \brief Appends the colliders whose fat box overlaps the given box to the given list
+         * \param bounds The box to check against
+         * \param colliders The list to which the overlapping colliders should be added
+         */
+        virtual void query(const AABB& bounds, std::vector<ICollider*>& colliders) const = 0;
+
+        /**
+         * \brief Calls the given function for each collider whose fat box is hit by the given ray segment
+         * \param origin The ray's origin
+         * \param direction The ray's normalized direction
+         * \param maxDistance The length of the ray segment
+         * \param callback The function to call for each hit collider
+         */
+        virtual void raycast(const LibMath::Vector3& origin, const LibMath::Vector3& direction, float maxDistance,
+                             const RaycastCallback&  callback) const = 0;
+
+        /**
+         * \brief Calls the given function for each collider whose fat box is hit by any of the packet's ray segments.
+         * Casts each lane separately by default.
+         * \param packet The rays to cast. Their max distances can be shortened by the callback
+         * \param callback The function to call for each hit collider
+         */
+        virtual void raycast(RayPacket& packet, const PacketRaycastCallback& callback) const;
+
+        /**
+         * \brief Checks whether the broadphase's queries and ray casts can run on several threads at once
+         * \return True if the const queries don't modify any shared state. False otherwise.
+         */
+        virtual bool canQueryConcurrently() const;
+
+        /**
+         * \brief Gets the number of proxies in the broadphase
+         * \return The broadphase's proxy count
+         */
+        virtual size_t getProxyCount() const = 0;
+
+        /**
+         * \brief Gets the pairs of proxies whose fat boxes overlap
+         * \return The broadphase's pair cache
+         */
+        const PairCache& getPairCache() const;
+
+        /**
+         * \brief Discards the ended pairs and marks the beginning ones as persisting
+         */
+        void advancePairs();
+
+        /**
+         * \brief Orders the pairs by proxy ids instead of the order in which the broadphase found them
+         */
+        void sortPairs();
+
+        /**
+         * \brief Gets the distance by which the proxies' boxes are enlarged
+         * \return The broadphase's margin
+         */
+        float getMargin() const;
+
+    protected:
+        PairCache m_pairCache;
+        float     m_margin;
+
+        /**
+         * \brief Ends the given proxy's pairs which stopped overlapping and begins the new ones
+         * using the broadphase's box query
+         * \param proxyId The proxy whose fat box changed
+         */
+        void updatePairs(int32_t proxyId);
+
+    private:
+        std::vector<ICollider*> m_queryResults;
+    };
+}
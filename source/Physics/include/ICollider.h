@@ -1,7 +1,21 @@
 #pragma once
+#include "AABB.h"
+#include "Bounds.h"
+#include "ColliderWorldData.h"
+#include "CollisionEvents.h"
+#include "CollisionLayers.h"
+#include "ContactCache.h"
 #include "Component.h"
+#include "DynamicAABBTree.h"
+#include "EShapeType.h"
+#include "Eventing/Event.h"
+#include "IBroadphase.h"
+#include "Shapes.h"
+#include "Matrix/Matrix4.h"
 #include "Vector/Vector3.h"
 
+#include <memory> // unique_ptr
+#include <span>
 #include <vector>
 
 namespace LibGL
@@ -11,6 +25,9 @@ namespace LibGL
 
 namespace LibGL::Physics
 {
+    struct Contact;
+    struct RaycastHit;
+
     struct Ray
     {
         LibMath::Vector3 m_origin;
@@ -45,30 +62,112 @@ namespace LibGL::Physics
         float distanceSquaredFrom(const Ray& other) const;
     };
 
-    struct Bounds
-    {
-        LibMath::Vector3 m_center;
-        LibMath::Vector3 m_boxSize;
-        float            m_sphereRadius;
-    };
-
+    /**
+     * \brief Base class of the colliders.
+     * Queries read the world data cached by updateColliders, which is called by the physics step and the scene queries.
+     * Colliders moved since then refresh their own world data when it is read
+     */
     class ICollider : public Component
     {
     public:
+        // Sent after the step during which the collider started, kept or stopped touching a non-trigger collider
+        Event<const Collision&> m_collisionEnterEvent;
+        Event<const Collision&> m_collisionStayEvent;
+        Event<const Collision&> m_collisionExitEvent;
+
+        // Sent after the step during which the collider started or stopped overlapping a trigger, or the other way around
+        Event<ICollider&> m_triggerEnterEvent;
+        Event<ICollider&> m_triggerExitEvent;
+
         ICollider(const ICollider& other);
         ICollider(ICollider&& other) noexcept;
 
-        ICollider& operator=(const ICollider& other) = default;
-        ICollider& operator=(ICollider&& other) noexcept = default;
+        ICollider& operator=(const ICollider& other);
+        ICollider& operator=(ICollider&& other) noexcept;
 
         ~ICollider() override;
 
         /**
-         * \brief Gets the collider's bounding data in world space
+         * \brief Gets the collider's bounding data in world space.
+         * Refreshed by updateColliders, or here if the owner's transform changed since then
          * \return The collider's bounds in world space
          */
         Bounds getBounds() const;
 
+        /**
+         * \brief Gets the collider's cached world space description used by the collision checks
+         * \return The collider's world shape
+         */
+        WorldShape getWorldShape() const;
+
+        /**
+         * \brief Gets the type of the collider's shape, used to pick its collision checks
+         * \return The collider's shape type
+         */
+        EShapeType getShapeType() const;
+
+        /**
+         * \brief Gets the index of the collider's entry in the world data arrays
+         * \return The collider's world data index
+         */
+        uint32_t getDataIndex() const;
+
+        /**
+         * \brief Gets the layers the collider belongs to
+         * \return The collider's layers bitfield
+         */
+        uint32_t getLayers() const;
+
+        /**
+         * \brief Sets the layers the collider belongs to
+         * \param layers The collider's new layers bitfield
+         */
+        void setLayers(uint32_t layers);
+
+        /**
+         * \brief Gets the layers the collider can collide with
+         * \return The collider's collision mask
+         */
+        uint32_t getCollisionMask() const;
+
+        /**
+         * \brief Sets the layers the collider can collide with
+         * \param collisionMask The collider's new collision mask
+         */
+        void setCollisionMask(uint32_t collisionMask);
+
+        /**
+         * \brief Checks whether the collider belongs to any of the given layers
+         * \param layerMask The layers to check against
+         * \return True if the collider is in at least one of the given layers. False otherwise.
+         */
+        bool isInLayers(uint32_t layerMask) const;
+
+        /**
+         * \brief Checks whether each collider's layers are in the other's collision mask
+         * \param other The collider to check against
+         * \return True if the colliders' layers allow them to collide. False otherwise.
+         */
+        bool canCollideWith(const ICollider& other) const;
+
+        /**
+         * \brief Checks whether the collider is a trigger, which reports its overlaps without being pushed or stopped
+         * \return True if the collider is a trigger. False otherwise.
+         */
+        bool isTrigger() const;
+
+        /**
+         * \brief Sets whether the collider is a trigger, which reports its overlaps without being pushed or stopped
+         * \param isTrigger Whether the collider should be a trigger
+         */
+        void setTrigger(bool isTrigger);
+
+        /**
+         * \brief Gets the collider's axis aligned bounding box in world space (the bounding sphere's box by default)
+         * \return The collider's world space bounding box
+         */
+        virtual AABB getAABB() const;
+
         /**
          * \brief Checks if a given point is colliding with the collider.
          * \param point The point to check collision for.
@@ -85,11 +184,32 @@ namespace LibGL::Physics
         virtual bool check(const Ray& ray, float& distanceSqr) const;
 
         /**
-         * \brief Checks if a collider is colliding with the current collider.
+         * \brief Checks if a collider is colliding with the current collider using the check registered for their shape types.
          * \param other The collider to check collision for.
          * \return True if the other collider is colliding with the current collider. False otherwise.
          */
-        virtual bool check(const ICollider& other) const;
+        bool check(const ICollider& other) const;
+
+        /**
+         * \brief Checks if a given world space sphere is colliding with the collider.
+         * \param sphere The sphere to check collision for.
+         * \return True if the sphere is colliding with the collider. False otherwise.
+         */
+        virtual bool check(const SphereShape& sphere) const = 0;
+
+        /**
+         * \brief Checks if a given world space box is colliding with the collider.
+         * \param box The box to check collision for.
+         * \return True if the box is colliding with the collider. False otherwise.
+         */
+        virtual bool check(const BoxShape& box) const = 0;
+
+        /**
+         * \brief Checks if a given world space capsule is colliding with the collider.
+         * \param capsule The capsule to check collision for.
+         * \return True if the capsule is colliding with the collider. False otherwise.
+         */
+        virtual bool check(const CapsuleShape& capsule) const = 0;
 
         /**
          * \brief Computes the closest point to the given position inside the collider
@@ -98,6 +218,36 @@ namespace LibGL::Physics
          */
         virtual LibMath::Vector3 getClosestPoint(const LibMath::Vector3& point) const = 0;
 
+        /**
+         * \brief Gets the point of the collider's core shape furthest along the given direction.
+         * Convex colliders are their core shape inflated by their support radius (the bounding sphere's center by default)
+         * \param direction The direction in which to search
+         * \return The core shape's support point in world space
+         */
+        virtual LibMath::Vector3 getSupportPoint(const LibMath::Vector3& direction) const;
+
+        /**
+         * \brief Gets the radius by which the collider's core shape is inflated (the bounding sphere's radius by default)
+         * \return The collider's support radius in world space
+         */
+        virtual float getSupportRadius() const;
+
+        /**
+         * \brief Moves a capsule along the given direction until it touches the collider, using conservative advancement.
+         * A sphere is swept by giving the same point as the capsule's segment start and end.
+         * \param segmentStart The start of the capsule's center segment
+         * \param segmentEnd The end of the capsule's center segment
+         * \param radius The capsule's radius
+         * \param direction The normalized sweep direction
+         * \param maxDistance The max distance the capsule should travel
+         * \param distance The distance travelled by the capsule before touching the collider. 0 if they already overlap
+         * \param hitPoint The point of the collider touched by the capsule
+         * \return True if the capsule touches the collider within the max distance. False otherwise.
+         */
+        bool sweep(const LibMath::Vector3& segmentStart, const LibMath::Vector3& segmentEnd, float radius,
+                   const LibMath::Vector3& direction, float maxDistance, float& distance,
+                   LibMath::Vector3&       hitPoint) const;
+
         /**
          * \brief Computes the closest point to the given position on the surface of the collider
          * \param point The point of which we want the closest on-surface point
@@ -105,21 +255,227 @@ namespace LibGL::Physics
          */
         virtual LibMath::Vector3 getClosestPointOnSurface(const LibMath::Vector3& point) const = 0;
 
+        /**
+         * \brief Checks whether the collider is a single convex shape, described by its support points
+         * \return True for convex colliders. False for the colliders made of triangles
+         */
+        virtual bool isConvex() const;
+
+        /**
+         * \brief Computes the contact between the collider and the given one.
+         * Convex pairs are solved by GJK while the colliders made of triangles pick the contact of their deepest triangle.
+         * Pairs of non-convex colliders never touch
+         * \param other The collider to check against
+         * \param contact The colliders' contact, whose normal points from the current collider to the other one
+         * \return True if the colliders touch. False otherwise.
+         */
+        bool computeContact(const ICollider& other, Contact& contact) const;
+
+        /**
+         * \brief Finds when the collider, moving by the given displacement, starts touching the given one.
+         * Non-convex colliders are static geometry and can't be the moving collider
+         * \param other The collider to hit
+         * \param displacement The collider's displacement relative to the other one
+         * \param fraction The ratio of the displacement travelled before the colliders touch
+         * \param normal The direction from the current collider to the other one at the time of impact
+         * \return True if the colliders start touching during the displacement.
+         * False if they don't or if they already touch before moving
+         */
+        bool computeTimeOfImpact(const ICollider& other, const LibMath::Vector3& displacement, float& fraction,
+                                 LibMath::Vector3& normal) const;
+
         /**
          * \brief Gets a list of all loaded colliders
          * \return A list of all loaded colliders
          */
         static std::vector<ICollider*> getColliders();
 
+        /**
+         * \brief Gets the id of the collider's broadphase proxy
+         * \return The collider's proxy id. IBroadphase::NULL_PROXY until the broadphase is accessed after its creation
+         */
+        int32_t getProxyId() const;
+
+        /**
+         * \brief Refreshes the world data and the broadphase proxies of the colliders which moved since the last call.
+         * The colliders' world data is then up to date, so they can be queried from several threads at once
+         */
+        static void updateColliders();
+
+        /**
+         * \brief Gets the broadphase containing all loaded colliders, updating the colliders which moved first.
+         * Deterministic builds then sort the pairs by proxy ids
+         * \return The up-to-date broadphase
+         */
+        static const IBroadphase& getBroadphase();
+
+        /**
+         * \brief Marks the broadphase pairs which began since the last call as persisting and
+         * removes the contact manifolds of the ones which ended. Called once per physics step
+         */
+        static void advancePairs();
+
+        /**
+         * \brief Replaces the broadphase by one of the given type. The existing colliders are added to it on its next access.
+         * The touching pairs are tracked by collider and carry over, but the contact manifolds are dropped so the pairs
+         * of sleeping rigidbodies end on the next step
+         * \param args The arguments to pass to the broadphase's constructor
+         * \return A reference to the new broadphase
+         */
+        template <typename T, typename... Args>
+        static T& setBroadphase(Args&&... args);
+
+        /**
+         * \brief Gets the contact manifolds of the broadphase pairs.
+         * The manifolds of the ended pairs are removed when the broadphase advances its pairs
+         * \return The colliders' contact cache
+         */
+        static ContactCache& getContacts();
+
+        /**
+         * \brief Gets the tracker of the colliders' touching pairs, which sends their collision and trigger events
+         * \return The colliders' collision events
+         */
+        static CollisionEvents& getEvents();
+
+        /**
+         * \brief Gets the world space data of all loaded colliders.
+         * The entries of colliders which moved since their last access are outdated until they are read again
+         * or the broadphase is accessed
+         * \return The colliders' world data arrays
+         */
+        static const ColliderWorldData& getWorldData();
+
     protected:
-        ICollider(Entity& owner, const Bounds& bounds);
+        ICollider(Entity& owner, const Bounds& bounds, EShapeType shapeType);
+
+        /**
+         * \brief Writes the collider's layers and trigger flag to the given scene
+         * \param writer The scene writer to write to
+         */
+        void serializeSettings(Resources::SceneWriter& writer) const;
+
+        /**
+         * \brief Reads the collider's layers and trigger flag from the given scene
+         * \param reader The scene reader to read from
+         */
+        void deserializeSettings(Resources::SceneReader& reader);
+
+        /**
+         * \brief Gets the collider's cached world space shape radius
+         * \return The collider's shape radius in world space
+         */
+        float getWorldRadius() const;
+
+        /**
+         * \brief Gets the collider's cached world space main axis
+         * \return The collider's main axis in world space
+         */
+        const LibMath::Vector3& getWorldAxis() const;
+
+        /**
+         * \brief Computes the collider's shape radius in world space (the bounding sphere's radius by default)
+         * \param worldBounds The collider's world space bounds
+         * \return The collider's shape radius in world space
+         */
+        virtual float computeWorldRadius(const Bounds& worldBounds) const;
+
+        /**
+         * \brief Computes the collider's main axis in world space (the owner's up direction by default)
+         * \return The collider's main axis in world space
+         */
+        virtual LibMath::Vector3 computeWorldAxis() const;
+
+        /**
+         * \brief Caches the collider type's own world space data when the collider's world data is refreshed
+         * (nothing by default)
+         * \param worldMatrix The owner's world matrix
+         */
+        virtual void onWorldDataUpdate(const LibMath::Matrix4& worldMatrix) const;
+
+        /**
+         * \brief Computes the collider's world space data if its owner moved since the last update.
+         * Must not be needed during the batched queries, which read the world data from several threads
+         */
+        void updateWorldData() const;
+
+        /**
+         * \brief Computes the contact between the non-convex collider and the given convex one (none by default)
+         * \param convex The convex collider to check against
+         * \param contact The colliders' contact, whose normal points from the current collider to the convex one
+         * \return True if the colliders touch. False otherwise.
+         */
+        virtual bool computeConcaveContact(const ICollider& convex, Contact& contact) const;
+
+        /**
+         * \brief Finds when the given convex collider, moving by the given displacement, starts touching
+         * the non-convex collider (never by default)
+         * \param moving The moving convex collider
+         * \param displacement The moving collider's displacement
+         * \param fraction The ratio of the displacement travelled before the colliders touch
+         * \param normal The direction from the moving collider to the current one at the time of impact
+         * \return True if the colliders start touching during the displacement. False otherwise.
+         */
+        virtual bool computeConcaveTimeOfImpact(const ICollider& moving, const LibMath::Vector3& displacement,
+                                                float& fraction, LibMath::Vector3& normal) const;
 
     private:
+        friend size_t raycastBatch(std::span<const Ray> rays, std::span<RaycastHit> hits, float maxDistance,
+                                   uint32_t layerMask);
+
+        static constexpr int   MAX_SWEEP_ITERATIONS = 32;
+        static constexpr int   SEGMENT_SEARCH_ITERATIONS = 24;
+        static constexpr float SWEEP_TOLERANCE = .001f;
+
         inline static std::vector<ICollider*> m_colliders{};
+        inline static std::vector<ICollider*> s_dirtyColliders{};
+        inline static std::unique_ptr<IBroadphase> s_broadphase = std::make_unique<DynamicAABBTree>();
+        inline static ColliderWorldData s_worldData{};
+        inline static ContactCache s_contacts{};
+        inline static CollisionEvents s_events{};
+
+        // Set while the batched queries read the world data from several threads
+        inline static bool s_isReadingConcurrently = false;
+
+        Bounds     m_bounds;
+        uint32_t   m_dataIndex;
+        uint32_t   m_layers = DEFAULT_LAYER;
+        uint32_t   m_collisionMask = ALL_LAYERS;
+        int32_t    m_proxyId = IBroadphase::NULL_PROXY;
+        EShapeType m_shapeType;
+        bool       m_isTrigger = false;
+        bool       m_isDirty = false;
 
-        Bounds m_bounds;
+        /**
+         * \brief Finds the point of the given segment closest to the collider.
+         * The distance to a convex collider is convex along the segment, which allows a ternary search
+         * \param segmentStart The start of the segment
+         * \param segmentEnd The end of the segment
+         * \param closestOnSegment The segment's point closest to the collider
+         * \param closestOnCollider The collider's point closest to the segment
+         * \return The distance between the segment and the collider
+         */
+        float getSegmentDistance(const LibMath::Vector3& segmentStart, const LibMath::Vector3& segmentEnd,
+                                 LibMath::Vector3&       closestOnSegment, LibMath::Vector3& closestOnCollider) const;
+
+        /**
+         * \brief Flags the collider's proxy as outdated
+         */
+        void onTransformChange() override;
+
+        /**
+         * \brief Queues the collider for a proxy update on the next broadphase access
+         */
+        void markDirty();
+
+        /**
+         * \brief Queues every loaded collider for a proxy creation in the current broadphase
+         */
+        static void resetProxies();
     };
 
     LibMath::Vector3 getClosestPointOnSegment(const LibMath::Vector3& point, const LibMath::Vector3& lineStart,
                                               const LibMath::Vector3& lineEnd);
 }
+
+#include "ICollider.inl"
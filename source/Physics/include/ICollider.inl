@@ -0,0 +1,22 @@
+#pragma once
+#include "ICollider.h"
+
+#include <type_traits>
+
+namespace LibGL::Physics
+{
+    template <typename T, typename... Args>
+    T& ICollider::setBroadphase(Args&&... args)
+    {
+        static_assert(std::is_base_of_v<IBroadphase, T>);
+
+        std::unique_ptr<T> broadphase = std::make_unique<T>(std::forward<Args>(args)...);
+        T&                 broadphaseRef = *broadphase;
+
+        s_broadphase = std::move(broadphase);
+        s_contacts.clear();
+        resetProxies();
+
+        return broadphaseRef;
+    }
+}
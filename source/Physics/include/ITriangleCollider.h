@@ -0,0 +1,138 @@
+#pragma once
+#include "ICollider.h"
+#include "Matrix/Matrix4.h"
+
+#include <functional>
+
+namespace LibGL::Physics
+{
+    /**
+     * \brief Base of the non-convex colliders made of triangles, meant for static level geometry.
+     * Their overlaps and contacts with the convex colliders are computed against each nearby triangle in world space.
+     */
+    class ITriangleCollider : public ICollider
+    {
+    public:
+        using TriangleCallback = std::function<bool(const TriangleShape&)>;
+        using ICollider::check;
+
+        // Largest distance from the surface at which a point is still considered on it
+        static constexpr float SURFACE_TOLERANCE = 1e-3f;
+
+        /**
+         * \brief Checks if a given world space sphere touches any of the collider's triangles or has its center inside the collider
+         * \param sphere The sphere to check collision for.
+         * \return True if the sphere is colliding with the collider. False otherwise.
+         */
+        bool check(const SphereShape& sphere) const override;
+
+        /**
+         * \brief Checks if a given world space box touches any of the collider's triangles or has its center inside the collider
+         * \param box The box to check collision for.
+         * \return True if the box is colliding with the collider. False otherwise.
+         */
+        bool check(const BoxShape& box) const override;
+
+        /**
+         * \brief Checks if a given world space capsule touches any of the collider's triangles or has its center inside the collider
+         * \param capsule The capsule to check collision for.
+         * \return True if the capsule is colliding with the collider. False otherwise.
+         */
+        bool check(const CapsuleShape& capsule) const override;
+
+        /**
+         * \brief Checks whether the collider is a single convex shape
+         * \return False
+         */
+        bool isConvex() const override;
+
+        /**
+         * \brief Calls the given function for each of the collider's world space triangles whose box overlaps the given one
+         * \param bounds The world space box to check against
+         * \param callback The function to call with each overlapping triangle. Returns true to stop the query
+         * \return True if the query was stopped by the callback. False otherwise.
+         */
+        virtual bool queryTriangles(const AABB& bounds, const TriangleCallback& callback) const = 0;
+
+    protected:
+        ITriangleCollider(Entity& owner, const Bounds& bounds, EShapeType shapeType);
+
+        /**
+         * \brief Computes the contact between the collider's deepest triangle and the given convex collider
+         * \param convex The convex collider to check against
+         * \param contact The colliders' contact, whose normal points from the current collider to the convex one
+         * \return True if the colliders touch. False otherwise.
+         */
+        bool computeConcaveContact(const ICollider& convex, Contact& contact) const override;
+
+        /**
+         * \brief Finds the first of the collider's triangles hit by the given convex collider.
+         * The triangles whose plane the collider already crosses can only be hit on their edges, like the seams
+         * between the triangles of a flat floor, and are left to the contacts
+         * \param moving The moving convex collider
+         * \param displacement The moving collider's displacement
+         * \param fraction The ratio of the displacement travelled before the colliders touch
+         * \param normal The direction from the moving collider to the hit triangle at the time of impact
+         * \return True if the colliders start touching during the displacement. False otherwise.
+         */
+        bool computeConcaveTimeOfImpact(const ICollider& moving, const LibMath::Vector3& displacement,
+                                        float& fraction, LibMath::Vector3& normal) const override;
+
+        /**
+         * \brief Reserves a shape type for a collider type made of triangles and registers its checks
+         * against the convex shape types
+         * \return The new collider type's shape type
+         */
+        static EShapeType registerShapeType();
+
+        /**
+         * \brief Computes the axis aligned box containing the given box once transformed by the given matrix
+         * \param box The box to transform
+         * \param matrix The transformation to apply
+         * \return The transformed box's bounding box
+         */
+        static AABB transformBox(const AABB& box, const LibMath::Matrix4& matrix);
+
+        /**
+         * \brief Gets the owner's world matrix cached with the collider's world data
+         * \return The owner's world matrix
+         */
+        const LibMath::Matrix4& getWorldMatrix() const;
+
+        /**
+         * \brief Gets the inverse of the owner's world matrix cached with the collider's world data
+         * \return The inverse of the owner's world matrix
+         */
+        const LibMath::Matrix4& getInverseWorldMatrix() const;
+
+        /**
+         * \brief Caches the owner's world matrix and its inverse
+         * \param worldMatrix The owner's world matrix
+         */
+        void onWorldDataUpdate(const LibMath::Matrix4& worldMatrix) const override;
+
+    private:
+        mutable LibMath::Matrix4 m_worldMatrix;
+        mutable LibMath::Matrix4 m_inverseWorldMatrix;
+
+        /**
+         * \brief Checks whether any of the collider's triangles overlaps the given world space shape
+         * \tparam Func The check between a triangle and the shape
+         * \param shape The shape to check
+         * \param bounds The shape's bounding box
+         * \return True if the shape touches a triangle or has its center inside the collider. False otherwise.
+         */
+        template <bool (*Func)(const TriangleShape&, const WorldShape&)>
+        bool checkTriangles(const WorldShape& shape, const AABB& bounds) const;
+
+        /**
+         * \brief Adapts a check between a triangle and a world shape to a check between colliders
+         * \tparam Func The check between a triangle and the other collider's world shape
+         * \param triangles The collider made of triangles
+         * \param other The convex collider to check
+         * \return True if the colliders overlap. False otherwise.
+         */
+        template <bool (*Func)(const TriangleShape&, const WorldShape&)>
+        static bool checkCollider(const ICollider& triangles, const ICollider& other);
+    };
+}
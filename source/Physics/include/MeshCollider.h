@@ -0,0 +1,117 @@
+#pragma once
+#include "CollisionMesh.h"
+#include "ITriangleCollider.h"
+#include "TriangleMesh.h"
+
+#include <memory> // shared_ptr
+
+namespace LibGL
+{
+    class Entity;
+}
+
+namespace LibGL::Physics
+{
+    /**
+     * \brief Collider using the surface of a static triangle mesh, transformed by its owner.
+     * The mesh is shared with the other colliders using the same geometry and has no inside.
+     */
+    class MeshCollider final : public ITriangleCollider
+    {
+    public:
+        using ITriangleCollider::check;
+
+        /**
+         * \brief Creates a collider embedding the given mesh in the scene files it is saved to
+         * \param owner The collider's owner
+         * \param mesh The collider's mesh. Can't be nullptr
+         */
+        MeshCollider(Entity& owner, std::shared_ptr<const TriangleMesh> mesh);
+
+        /**
+         * \brief Creates a collider using the given resource's mesh, referenced by path in the scene files
+         * \param owner The collider's owner
+         * \param mesh The collision mesh resource to use
+         */
+        MeshCollider(Entity& owner, const CollisionMesh& mesh);
+
+        /**
+         * \brief Gets the world space bounding box of the transformed mesh
+         * \return The collider's world space bounding box
+         */
+        AABB getAABB() const override;
+
+        /**
+         * \brief Checks if a given point is on the mesh's surface.
+         * \param point The point to check collision for.
+         * \return True if the point is within the surface tolerance of a triangle. False otherwise.
+         */
+        bool check(const LibMath::Vector3& point) const override;
+
+        /**
+         * \brief Checks if a given ray hits any of the mesh's triangles.
+         * \param ray The ray to check collision for.
+         * \param distanceSqr The squared distance from the origin to the closest intersection point. Infinity if no intersection
+         * \return True if the ray is colliding with the collider. False otherwise.
+         */
+        bool check(const Ray& ray, float& distanceSqr) const override;
+
+        /**
+         * \brief Computes the closest point to the given position on the mesh's surface.
+         * Exact for uniformly scaled owners
+         * \param point The point of which we want the closest point on the mesh
+         * \return The closest point to the given position on the mesh
+         */
+        LibMath::Vector3 getClosestPoint(const LibMath::Vector3& point) const override;
+
+        /**
+         * \brief Computes the closest point to the given position on the mesh's surface.
+         * Exact for uniformly scaled owners
+         * \param point The point of which we want the closest on-surface point
+         * \return The closest point to the given position on the mesh
+         */
+        LibMath::Vector3 getClosestPointOnSurface(const LibMath::Vector3& point) const override;
+
+        /**
+         * \brief Calls the given function for each of the mesh's world space triangles whose box overlaps the given one
+         * \param bounds The world space box to check against
+         * \param callback The function to call with each overlapping triangle. Returns true to stop the query
+         * \return True if the query was stopped by the callback. False otherwise.
+         */
+        bool queryTriangles(const AABB& bounds, const TriangleCallback& callback) const override;
+
+        /**
+         * \brief Gets the mesh used by the collider
+         * \return The collider's mesh
+         */
+        const std::shared_ptr<const TriangleMesh>& getMesh() const;
+
+        /**
+         * \brief Writes the collider's data. The mesh is referenced by path if it comes from a collision mesh resource,
+         * otherwise its triangles and hierarchy are written
+         * \param writer The scene's writer
+         */
+        void serialize(Resources::SceneWriter& writer) const;
+
+        /**
+         * \brief Adds a mesh collider created from the data written by serialize to the given entity
+         * \param owner The collider's owner
+         * \param reader The scene's reader
+         * \return A reference to the created collider
+         */
+        static MeshCollider& deserialize(Entity& owner, Resources::SceneReader& reader);
+
+    private:
+        static const EShapeType s_shapeType;
+
+        std::shared_ptr<const TriangleMesh> m_mesh;
+        const CollisionMesh*                m_resource = nullptr;
+
+        /**
+         * \brief Computes the bounds of the given mesh
+         * \param mesh The mesh whose bounds should be computed
+         * \return The mesh's bounds
+         */
+        static Bounds calculateBounds(const TriangleMesh* mesh);
+    };
+}
@@ -0,0 +1,184 @@
+#pragma once
+#include "Shapes.h"
+#include "Vector/Vector3.h"
+
+#include <utility>
+
+namespace LibGL::Physics
+{
+    /**
+     * \brief Checks whether the bounding spheres of the given shapes intersect or not
+     * \param first The first shape
+     * \param second The second shape
+     * \return True if the bounding spheres intersect. False otherwise.
+     */
+    bool checkBoundingSpheres(const WorldShape& first, const WorldShape& second);
+
+    /**
+     * \brief Checks whether the given point is inside the given sphere or not
+     * \param sphere The sphere to check against
+     * \param point The point to check
+     * \return True if the point is inside the sphere. False otherwise.
+     */
+    bool checkSpherePoint(const WorldShape& sphere, const LibMath::Vector3& point);
+
+    /**
+     * \brief Checks whether the given point is inside the given box or not
+     * \param box The box to check against
+     * \param point The point to check
+     * \return True if the point is inside the box. False otherwise.
+     */
+    bool checkBoxPoint(const WorldShape& box, const LibMath::Vector3& point);
+
+    /**
+     * \brief Checks whether the given point is inside the given capsule or not
+     * \param capsule The capsule to check against
+     * \param point The point to check
+     * \return True if the point is inside the capsule. False otherwise.
+     */
+    bool checkCapsulePoint(const WorldShape& capsule, const LibMath::Vector3& point);
+
+    /**
+     * \brief Computes the closest point to the given position inside the given sphere
+     * \param sphere The sphere in which the point should be
+     * \param point The point of which we want the closest in-bounds point
+     * \return The closest point to the given position in the sphere
+     */
+    LibMath::Vector3 getClosestPointOnSphere(const WorldShape& sphere, const LibMath::Vector3& point);
+
+    /**
+     * \brief Computes the closest point to the given position inside the given box
+     * \param box The box in which the point should be
+     * \param point The point of which we want the closest in-bounds point
+     * \return The closest point to the given position in the box
+     */
+    LibMath::Vector3 getClosestPointOnBox(const WorldShape& box, const LibMath::Vector3& point);
+
+    /**
+     * \brief Computes the closest point to the given position inside the given capsule
+     * \param capsule The capsule in which the point should be
+     * \param point The point of which we want the closest in-bounds point
+     * \return The closest point to the given position in the capsule
+     */
+    LibMath::Vector3 getClosestPointOnCapsule(const WorldShape& capsule, const LibMath::Vector3& point);
+
+    /**
+     * \brief Gets the corner of the given box furthest along the given direction
+     * \param box The box whose support point should be returned
+     * \param direction The direction in which to search
+     * \return The box's support point in the given direction
+     */
+    LibMath::Vector3 getBoxSupportPoint(const WorldShape& box, const LibMath::Vector3& direction);
+
+    /**
+     * \brief Gets the end of the given capsule's center segment furthest along the given direction
+     * \param capsule The capsule whose core support point should be returned
+     * \param direction The direction in which to search
+     * \return The capsule's core support point in the given direction
+     */
+    LibMath::Vector3 getCapsuleSupportPoint(const WorldShape& capsule, const LibMath::Vector3& direction);
+
+    /**
+     * \brief Checks whether the given boxes intersect or not
+     * \param box The first box
+     * \param other The second box
+     * \return True if the boxes intersect. False otherwise.
+     */
+    bool checkBoxBox(const WorldShape& box, const WorldShape& other);
+
+    /**
+     * \brief Checks whether the given box and sphere intersect or not
+     * \param box The box to check
+     * \param sphere The sphere to check
+     * \return True if the box and sphere intersect. False otherwise.
+     */
+    bool checkBoxSphere(const WorldShape& box, const WorldShape& sphere);
+
+    /**
+     * \brief Checks whether the given box and capsule intersect or not
+     * \param box The box to check
+     * \param capsule The capsule to check
+     * \return True if the box and capsule intersect. False otherwise.
+     */
+    bool checkBoxCapsule(const WorldShape& box, const WorldShape& capsule);
+
+    /**
+     * \brief Checks whether the given spheres intersect or not
+     * \param sphere The first sphere
+     * \param other The second sphere
+     * \return True if the spheres intersect. False otherwise.
+     */
+    bool checkSphereSphere(const WorldShape& sphere, const WorldShape& other);
+
+    /**
+     * \brief Checks whether the given sphere and capsule intersect or not
+     * \param sphere The sphere to check
+     * \param capsule The capsule to check
+     * \return True if the sphere and capsule intersect. False otherwise.
+     */
+    bool checkSphereCapsule(const WorldShape& sphere, const WorldShape& capsule);
+
+    /**
+     * \brief Checks whether the given capsules intersect or not
+     * \param capsule The first capsule
+     * \param other The second capsule
+     * \return True if the capsules intersect. False otherwise.
+     */
+    bool checkCapsuleCapsule(const WorldShape& capsule, const WorldShape& other);
+
+    /**
+     * \brief Computes the closest points between the given segments
+     * \param firstStart The start of the first segment
+     * \param firstEnd The end of the first segment
+     * \param secondStart The start of the second segment
+     * \param secondEnd The end of the second segment
+     * \return The first segment's point closest to the second one and vice versa
+     */
+    std::pair<LibMath::Vector3, LibMath::Vector3> getClosestPointsOnSegments(const LibMath::Vector3& firstStart,
+                                                                             const LibMath::Vector3& firstEnd,
+                                                                             const LibMath::Vector3& secondStart,
+                                                                             const LibMath::Vector3& secondEnd);
+
+    /**
+     * \brief Computes the closest point to the given position on the given triangle
+     * \param triangle The triangle on which the point should be
+     * \param point The point of which we want the closest point on the triangle
+     * \return The closest point to the given position on the triangle
+     */
+    LibMath::Vector3 getClosestPointOnTriangle(const TriangleShape& triangle, const LibMath::Vector3& point);
+
+    /**
+     * \brief Checks whether the given ray hits either side of the given triangle or not
+     * \param triangle The triangle to check against
+     * \param origin The ray's origin
+     * \param direction The ray's direction. Doesn't need to be normalized
+     * \param distance The hit's distance from the origin, in multiples of the direction's length
+     * \return True if the ray hits the triangle. False otherwise.
+     */
+    bool raycastTriangle(const TriangleShape& triangle, const LibMath::Vector3& origin,
+                         const LibMath::Vector3& direction, float& distance);
+
+    /**
+     * \brief Checks whether the given triangle and sphere intersect or not
+     * \param triangle The triangle to check
+     * \param sphere The sphere to check
+     * \return True if the triangle and sphere intersect. False otherwise.
+     */
+    bool checkTriangleSphere(const TriangleShape& triangle, const WorldShape& sphere);
+
+    /**
+     * \brief Checks whether the given triangle and box intersect or not using the separating axis theorem
+     * \param triangle The triangle to check
+     * \param box The box to check
+     * \return True if the triangle and box intersect. False otherwise.
+     */
+    bool checkTriangleBox(const TriangleShape& triangle, const WorldShape& box);
+
+    /**
+     * \brief Checks whether the given triangle and capsule intersect or not
+     * \param triangle The triangle to check
+     * \param capsule The capsule to check
+     * \return True if the triangle and capsule intersect. False otherwise.
+     */
+    bool checkTriangleCapsule(const TriangleShape& triangle, const WorldShape& capsule);
+}
@@ -0,0 +1,122 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace LibGL::Physics
+{
+    enum class EPairState : uint8_t
+    {
+        BEGIN,
+        PERSIST,
+        END
+    };
+
+    struct OverlapPair
+    {
+        int32_t    m_first;
+        int32_t    m_second;
+        EPairState m_state;
+    };
+
+    /**
+     * \brief Persistent set of the broadphase proxies whose boxes overlap.
+     * Pairs are flagged as beginning, persisting or ending relative to the previous call to advance.
+     */
+    class PairCache
+    {
+    public:
+        PairCache() = default;
+        PairCache(const PairCache& other) = default;
+        PairCache(PairCache&& other) noexcept = default;
+        ~PairCache() = default;
+
+        PairCache& operator=(const PairCache& other) = default;
+        PairCache& operator=(PairCache&& other) noexcept = default;
+
+        /**
+         * \brief Adds a beginning pair for the given proxies if they aren't paired yet
+         * \param first The first proxy of the pair
+         * \param second The second proxy of the pair
+         */
+        void addPair(int32_t first, int32_t second);
+
+        /**
+         * \brief Ends the given proxies' pair if it exists
+         * \param first The first proxy of the pair
+         * \param second The second proxy of the pair
+         */
+        void removePair(int32_t first, int32_t second);
+
+        /**
+         * \brief Drops all the pairs of the given proxy without ending them
+         * \param proxyId The destroyed proxy
+         */
+        void removeProxy(int32_t proxyId);
+
+        /**
+         * \brief Discards the ended pairs and marks the beginning pairs as persisting
+         */
+        void advance();
+
+        /**
+         * \brief Orders the current pairs by proxy ids, making their order independent of the order they were found in
+         */
+        void sort();
+
+        /**
+         * \brief Checks whether the given proxies are paired or not
+         * \param first The first proxy of the pair
+         * \param second The second proxy of the pair
+         * \return True if the proxies are paired. False otherwise.
+         */
+        bool contains(int32_t first, int32_t second) const;
+
+        /**
+         * \brief Gets the beginning and persisting pairs
+         * \return The current pairs
+         */
+        std::span<const OverlapPair> getPairs() const;
+
+        /**
+         * \brief Gets the pairs which ended since the last call to advance
+         * \return The ended pairs
+         */
+        std::span<const OverlapPair> getEndedPairs() const;
+
+        /**
+         * \brief Gets the proxies currently paired with the given one
+         * \param proxyId The proxy whose overlaps should be returned
+         * \return The ids of the proxies paired with the given one
+         */
+        std::span<const int32_t> getOverlaps(int32_t proxyId) const;
+
+    private:
+        std::vector<OverlapPair>             m_pairs;
+        std::vector<OverlapPair>             m_endedPairs;
+        std::unordered_map<uint64_t, size_t> m_pairIndices;
+        std::vector<std::vector<int32_t>>    m_overlaps;
+
+        /**
+         * \brief Removes the given pair from the list and the lookup tables
+         * \param index The index of the pair to remove
+         */
+        void erasePair(size_t index);
+
+        /**
+         * \brief Removes the given proxy from the other proxy's overlaps
+         * \param proxyId The proxy whose overlaps should be updated
+         * \param otherId The proxy to remove
+         */
+        void eraseOverlap(int32_t proxyId, int32_t otherId);
+
+        /**
+         * \brief Computes the lookup key of the given pair
+         * \param first The first proxy of the pair
+         * \param second The second proxy of the pair
+         * \return The pair's key, independent of the proxies' order
+         */
+        static uint64_t getKey(int32_t first, int32_t second);
+    };
+}
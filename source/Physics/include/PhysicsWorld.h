@@ -0,0 +1,95 @@
+#pragma once
+#include <cstdint>
+
+namespace LibGL::Physics
+{
+    /**
+     * \brief Steps the rigidbodies at a fixed rate, independently of the frame rate.
+     * The frames' durations are accumulated and consumed by fixed steps, the time left over being used to interpolate
+     * the rendered positions between the last two steps.
+     */
+    class PhysicsWorld
+    {
+    public:
+        static constexpr float   DEFAULT_FIXED_DELTA_TIME = 1.f / 60.f;
+        static constexpr uint8_t DEFAULT_MAX_SUBSTEPS = 5;
+
+        /**
+         * \brief Creates a physics world with the given step settings
+         * \param fixedDeltaTime The duration of a single step
+         * \param maxSubsteps The max number of steps run in a single update
+         */
+        explicit PhysicsWorld(float fixedDeltaTime = DEFAULT_FIXED_DELTA_TIME,
+                              uint8_t maxSubsteps = DEFAULT_MAX_SUBSTEPS);
+
+        PhysicsWorld(const PhysicsWorld& other) = default;
+        PhysicsWorld(PhysicsWorld&& other) noexcept = default;
+        ~PhysicsWorld() = default;
+
+        PhysicsWorld& operator=(const PhysicsWorld& other) = default;
+        PhysicsWorld& operator=(PhysicsWorld&& other) noexcept = default;
+
+        /**
+         * \brief Runs as many fixed steps as fit in the accumulated time then interpolates the rendered positions.
+         * The time which would require more than the max number of substeps is dropped to avoid a spiral of death
+         * \param deltaTime The duration of the frame
+         * \return The number of steps run
+         */
+        uint8_t update(float deltaTime);
+
+        /**
+         * \brief Gets the duration of a single step
+         * \return The fixed delta time
+         */
+        float getFixedDeltaTime() const;
+
+        /**
+         * \brief Sets the duration of a single step
+         * \param fixedDeltaTime The new fixed delta time. Must be positive
+         */
+        void setFixedDeltaTime(float fixedDeltaTime);
+
+        /**
+         * \brief Gets the max number of steps run in a single update
+         * \return The max number of substeps
+         */
+        uint8_t getMaxSubsteps() const;
+
+        /**
+         * \brief Sets the max number of steps run in a single update
+         * \param maxSubsteps The new max number of substeps. Must be at least 1
+         */
+        void setMaxSubsteps(uint8_t maxSubsteps);
+
+        /**
+         * \brief Checks whether the rendered positions are interpolated between the last two steps
+         * \return True if the positions are interpolated. False otherwise.
+         */
+        bool isInterpolating() const;
+
+        /**
+         * \brief Sets whether the rendered positions should be interpolated between the last two steps
+         * \param shouldInterpolate Whether the positions should be interpolated
+         */
+        void setInterpolation(bool shouldInterpolate);
+
+        /**
+         * \brief Gets the ratio of a step accumulated since the last step, used to interpolate the positions
+         * \return The interpolation factor, between 0 and 1
+         */
+        float getInterpolationFactor() const;
+
+        /**
+         * \brief Gets the number of steps run since the world's creation, used to match the state hashes of replays
+         * \return The world's step count
+         */
+        uint64_t getStepCount() const;
+
+    private:
+        uint64_t m_stepCount = 0;
+        float    m_fixedDeltaTime;
+        float    m_accumulator = 0.f;
+        uint8_t  m_maxSubsteps;
+        bool     m_shouldInterpolate = true;
+    };
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include "AABB.h"
+
+#include "Vector/Vector3.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace LibGL::Physics
+{
+    /**
+     * \brief A group of rays stored per component, tested together against a single box or sphere.
+     * Uses SSE when available and falls back to a loop over the lanes otherwise.
+     */
+    struct RayPacket
+    {
+        static constexpr size_t  SIZE = 4;
+        static constexpr uint8_t FULL_MASK = (1 << SIZE) - 1;
+
+        alignas(16) float m_originX[SIZE]{};
+        alignas(16) float m_originY[SIZE]{};
+        alignas(16) float m_originZ[SIZE]{};
+        alignas(16) float m_directionX[SIZE]{};
+        alignas(16) float m_directionY[SIZE]{};
+        alignas(16) float m_directionZ[SIZE]{};
+        alignas(16) float m_inverseDirX[SIZE]{};
+        alignas(16) float m_inverseDirY[SIZE]{};
+        alignas(16) float m_inverseDirZ[SIZE]{};
+        alignas(16) float m_maxDistance[SIZE]{};
+
+        // The lanes holding a ray. The other lanes never report hits
+        uint8_t m_activeMask = 0;
+
+        /**
+         * \brief Stores the given ray in the given lane and activates it
+         * \param lane The lane in which the ray should be stored
+         * \param origin The ray's origin
+         * \param direction The ray's normalized direction
+         * \param maxDistance The length of the ray segment
+         */
+        void setRay(size_t lane, const LibMath::Vector3& origin, const LibMath::Vector3& direction, float maxDistance);
+
+        /**
+         * \brief Gets the origin of the ray stored in the given lane
+         * \param lane The ray's lane
+         * \return The ray's origin
+         */
+        LibMath::Vector3 getOrigin(size_t lane) const;
+
+        /**
+         * \brief Gets the direction of the ray stored in the given lane
+         * \param lane The ray's lane
+         * \return The ray's normalized direction
+         */
+        LibMath::Vector3 getDirection(size_t lane) const;
+
+        /**
+         * \brief Checks which active rays hit the given box before their max distance
+         * \param bounds The box to check against
+         * \return A mask with a bit set for each lane whose ray hits the box
+         */
+        uint8_t raycast(const AABB& bounds) const;
+
+        /**
+         * \brief Checks which active rays hit the given sphere before their max distance
+         * \param center The sphere's center
+         * \param radius The sphere's radius
+         * \return A mask with a bit set for each lane whose ray hits the sphere
+         */
+        uint8_t raycastSphere(const LibMath::Vector3& center, float radius) const;
+    };
+}
@@ -1,9 +1,15 @@
 #pragma once
+#include "CollisionLayers.h"
+
 #include "Vector/Vector3.h"
 
+#include <span>
+#include <vector>
+
 namespace LibGL::Physics
 {
     class ICollider;
+    struct Ray;
 
     struct RaycastHit
     {
@@ -14,23 +20,53 @@ namespace LibGL::Physics
 
     /**
      * \brief Checks collisions for a ray of the given length, from the given point,
-     * in the given direction, against all active colliders.
+     * in the given direction, against all active colliders in the given layers.
      * \param origin The starting point of the ray in world coordinates
      * \param direction The direction of the ray
      * \param maxDistance The max distance the ray should check for collisions
+     * \param layerMask The layers of the colliders the ray can hit
      * \return True when the ray intersects with a collider. False otherwise.
      */
-    bool raycast(const LibMath::Vector3& origin, const LibMath::Vector3& direction, float maxDistance = INFINITY);
+    bool raycast(const LibMath::Vector3& origin, const LibMath::Vector3& direction, float maxDistance = INFINITY,
+                 uint32_t                layerMask = ALL_LAYERS);
 
     /**
      * \brief Checks collisions for a ray of the given length, from the given point,
-     * in the given direction, against all active colliders.
+     * in the given direction, against all active colliders in the given layers.
      * \param origin The starting point of the ray in world coordinates
      * \param direction The direction of the ray
      * \param hitInfo A reference to the object in which the raycast hit information should be output
      * \param maxDistance The max distance the ray should check for collisions
+     * \param layerMask The layers of the colliders the ray can hit
      * \return True when the ray intersects with a collider. False otherwise.
      */
     bool raycast(const LibMath::Vector3& origin, const LibMath::Vector3& direction, RaycastHit& hitInfo,
-                 float                   maxDistance = INFINITY);
+                 float                   maxDistance = INFINITY, uint32_t layerMask = ALL_LAYERS);
+
+    /**
+     * \brief Finds every active collider in the given layers hit by a ray of the given length,
+     * from the given point, in the given direction.
+     * The list is cleared first and its capacity is reused, avoiding allocations for repeated ray casts.
+     * \param origin The starting point of the ray in world coordinates
+     * \param direction The direction of the ray
+     * \param hits The list in which the hits should be stored, sorted from the closest to the farthest
+     * \param maxDistance The max distance the ray should check for collisions
+     * \param layerMask The layers of the colliders the ray can hit
+     * \return The number of hit colliders
+     */
+    size_t raycastAll(const LibMath::Vector3& origin, const LibMath::Vector3& direction, std::vector<RaycastHit>& hits,
+                      float                   maxDistance = INFINITY, uint32_t layerMask = ALL_LAYERS);
+
+    /**
+     * \brief Checks collisions for a batch of rays of the given length against all active colliders in the given layers.
+     * The rays are cast in packets walking the broadphase together and the packets are split
+     * across the thread pool's workers when the service is available.
+     * \param rays The rays to cast. Their directions are normalized before the casts
+     * \param hits The list in which each ray's hit information should be output. Must be as long as the rays list
+     * \param maxDistance The max distance the rays should check for collisions
+     * \param layerMask The layers of the colliders the rays can hit
+     * \return The number of rays which intersect with a collider
+     */
+    size_t raycastBatch(std::span<const Ray> rays, std::span<RaycastHit> hits, float maxDistance = INFINITY,
+                        uint32_t             layerMask = ALL_LAYERS);
 }
@@ -1,10 +1,13 @@
 #pragma once
 #include "Component.h"
+#include "ContactSolver.h"
 #include "ECollisionDetectionMode.h"
 #include "EForceMode.h"
+#include "RigidbodyStorage.h"
 #include "Vector/Vector3.h"
 
 #include <cstdint>
+#include <vector>
 
 namespace LibGL::Physics
 {
@@ -15,37 +18,205 @@ namespace LibGL::Physics
     public:
         inline static LibMath::Vector3 s_gravity{0.f, -9.8f, 0.f};
         inline static float            s_friction = .4f;
-        inline static uint8_t          s_continuousCollisionSteps = 8;
 
-        LibMath::Vector3 m_velocity = LibMath::Vector3::zero();
+        // Time every rigidbody of an island must stay below its sleep threshold before the island falls asleep
+        inline static float s_timeToSleep = .5f;
 
         ECollisionDetectionMode m_collisionDetectionMode = ECollisionDetectionMode::DISCRETE;
         float                   m_sleepThreshold = 0.005f;
-        float                   m_drag = 0.f;
-        float                   m_mass = 1.f;
-        bool                    m_useGravity = true;
-        bool                    m_isKinematic = false;
 
         explicit Rigidbody(Entity& owner);
+        Rigidbody(const Rigidbody& other);
+        Rigidbody(Rigidbody&& other) noexcept;
+        ~Rigidbody() override;
 
-        void update() override;
+        Rigidbody& operator=(const Rigidbody& other);
+        Rigidbody& operator=(Rigidbody&& other) noexcept;
 
         void addForce(const LibMath::Vector3& force, EForceMode forceMode = EForceMode::FORCE);
 
+        /**
+         * \brief Stops the rigidbody until it is woken up, either explicitly or by a moving body's contact
+         */
         void sleep();
 
+        /**
+         * \brief Wakes the rigidbody up, along with the rigidbodies it fell asleep with
+         */
         void wakeUp();
 
         bool isSleeping() const;
 
+        LibMath::Vector3 getVelocity() const;
+        void             setVelocity(const LibMath::Vector3& velocity);
+
         LibMath::Vector3 getDraggedVelocity() const;
 
+        float getMass() const;
+
+        /**
+         * \brief Sets the rigidbody's mass
+         * \param mass The new mass. Must be positive
+         */
+        void setMass(float mass);
+
+        float getDrag() const;
+        void  setDrag(float drag);
+
+        bool isUsingGravity() const;
+        void setUseGravity(bool useGravity);
+
+        bool isKinematic() const;
+        void setKinematic(bool isKinematic);
+
+        /**
+         * \brief Writes the rigidbody's data
+         * \param writer The scene's writer
+         */
+        void serialize(Resources::SceneWriter& writer) const;
+
+        /**
+         * \brief Adds a rigidbody created from the data written by serialize to the given entity
+         * \param owner The rigidbody's owner
+         * \param reader The scene's reader
+         * \return A reference to the created rigidbody
+         */
+        static Rigidbody& deserialize(Entity& owner, Resources::SceneReader& reader);
+
+        /**
+         * \brief Moves every awake rigidbody by the given duration, solving the contacts of each island together.
+         * The colliders' collision and trigger events are sent once the rigidbodies moved
+         * \param deltaTime The step's duration
+         */
+        static void step(float deltaTime);
+
+        /**
+         * \brief Hashes the simulated position, velocity and sleep state of every rigidbody, in storage order.
+         * Used to check that replays of a deterministic build stay bit-identical after each step
+         * \return The rigidbodies' state hash
+         */
+        static uint64_t computeStateHash();
+
     private:
+        friend class PhysicsWorld;
+
+        // Rigidbodies touching each other directly or through other rigidbodies, solved and put to sleep together
+        struct Island
+        {
+            ContactSolver           m_solver;
+            std::vector<Rigidbody*> m_bodies;
+        };
+
+        // A touching manifold of the step, with the rigidbodies owning its colliders. Nullptr for static colliders
+        struct StepContact
+        {
+            ContactManifold* m_manifold;
+            Rigidbody*       m_first;
+            Rigidbody*       m_second;
+        };
+
+        static constexpr uint32_t NOT_STEPPED = UINT32_MAX;
+        static constexpr uint32_t NO_ISLAND = UINT32_MAX;
+
+        // The simulated state of every rigidbody, integrated together during the steps
+        inline static RigidbodyStorage s_storage{};
+
+        inline static std::vector<Island>      s_islands{};
+        inline static std::vector<StepContact> s_stepContacts{};
+        inline static std::vector<uint32_t>    s_islandParents{};
+        inline static std::vector<Rigidbody*>  s_dynamicBodies{};
+        inline static std::vector<uint32_t>    s_rootIslands{};
+        inline static size_t                   s_islandCount = 0;
+        inline static uint32_t                 s_lastSleepingIsland = 0;
+        inline static std::vector<ICollider*>  s_sweepCandidates{};
+
+        // The owner's position before and after the last step, between which the rendered position is interpolated
+        LibMath::Vector3 m_previousPosition = LibMath::Vector3::zero();
+        LibMath::Vector3 m_currentPosition = LibMath::Vector3::zero();
+        LibMath::Vector3 m_interpolatedPosition = LibMath::Vector3::zero();
+
+        // The rigidbody's slot in the storage
+        uint32_t m_storageIndex;
+
+        // The contact pass during which the rigidbody joined the current step. NOT_STEPPED while it doesn't move
+        uint32_t m_stepPass = NOT_STEPPED;
+
+        // The rigidbody's island during a step and its index in the island's solver
+        uint32_t m_islandIndex = NO_ISLAND;
+        uint32_t m_solverIndex = ContactSolver::STATIC_BODY;
+
+        // The island the rigidbody fell asleep with, woken up together. 0 for a rigidbody sleeping alone
+        uint32_t m_sleepingIsland = 0;
+
+        // The time during which the rigidbody stayed below its sleep threshold
+        float m_restTime = 0.f;
+
+        bool m_isKinematic = false;
         bool m_isSleeping = false;
+        bool m_isInterpolated = false;
+
+        /**
+         * \brief Marks the rigidbody as moving during the step and stores its starting position
+         * \param pass The contact pass during which the rigidbody joins the step
+         */
+        void prepareStep(uint32_t pass);
+
+        /**
+         * \brief Stores the solved velocity and displacement of the rigidbody and updates its rest time.
+         * The displacement is applied to the owner once every rigidbody finished the step
+         * \param deltaTime The step's duration
+         */
+        void finishStep(float deltaTime);
+
+        /**
+         * \brief Shortens the given displacement to stop before the first static collider
+         * the rigidbody's colliders would hit, removing the velocity going into that collider
+         * \param displacement The rigidbody's displacement during the step
+         */
+        void stopAtFirstImpact(LibMath::Vector3& displacement);
+
+        /**
+         * \brief Gets the rigidbody whose contacts are handled by the given collider
+         * \param collider The collider whose rigidbody should be returned
+         * \return The collider owner's active rigidbody. Nullptr if there is none
+         */
+        static Rigidbody* getRigidbody(const ICollider& collider);
+
+        /**
+         * \brief Gets the duration over which the forces and the drag applied between two steps act
+         * \return The physics world's fixed step. The default fixed step without a physics world
+         */
+        static float getForceDeltaTime();
+
+        /**
+         * \brief Finds the contacts of the broadphase pairs which joined the step during the given pass.
+         * The sleeping rigidbodies touched by a moving one are woken up with their island and join the next pass
+         * \param pass The current contact pass
+         * \return True if a rigidbody was woken up. False otherwise.
+         */
+        static bool findContacts(uint32_t pass);
+
+        /**
+         * \brief Groups the moving rigidbodies linked by the step's contacts into islands and fills their solvers
+         */
+        static void buildIslands();
+
+        /**
+         * \brief Solves the islands' contacts, in parallel on the thread pool when there is one
+         * \param deltaTime The step's duration
+         */
+        static void solveIslands(float deltaTime);
 
-        void simulate();
-        void move();
+        /**
+         * \brief Moves the interpolated rigidbodies back to their simulated position.
+         * The rigidbodies moved since the interpolation keep their new position
+         */
+        static void restorePositions();
 
-        static LibMath::Vector3 getBoundsNormal(const ICollider& entityCollider, const ICollider& worldCollider);
+        /**
+         * \brief Moves the stepped rigidbodies between their positions before and after the last step
+         * \param ratio The interpolation factor, between 0 for the previous position and 1 for the current one
+         */
+        static void interpolatePositions(float ratio);
     };
 }
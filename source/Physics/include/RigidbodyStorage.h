@@ -0,0 +1,134 @@
+#pragma once
+#include "Vector/Vector3.h"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace LibGL::Physics
+{
+    class Rigidbody;
+
+    /**
+     * \brief The simulated state of every rigidbody, stored per component so a step integrates them all in one pass.
+     * Uses SSE when available and falls back to a loop over the rigidbodies otherwise.
+     */
+    class RigidbodyStorage
+    {
+    public:
+        RigidbodyStorage() = default;
+        RigidbodyStorage(const RigidbodyStorage& other) = default;
+        RigidbodyStorage(RigidbodyStorage&& other) noexcept = default;
+        ~RigidbodyStorage() = default;
+
+        RigidbodyStorage& operator=(const RigidbodyStorage& other) = default;
+        RigidbodyStorage& operator=(RigidbodyStorage&& other) noexcept = default;
+
+        /**
+         * \brief Adds a slot for the given rigidbody, at rest with a unit mass
+         * \param rigidbody The rigidbody whose state should be stored
+         * \return The rigidbody's index
+         */
+        uint32_t add(Rigidbody& rigidbody);
+
+        /**
+         * \brief Removes the given rigidbody's slot, replacing it with the last one
+         * \param index The index of the rigidbody to remove
+         * \return The rigidbody moved to the given index. Nullptr if the removed rigidbody was the last one
+         */
+        Rigidbody* remove(uint32_t index);
+
+        /**
+         * \brief Copies the physical properties of a rigidbody to another one, leaving its step state untouched
+         * \param source The index of the rigidbody to copy
+         * \param destination The index of the rigidbody to overwrite
+         */
+        void copy(uint32_t source, uint32_t destination);
+
+        /**
+         * \brief Gets the stored rigidbodies, ordered by index
+         * \return The stored rigidbodies
+         */
+        std::span<Rigidbody* const> getBodies() const;
+
+        LibMath::Vector3 getPosition(uint32_t index) const;
+        void             setPosition(uint32_t index, const LibMath::Vector3& position);
+
+        LibMath::Vector3 getVelocity(uint32_t index) const;
+        void             setVelocity(uint32_t index, const LibMath::Vector3& velocity);
+
+        LibMath::Vector3 getDisplacement(uint32_t index) const;
+        void             setDisplacement(uint32_t index, const LibMath::Vector3& displacement);
+
+        float getInverseMass(uint32_t index) const;
+        void  setInverseMass(uint32_t index, float inverseMass);
+
+        float getDrag(uint32_t index) const;
+        void  setDrag(uint32_t index, float drag);
+
+        float getGravityScale(uint32_t index) const;
+        void  setGravityScale(uint32_t index, float gravityScale);
+
+        /**
+         * \brief Removes every rigidbody from the current step
+         */
+        void clearStep();
+
+        /**
+         * \brief Adds the given rigidbody to the current step
+         * \param index The index of the rigidbody moving during the step
+         * \param isDynamic Whether gravity and drag should be applied to the rigidbody
+         */
+        void addToStep(uint32_t index, bool isDynamic);
+
+        /**
+         * \brief Applies gravity and drag to the velocity of the step's dynamic rigidbodies
+         * \param gravity The world's gravity
+         * \param deltaTime The step's duration
+         */
+        void integrateVelocities(const LibMath::Vector3& gravity, float deltaTime);
+
+        /**
+         * \brief Computes the displacement of the step's rigidbodies from their velocity.
+         * The other rigidbodies don't move
+         * \param deltaTime The step's duration
+         */
+        void computeDisplacements(float deltaTime);
+
+        /**
+         * \brief Moves every rigidbody by its displacement
+         */
+        void integratePositions();
+
+    private:
+        static constexpr size_t COMPONENT_COUNT = 14;
+
+        std::vector<float> m_positionX;
+        std::vector<float> m_positionY;
+        std::vector<float> m_positionZ;
+        std::vector<float> m_velocityX;
+        std::vector<float> m_velocityY;
+        std::vector<float> m_velocityZ;
+        std::vector<float> m_displacementX;
+        std::vector<float> m_displacementY;
+        std::vector<float> m_displacementZ;
+        std::vector<float> m_inverseMass;
+        std::vector<float> m_drag;
+        std::vector<float> m_gravityScale;
+
+        // 1 for the step's rigidbodies affected by gravity and drag. 0 otherwise
+        std::vector<float> m_dynamicMask;
+
+        // 1 for the step's rigidbodies. 0 otherwise
+        std::vector<float> m_stepMask;
+
+        std::vector<Rigidbody*> m_bodies;
+
+        /**
+         * \brief Gets every per rigidbody component array
+         * \return Pointers to the component arrays
+         */
+        std::array<std::vector<float>*, COMPONENT_COUNT> getComponents();
+    };
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include "CollisionLayers.h"
+#include "Raycast.h"
+#include "Shapes.h"
+
+#include "Vector/Vector3.h"
+
+namespace LibGL::Physics
+{
+    /**
+     * \brief Moves the given sphere along the given direction and finds the first active collider
+     * in the given layers it touches. Colliders already overlapping the sphere are hit at a null distance.
+     * \param sphere The sphere to move, in world space
+     * \param direction The direction in which the sphere moves
+     * \param hitInfo A reference to the object in which the hit information should be output.
+     * The hit position is the point of the collider touched by the sphere
+     * \param maxDistance The max distance the sphere should travel
+     * \param layerMask The layers of the colliders the sphere can hit
+     * \return True when the sphere touches a collider. False otherwise.
+     */
+    bool sphereCast(const SphereShape& sphere, const LibMath::Vector3& direction, RaycastHit& hitInfo,
+                    float              maxDistance = INFINITY, uint32_t layerMask = ALL_LAYERS);
+
+    /**
+     * \brief Moves the given capsule along the given direction and finds the first active collider
+     * in the given layers it touches. Colliders already overlapping the capsule are hit at a null distance.
+     * \param capsule The capsule to move, in world space
+     * \param direction The direction in which the capsule moves
+     * \param hitInfo A reference to the object in which the hit information should be output.
+     * The hit position is the point of the collider touched by the capsule
+     * \param maxDistance The max distance the capsule should travel
+     * \param layerMask The layers of the colliders the capsule can hit
+     * \return True when the capsule touches a collider. False otherwise.
+     */
+    bool capsuleCast(const CapsuleShape& capsule, const LibMath::Vector3& direction, RaycastHit& hitInfo,
+                     float               maxDistance = INFINITY, uint32_t layerMask = ALL_LAYERS);
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include "AABB.h"
+#include "Bounds.h"
+#include "Vector/Vector3.h"
+
+namespace LibGL::Physics
+{
+    /**
+     * \brief World space description of a shape as read by the collision checks
+     */
+    struct WorldShape
+    {
+        Bounds           m_bounds;
+        LibMath::Vector3 m_axis;
+        float            m_radius;
+    };
+
+    struct SphereShape
+    {
+        LibMath::Vector3 m_center;
+        float            m_radius;
+
+        /**
+         * \brief Gets the sphere's bounding data
+         * \return The sphere's bounds
+         */
+        Bounds getBounds() const;
+
+        /**
+         * \brief Gets the sphere's axis aligned bounding box
+         * \return The sphere's bounding box
+         */
+        AABB getAABB() const;
+
+        /**
+         * \brief Gets the sphere's description used by the collision checks
+         * \return The sphere's world shape
+         */
+        WorldShape getWorldShape() const;
+    };
+
+    struct BoxShape
+    {
+        LibMath::Vector3 m_center;
+        LibMath::Vector3 m_size;
+
+        /**
+         * \brief Gets the box's bounding data
+         * \return The box's bounds
+         */
+        Bounds getBounds() const;
+
+        /**
+         * \brief Gets the box's axis aligned bounding box
+         * \return The box's bounding box
+         */
+        AABB getAABB() const;
+
+        /**
+         * \brief Gets the box's description used by the collision checks
+         * \return The box's world shape
+         */
+        WorldShape getWorldShape() const;
+    };
+
+    struct CapsuleShape
+    {
+        LibMath::Vector3 m_center;
+        LibMath::Vector3 m_upDirection;
+        float            m_height;
+        float            m_radius;
+
+        /**
+         * \brief Gets the capsule's bounding data. The height is clamped to the capsule's diameter
+         * \return The capsule's bounds
+         */
+        Bounds getBounds() const;
+
+        /**
+         * \brief Gets the capsule's axis aligned bounding box
+         * \return The capsule's bounding box
+         */
+        AABB getAABB() const;
+
+        /**
+         * \brief Gets the capsule's description used by the collision checks
+         * \return The capsule's world shape
+         */
+        WorldShape getWorldShape() const;
+    };
+    struct TriangleShape
+    {
+        LibMath::Vector3 m_a;
+        LibMath::Vector3 m_b;
+        LibMath::Vector3 m_c;
+
+        /**
+         * \brief Gets the triangle's axis aligned bounding box
+         * \return The triangle's bounding box
+         */
+        AABB getAABB() const;
+
+        /**
+         * \brief Gets the triangle's normal, following the counter-clockwise winding of its vertices
+         * \return The triangle's normalized normal. Zero for degenerate triangles
+         */
+        LibMath::Vector3 getNormal() const;
+    };
+}
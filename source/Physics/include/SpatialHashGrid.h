@@ -0,0 +1,217 @@
+#pragma once
+#include "IBroadphase.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace LibGL::Physics
+{
+    /**
+     * \brief Broadphase bucketing the proxies' boxes in a uniform grid of cubic cells stored in a hash map.
+     * Moving a proxy only updates the cells it entered or left, which suits crowds of similarly sized dynamic colliders.
+     * Proxies covering too many cells are kept in a separate list checked by every query.
+     */
+    class SpatialHashGrid final : public IBroadphase
+    {
+    public:
+        /**
+         * \brief Creates an empty spatial hash grid
+         * \param cellSize The size of the grid's cells. Chosen from the average proxy size when null or negative
+         * \param margin The distance by which the proxies' boxes are enlarged on each side
+         */
+        explicit SpatialHashGrid(float cellSize = 0.f, float margin = .1f);
+
+        SpatialHashGrid(const SpatialHashGrid& other) = default;
+        SpatialHashGrid(SpatialHashGrid&& other) noexcept = default;
+        ~SpatialHashGrid() override = default;
+
+        SpatialHashGrid& operator=(const SpatialHashGrid& other) = default;
+        SpatialHashGrid& operator=(SpatialHashGrid&& other) noexcept = default;
+
+        /**
+         * \brief Adds a proxy for the given collider to the cells overlapped by its fat box
+         * \param bounds The collider's world space bounding box
+         * \param collider The collider represented by the proxy
+         * \return The id of the created proxy
+         */
+        int32_t createProxy(const AABB& bounds, ICollider* collider) override;
+
+        /**
+         * \brief Removes the given proxy from its cells
+         * \param proxyId The proxy to remove
+         */
+        void destroyProxy(int32_t proxyId) override;
+
+        /**
+         * \brief Updates the given proxy's bounds, moving it to the cells it entered if it left its fat box
+         * \param proxyId The proxy to update
+         * \param bounds The proxy's new world space bounding box
+         * \return True if the proxy's fat box changed. False otherwise.
+         */
+        bool moveProxy(int32_t proxyId, const AABB& bounds) override;
+
+        /**
+         * \brief Gets the collider represented by the given proxy
+         * \param proxyId The proxy whose collider should be returned
+         * \return The proxy's collider
+         */
+        ICollider* getCollider(int32_t proxyId) const override;
+
+        /**
+         * \brief Gets the enlarged bounding box stored for the given proxy
+         * \param proxyId The proxy whose bounds should be returned
+         * \return The proxy's fat bounding box
+         */
+        const AABB& getFatBounds(int32_t proxyId) const override;
+
+        /**
+         * \brief Appends the colliders whose fat box overlaps the given box to the given list
+         * \param bounds The box to check against
+         * \param colliders The list to which the overlapping colliders should be added
+         */
+        void query(const AABB& bounds, std::vector<ICollider*>& colliders) const override;
+
+        /**
+         * \brief Calls the given function for each collider whose fat box is hit by the given ray segment.
+         * The cells are walked in the ray's order, stopping at the callback's max distance.
+         * \param origin The ray's origin
+         * \param direction The ray's normalized direction
+         * \param maxDistance The length of the ray segment
+         * \param callback The function to call for each hit collider
+         */
+        void raycast(const LibMath::Vector3& origin, const LibMath::Vector3& direction, float maxDistance,
+                     const RaycastCallback&  callback) const override;
+
+        /**
+         * \brief Gets the number of proxies in the grid
+         * \return The grid's proxy count
+         */
+        size_t getProxyCount() const override;
+
+        /**
+         * \brief Checks whether the grid's queries and ray casts can run on several threads at once
+         * \return False since the queries stamp the visited proxies
+         */
+        bool canQueryConcurrently() const override;
+
+        /**
+         * \brief Gets the size of the grid's cells
+         * \return The grid's current cell size
+         */
+        float getCellSize() const;
+
+    private:
+        // Proxies covering more cells are stored in the large proxies list instead
+        static constexpr int64_t MAX_PROXY_CELLS = 64;
+
+        struct CellCoord
+        {
+            int32_t m_x;
+            int32_t m_y;
+            int32_t m_z;
+
+            bool operator==(const CellCoord& other) const = default;
+        };
+
+        struct CellHash
+        {
+            size_t operator()(const CellCoord& cell) const;
+        };
+
+        struct Proxy
+        {
+            AABB       m_bounds;
+            ICollider* m_collider = nullptr;
+            CellCoord  m_minCell{};
+            CellCoord  m_maxCell{};
+
+            // The last query which visited the proxy, used to report proxies spanning several cells once
+            mutable uint32_t m_queryStamp = 0;
+
+            int32_t m_nextFree = NULL_PROXY;
+            bool    m_isLarge = false;
+        };
+
+        using CellMap = std::unordered_map<CellCoord, std::vector<int32_t>, CellHash>;
+
+        CellMap              m_cells;
+        std::vector<Proxy>   m_proxies;
+        std::vector<int32_t> m_largeProxies;
+        CellCoord            m_minOccupiedCell{};
+        CellCoord            m_maxOccupiedCell{};
+        int32_t              m_freeList = NULL_PROXY;
+        size_t               m_proxyCount = 0;
+        float                m_sizeSum = 0.f;
+        float                m_cellSize;
+        bool                 m_isAutoCellSize;
+        mutable uint32_t     m_queryStamp = 0;
+
+        /**
+         * \brief Adds the given proxy to the cells overlapped by its fat box,
+         * or to the large proxies if it covers too many cells
+         * \param proxyId The proxy to insert
+         */
+        void insertInCells(int32_t proxyId);
+
+        /**
+         * \brief Removes the given proxy from the cells it is stored in
+         * \param proxyId The proxy to remove
+         */
+        void removeFromCells(int32_t proxyId);
+
+        /**
+         * \brief Adds the given proxy to the given cell, growing the occupied range if needed
+         * \param cell The cell to add the proxy to
+         * \param proxyId The proxy to add
+         */
+        void addToCell(const CellCoord& cell, int32_t proxyId);
+
+        /**
+         * \brief Removes the given proxy from the given cell, erasing the cell once it is empty
+         * \param cell The cell to remove the proxy from
+         * \param proxyId The proxy to remove
+         */
+        void removeFromCell(const CellCoord& cell, int32_t proxyId);
+
+        /**
+         * \brief Picks a new cell size from the average proxy size if it drifted too far from the current one
+         * and reinserts every proxy in the resized cells
+         */
+        void updateCellSize();
+
+        /**
+         * \brief Checks the given proxy against the given ray and notifies the callback on hit
+         * \param proxyId The proxy to check
+         * \param queryStamp The current ray cast's stamp, used to skip the already checked proxies
+         * \param origin The ray's origin
+         * \param direction The ray's normalized direction
+         * \param maxDistance The current length of the ray segment, updated by the callback
+         * \param callback The function to call if the proxy is hit
+         * \return False if the callback stopped the ray cast. True otherwise.
+         */
+        bool raycastProxy(int32_t                 proxyId, uint32_t queryStamp, const LibMath::Vector3& origin,
+                          const LibMath::Vector3& direction, float& maxDistance,
+                          const RaycastCallback&  callback) const;
+
+        /**
+         * \brief Starts a new query, making sure no proxy already holds the returned stamp
+         * \return The new query's stamp
+         */
+        uint32_t nextQueryStamp() const;
+
+        /**
+         * \brief Gets the coordinates of the cell containing the given position
+         * \param position The position whose cell should be returned
+         * \return The position's cell coordinates
+         */
+        CellCoord getCell(const LibMath::Vector3& position) const;
+
+        /**
+         * \brief Gets the largest dimension of the given box
+         * \param bounds The box whose size should be returned
+         * \return The box's largest dimension
+         */
+        static float getSize(const AABB& bounds);
+    };
+}
@@ -15,6 +15,8 @@ namespace LibGL::Physics
     class SphereCollider final : public ICollider
     {
     public:
+        using ICollider::check;
+
         SphereCollider(Entity& owner, const LibMath::Vector3& center, float radius);
 
         /**
@@ -33,11 +35,25 @@ namespace LibGL::Physics
         bool check(const Ray& ray, float& distanceSqr) const override;
 
         /**
-         * \brief Checks if a given collider is colliding with the sphere collider.
-         * \param other The collider to check collision for.
-         * \return True if the collider is colliding with the sphere collider. False otherwise.
+         * \brief Checks if a given world space sphere is colliding with the sphere collider.
+         * \param sphere The sphere to check collision for.
+         * \return True if the sphere is colliding with the sphere collider. False otherwise.
+         */
+        bool check(const SphereShape& sphere) const override;
+
+        /**
+         * \brief Checks if a given world space box is colliding with the sphere collider.
+         * \param box The box to check collision for.
+         * \return True if the box is colliding with the sphere collider. False otherwise.
+         */
+        bool check(const BoxShape& box) const override;
+
+        /**
+         * \brief Checks if a given world space capsule is colliding with the sphere collider.
+         * \param capsule The capsule to check collision for.
+         * \return True if the capsule is colliding with the sphere collider. False otherwise.
          */
-        bool check(const ICollider& other) const override;
+        bool check(const CapsuleShape& capsule) const override;
 
         /**
          * \brief Checks if a given box collider is colliding with the sphere collider.
@@ -74,6 +90,20 @@ namespace LibGL::Physics
          */
         LibMath::Vector3 getClosestPointOnSurface(const LibMath::Vector3& point) const override;
 
+        /**
+         * \brief Writes the collider's data
+         * \param writer The scene's writer
+         */
+        void serialize(Resources::SceneWriter& writer) const;
+
+        /**
+         * \brief Adds a sphere collider created from the data written by serialize to the given entity
+         * \param owner The collider's owner
+         * \param reader The scene's reader
+         * \return A reference to the created collider
+         */
+        static SphereCollider& deserialize(Entity& owner, Resources::SceneReader& reader);
+
     private:
         LibMath::Vector3 m_center;
         float            m_radius;
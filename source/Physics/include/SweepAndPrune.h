@@ -0,0 +1,169 @@
+#pragma once
+#include "IBroadphase.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace LibGL::Physics
+{
+    /**
+     * \brief Broadphase keeping the proxies' box bounds sorted along the world axes.
+     * Moving a proxy only swaps its bounds with its neighbours', each swap beginning or ending a pair,
+     * which makes it cheap for mostly static scenes with temporal coherence.
+     */
+    class SweepAndPrune final : public IBroadphase
+    {
+    public:
+        /**
+         * \brief Creates an empty sweep and prune broadphase
+         * \param axisCount The number of sorted axes. With a single (X) axis, pairs only require their X intervals
+         * to overlap which makes the updates cheaper but the pairs looser.
+         * \param margin The distance by which the proxies' boxes are enlarged on each side
+         */
+        explicit SweepAndPrune(uint8_t axisCount = 3, float margin = .1f);
+
+        SweepAndPrune(const SweepAndPrune& other) = default;
+        SweepAndPrune(SweepAndPrune&& other) noexcept = default;
+        ~SweepAndPrune() override = default;
+
+        SweepAndPrune& operator=(const SweepAndPrune& other) = default;
+        SweepAndPrune& operator=(SweepAndPrune&& other) noexcept = default;
+
+        /**
+         * \brief Inserts the bounds of a proxy for the given collider in the sorted lists
+         * \param bounds The collider's world space bounding box
+         * \param collider The collider represented by the proxy
+         * \return The id of the created proxy
+         */
+        int32_t createProxy(const AABB& bounds, ICollider* collider) override;
+
+        /**
+         * \brief Removes the given proxy's bounds from the sorted lists
+         * \param proxyId The proxy to remove
+         */
+        void destroyProxy(int32_t proxyId) override;
+
+        /**
+         * \brief Updates the given proxy's bounds, sorting them again if it left its fat box
+         * \param proxyId The proxy to update
+         * \param bounds The proxy's new world space bounding box
+         * \return True if the proxy's fat box changed. False otherwise.
+         */
+        bool moveProxy(int32_t proxyId, const AABB& bounds) override;
+
+        /**
+         * \brief Gets the collider represented by the given proxy
+         * \param proxyId The proxy whose collider should be returned
+         * \return The proxy's collider
+         */
+        ICollider* getCollider(int32_t proxyId) const override;
+
+        /**
+         * \brief Gets the enlarged bounding box stored for the given proxy
+         * \param proxyId The proxy whose bounds should be returned
+         * \return The proxy's fat bounding box
+         */
+        const AABB& getFatBounds(int32_t proxyId) const override;
+
+        /**
+         * \brief Appends the colliders whose fat box overlaps the given box to the given list
+         * \param bounds The box to check against
+         * \param colliders The list to which the overlapping colliders should be added
+         */
+        void query(const AABB& bounds, std::vector<ICollider*>& colliders) const override;
+
+        /**
+         * \brief Calls the given function for each collider whose fat box is hit by the given ray segment.
+         * Only the proxies within the segment's X range are checked, or all of them for infinite rays.
+         * \param origin The ray's origin
+         * \param direction The ray's normalized direction
+         * \param maxDistance The length of the ray segment
+         * \param callback The function to call for each hit collider
+         */
+        void raycast(const LibMath::Vector3& origin, const LibMath::Vector3& direction, float maxDistance,
+                     const RaycastCallback&  callback) const override;
+
+        /**
+         * \brief Gets the number of proxies in the broadphase
+         * \return The broadphase's proxy count
+         */
+        size_t getProxyCount() const override;
+
+    private:
+        static constexpr uint8_t MAX_AXES = 3;
+
+        struct Endpoint
+        {
+            float   m_value;
+            int32_t m_proxyId;
+            bool    m_isMax;
+
+            bool operator<(const Endpoint& other) const;
+        };
+
+        struct Proxy
+        {
+            AABB       m_bounds;
+            ICollider* m_collider = nullptr;
+
+            // Indices of the proxy's bounds in each axis' endpoints. The next free proxy when the proxy isn't used
+            std::array<uint32_t, MAX_AXES> m_min{};
+            std::array<uint32_t, MAX_AXES> m_max{};
+            int32_t                        m_nextFree = NULL_PROXY;
+        };
+
+        std::array<std::vector<Endpoint>, MAX_AXES> m_endpoints;
+        std::vector<Proxy>                          m_proxies;
+        int32_t                                     m_freeList = NULL_PROXY;
+        size_t                                      m_proxyCount = 0;
+        float                                       m_maxSizeX = 0.f;
+        uint8_t                                     m_axisCount;
+
+        /**
+         * \brief Moves the given endpoint towards the start of its axis until it is sorted,
+         * updating the pairs of the proxies whose bounds it crosses
+         * \param axis The endpoint's axis
+         * \param index The endpoint's index
+         */
+        void sortDown(uint8_t axis, uint32_t index);
+
+        /**
+         * \brief Moves the given endpoint towards the end of its axis until it is sorted,
+         * updating the pairs of the proxies whose bounds it crosses
+         * \param axis The endpoint's axis
+         * \param index The endpoint's index
+         */
+        void sortUp(uint8_t axis, uint32_t index);
+
+        /**
+         * \brief Swaps the given endpoint with the next one on the same axis
+         * \param axis The endpoints' axis
+         * \param index The index of the first endpoint
+         */
+        void swapEndpoints(uint8_t axis, uint32_t index);
+
+        /**
+         * \brief Updates the stored index of the given endpoint in its proxy
+         * \param axis The endpoint's axis
+         * \param index The endpoint's index
+         */
+        void updateEndpointIndex(uint8_t axis, uint32_t index);
+
+        /**
+         * \brief Checks whether the given proxies overlap on all the sorted axes except the given one
+         * \param first The first proxy
+         * \param second The second proxy
+         * \param skippedAxis The axis on which the overlap is already known
+         * \return True if the proxies overlap on the other sorted axes. False otherwise.
+         */
+        bool overlapsOnOtherAxes(int32_t first, int32_t second, uint8_t skippedAxis) const;
+
+        /**
+         * \brief Finds the first X endpoint from which the proxies overlapping the given X value should be searched
+         * \param minX The start of the searched interval
+         * \return The index of the first X endpoint which can belong to an overlapping proxy
+         */
+        uint32_t findFirstX(float minX) const;
+    };
+}
@@ -0,0 +1,174 @@
+#pragma once
+#include "AABB.h"
+#include "Shapes.h"
+#include "Vector/Vector3.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace LibGL::Utility
+{
+    class BinaryReader;
+    class BinaryWriter;
+}
+
+namespace LibGL::Physics
+{
+    /**
+     * \brief Static triangles indexed by a bounding volume hierarchy built once using the surface area heuristic.
+     * The nodes are stored depth first in a single array, each inner node's first child directly following it,
+     * and the triangles are reordered so each leaf references a contiguous range of them.
+     * Meant to be shared by every collider using the same geometry.
+     */
+    class TriangleMesh
+    {
+    public:
+        static constexpr uint32_t MAX_LEAF_TRIANGLES = 4;
+        static constexpr uint32_t SAH_BIN_COUNT = 12;
+
+        // Nodes deeper than the SAH depth are split at the median, which bounds the tree's depth
+        static constexpr uint32_t MAX_SAH_DEPTH = 32;
+        static constexpr uint32_t MAX_DEPTH = MAX_SAH_DEPTH + 32;
+
+        struct Node
+        {
+            AABB m_bounds;
+
+            // The index of the second child for inner nodes, of the first triangle for leaves
+            uint32_t m_offset;
+
+            // The number of triangles of the leaf. 0 for inner nodes
+            uint16_t m_triangleCount;
+
+            // The axis along which the children are split, used to visit the closest child first
+            uint8_t m_splitAxis;
+        };
+
+        /**
+         * \brief Creates a mesh from the given triangles and builds its hierarchy
+         * \param positions The mesh's vertex positions
+         * \param indices The vertex indices of the mesh's triangles, three per triangle
+         */
+        TriangleMesh(std::vector<LibMath::Vector3> positions, std::vector<uint32_t> indices);
+
+        TriangleMesh(const TriangleMesh& other) = default;
+        TriangleMesh(TriangleMesh&& other) noexcept = default;
+        ~TriangleMesh() = default;
+
+        TriangleMesh& operator=(const TriangleMesh& other) = default;
+        TriangleMesh& operator=(TriangleMesh&& other) noexcept = default;
+
+        /**
+         * \brief Creates a mesh from a render mesh's vertex and index buffers
+         * \tparam TVertex The vertex type, whose position is stored in its m_position member
+         * \param vertices The mesh's vertices
+         * \param indices The vertex indices of the mesh's triangles, three per triangle
+         * \return The created mesh
+         */
+        template <typename TVertex>
+        static TriangleMesh fromVertices(std::span<const TVertex> vertices, std::span<const uint32_t> indices);
+
+        /**
+         * \brief Gets the number of triangles in the mesh
+         * \return The mesh's triangle count
+         */
+        size_t getTriangleCount() const;
+
+        /**
+         * \brief Gets the given triangle, in the order of the hierarchy's leaves
+         * \param index The triangle's index
+         * \return The triangle's vertices
+         */
+        TriangleShape getTriangle(uint32_t index) const;
+
+        /**
+         * \brief Gets the box containing the whole mesh
+         * \return The mesh's bounding box
+         */
+        AABB getBounds() const;
+
+        /**
+         * \brief Gets the hierarchy's nodes, the root being the first one
+         * \return The mesh's nodes
+         */
+        std::span<const Node> getNodes() const;
+
+        /**
+         * \brief Finds the closest triangle hit by the given ray segment
+         * \param origin The ray's origin
+         * \param direction The ray's direction. Doesn't need to be normalized
+         * \param maxDistance The length of the ray segment, in multiples of the direction's length
+         * \param distance The hit's distance from the origin, in multiples of the direction's length
+         * \param triangleIndex The index of the hit triangle
+         * \return True if a triangle is hit within the max distance. False otherwise.
+         */
+        bool raycast(const LibMath::Vector3& origin, const LibMath::Vector3& direction, float maxDistance,
+                     float& distance, uint32_t& triangleIndex) const;
+
+        /**
+         * \brief Calls the given function for each triangle whose box overlaps the given one
+         * \param bounds The box to check against
+         * \param callback The function to call with each overlapping triangle's index. Returns true to stop the query
+         * \return True if the query was stopped by the callback. False otherwise.
+         */
+        template <typename Func>
+        bool query(const AABB& bounds, Func&& callback) const;
+
+        /**
+         * \brief Finds the point of the mesh's surface closest to the given position
+         * \param point The point of which we want the closest point on the mesh
+         * \param triangleIndex The index of the triangle containing the closest point
+         * \return The closest point on the mesh. The given point if the mesh is empty
+         */
+        LibMath::Vector3 getClosestPoint(const LibMath::Vector3& point, uint32_t& triangleIndex) const;
+
+        /**
+         * \brief Writes the mesh's triangles and hierarchy
+         * \param writer The writer to write to
+         */
+        void serialize(Utility::BinaryWriter& writer) const;
+
+        /**
+         * \brief Reads a mesh written by serialize, without rebuilding its hierarchy
+         * \param reader The reader to read from
+         * \return The read mesh. Empty if the data is invalid
+         */
+        static TriangleMesh deserialize(Utility::BinaryReader& reader);
+
+    private:
+        std::vector<LibMath::Vector3> m_positions;
+        std::vector<uint32_t>         m_indices;
+        std::vector<Node>             m_nodes;
+
+        TriangleMesh() = default;
+
+        /**
+         * \brief Creates the node covering the given range of triangles and its children
+         * \param order The triangles' indices, reordered so each leaf references a contiguous range
+         * \param centroids The centroid of each triangle, indexed by the triangles' original index
+         * \param bounds The bounding box of each triangle, indexed by the triangles' original index
+         * \param first The index of the node's first triangle in the order
+         * \param count The number of triangles in the node
+         * \param depth The node's depth in the hierarchy
+         */
+        void buildNode(std::vector<uint32_t>& order, const std::vector<LibMath::Vector3>& centroids,
+                       const std::vector<AABB>& bounds, uint32_t first, uint32_t count, uint32_t depth);
+
+        /**
+         * \brief Checks whether the nodes and indices only reference existing triangles and vertices
+         * \return True if the mesh can be safely queried. False otherwise.
+         */
+        bool isValid() const;
+
+        /**
+         * \brief Computes the squared distance from the given point to the given box
+         * \param box The box to check against
+         * \param point The point to check
+         * \return The squared distance to the box. 0 if the point is inside it
+         */
+        static float getDistanceSquared(const AABB& box, const LibMath::Vector3& point);
+    };
+}
+
+#include "TriangleMesh.inl"
@@ -0,0 +1,57 @@
+#pragma once
+#include "TriangleMesh.h"
+
+#include <array>
+#include <utility>
+
+namespace LibGL::Physics
+{
+    template <typename TVertex>
+    TriangleMesh TriangleMesh::fromVertices(const std::span<const TVertex> vertices,
+                                            const std::span<const uint32_t> indices)
+    {
+        std::vector<LibMath::Vector3> positions;
+        positions.reserve(vertices.size());
+
+        for (const TVertex& vertex : vertices)
+            positions.push_back(vertex.m_position);
+
+        return { std::move(positions), std::vector<uint32_t>(indices.begin(), indices.end()) };
+    }
+
+    template <typename Func>
+    bool TriangleMesh::query(const AABB& bounds, Func&& callback) const
+    {
+        if (m_nodes.empty())
+            return false;
+
+        std::array<uint32_t, MAX_DEPTH + 1> stack;
+        size_t                              stackSize = 0;
+
+        stack[stackSize++] = 0;
+
+        while (stackSize > 0)
+        {
+            const uint32_t nodeIndex = stack[--stackSize];
+            const Node&    node = m_nodes[nodeIndex];
+
+            if (!node.m_bounds.overlaps(bounds))
+                continue;
+
+            if (node.m_triangleCount == 0)
+            {
+                stack[stackSize++] = node.m_offset;
+                stack[stackSize++] = nodeIndex + 1;
+                continue;
+            }
+
+            for (uint32_t i = node.m_offset; i < node.m_offset + node.m_triangleCount; ++i)
+            {
+                if (getTriangle(i).getAABB().overlaps(bounds) && callback(i))
+                    return true;
+            }
+        }
+
+        return false;
+    }
+}
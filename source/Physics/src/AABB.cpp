@@ -0,0 +1,109 @@
+#include "AABB.h"
+
+#include "Arithmetic.h"
+
+#include <utility>
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+    AABB AABB::fromCenter(const Vector3& center, const Vector3& halfSize)
+    {
+        return { center - halfSize, center + halfSize };
+    }
+
+    bool AABB::overlaps(const AABB& other) const
+    {
+        return m_min.m_x <= other.m_max.m_x && m_max.m_x >= other.m_min.m_x &&
+            m_min.m_y <= other.m_max.m_y && m_max.m_y >= other.m_min.m_y &&
+            m_min.m_z <= other.m_max.m_z && m_max.m_z >= other.m_min.m_z;
+    }
+
+    bool AABB::contains(const AABB& other) const
+    {
+        return m_min.m_x <= other.m_min.m_x && m_max.m_x >= other.m_max.m_x &&
+            m_min.m_y <= other.m_min.m_y && m_max.m_y >= other.m_max.m_y &&
+            m_min.m_z <= other.m_min.m_z && m_max.m_z >= other.m_max.m_z;
+    }
+
+    AABB AABB::merged(const AABB& other) const
+    {
+        return
+        {
+            { min(m_min.m_x, other.m_min.m_x), min(m_min.m_y, other.m_min.m_y), min(m_min.m_z, other.m_min.m_z) },
+            { max(m_max.m_x, other.m_max.m_x), max(m_max.m_y, other.m_max.m_y), max(m_max.m_z, other.m_max.m_z) }
+        };
+    }
+
+    AABB AABB::expanded(const float margin) const
+    {
+        return { m_min - Vector3(margin), m_max + Vector3(margin) };
+    }
+
+    AABB AABB::expanded(const Vector3& halfSize) const
+    {
+        return { m_min - halfSize, m_max + halfSize };
+    }
+
+    AABB AABB::swept(const Vector3& direction, const float distance) const
+    {
+        AABB result = *this;
+
+        for (int i = 0; i < 3; i++)
+        {
+            // Avoid multiplying an infinite distance by a null direction
+            if (floatEquals(direction[i], 0.f))
+                continue;
+
+            const float offset = direction[i] * distance;
+
+            if (offset < 0.f)
+                result.m_min[i] += offset;
+            else
+                result.m_max[i] += offset;
+        }
+
+        return result;
+    }
+
+    float AABB::getSurfaceArea() const
+    {
+        const Vector3 size = m_max - m_min;
+        return 2.f * (size.m_x * size.m_y + size.m_y * size.m_z + size.m_z * size.m_x);
+    }
+
+    bool AABB::raycast(const Vector3& origin, const Vector3& direction, const float maxDistance, float& distance) const
+    {
+        float distMin = 0.f;
+        float distMax = maxDistance;
+
+        for (int i = 0; i < 3; i++)
+        {
+            // A ray parallel to the slab only hits it if its origin is between the two planes
+            if (floatEquals(direction[i], 0.f))
+            {
+                if (origin[i] < m_min[i] || origin[i] > m_max[i])
+                    return false;
+
+                continue;
+            }
+
+            const float inverseDir = 1.f / direction[i];
+            float       distNear = (m_min[i] - origin[i]) * inverseDir;
+            float       distFar = (m_max[i] - origin[i]) * inverseDir;
+
+            if (distNear > distFar)
+                std::swap(distNear, distFar);
+
+            distMin = max(distMin, distNear);
+            distMax = min(distMax, distFar);
+
+            if (distMin > distMax)
+                return false;
+        }
+
+        distance = distMin;
+        return true;
+    }
+}
@@ -3,8 +3,9 @@
 #include "Arithmetic.h"
 #include "BoxCollider.h"
 #include "Entity.h"
+#include "Narrowphase.h"
 #include "SphereCollider.h"
-#include "Debug/Log.h"
+#include "SceneSerializer.h"
 #include "Matrix/Matrix4.h"
 #include "Vector/Vector4.h"
 
@@ -12,9 +13,12 @@ using namespace LibMath;
 
 namespace LibGL::Physics
 {
+    REGISTER_COMPONENT_TYPE(CapsuleCollider);
+
     CapsuleCollider::CapsuleCollider(Entity&     owner, const Vector3& center, const Vector3& upDir, const float height,
                                      const float radius)
-        : ICollider(owner, calculateBounds(center, upDir.normalized(), max(height, radius * 2.f), radius)),
+        : ICollider(owner, calculateBounds(center, upDir.normalized(), max(height, radius * 2.f), radius),
+            EShapeType::CAPSULE),
         m_center(center), m_upDirection(upDir.normalized()), m_height(max(height, radius * 2.f)),
         m_radius(radius)
     {
@@ -22,7 +26,7 @@ namespace LibGL::Physics
 
     Vector3 CapsuleCollider::getUpDirection() const
     {
-        return (getOwner().getWorldMatrix() * Vector4(m_upDirection, 0.f)).xyz();
+        return getWorldAxis();
     }
 
     float CapsuleCollider::getHeight() const
@@ -32,31 +36,12 @@ namespace LibGL::Physics
 
     float CapsuleCollider::getRadius() const
     {
-        const auto ownerScale = getOwner().getWorldScale();
-
-        const Matrix4 rotationMat = rotationFromTo(Vector3::up(), m_upDirection);
-        const Vector3 rightScale = (rotationMat * Vector4::right()).xyz() * ownerScale;
-        const Vector3 frontScale = (rotationMat * Vector4::front()).xyz() * ownerScale;
-
-        return (rightScale.isLongerThan(frontScale) ? rightScale : frontScale).magnitude() * m_radius;
+        return getWorldRadius();
     }
 
     bool CapsuleCollider::check(const Vector3& point) const
     {
-        // Check the bounding spheres first to avoid unnecessary computation
-        if (!ICollider::check(point))
-            return false;
-
-        const auto [center, _, halfHeight] = getBounds();
-        const auto radius = getRadius();
-        const auto orientedHeight = getUpDirection() * (halfHeight - radius) * 2.f;
-
-        // Get the closest point on the capsule's center segment
-        const Vector3 closestPoint = getClosestPointOnSegment(point,
-            orientedHeight / 2.f - center,
-            orientedHeight / 2.f + center);
-
-        return point.distanceSquaredFrom(closestPoint) <= radius * radius;
+        return checkCapsulePoint(getWorldShape(), point);
     }
 
     bool CapsuleCollider::check(const Ray& ray, float& distanceSqr) const
@@ -80,70 +65,56 @@ namespace LibGL::Physics
         rayClosest = ray.getClosestPoint(capsuleClosest);
 
         const bool colliding = rayClosest.distanceSquaredFrom(center) <= radius * radius;
-        distanceSqr = colliding ? rayClosest.distanceFrom(ray.m_origin) : INFINITY;
+        distanceSqr = colliding ? rayClosest.distanceSquaredFrom(ray.m_origin) : INFINITY;
         return colliding;
     }
 
-    bool CapsuleCollider::check(const ICollider& other) const
-    {
-        const auto otherTypeHash = typeid(other).hash_code();
-
-        if (otherTypeHash == typeid(BoxCollider).hash_code())
-            return checkBox(dynamic_cast<const BoxCollider&>(other));
-
-        if (otherTypeHash == typeid(SphereCollider).hash_code())
-            return checkSphere(dynamic_cast<const SphereCollider&>(other));
-
-        if (otherTypeHash == typeid(CapsuleCollider).hash_code())
-            return checkCapsule(dynamic_cast<const CapsuleCollider&>(other));
-
-        DEBUG_LOG("WARNING: collisions between 'CapsuleCollider' and '%s' are not supported.\n", typeid(other).name());
-        return false;
-    }
-
     bool CapsuleCollider::checkBox(const BoxCollider& other) const
     {
-        return other.checkCapsule(*this);
+        return checkBoxCapsule(other.getWorldShape(), getWorldShape());
     }
 
     bool CapsuleCollider::checkSphere(const SphereCollider& other) const
     {
-        return other.checkCapsule(*this);
+        return checkSphereCapsule(other.getWorldShape(), getWorldShape());
     }
 
     bool CapsuleCollider::checkCapsule(const CapsuleCollider& other) const
     {
-        // Check the bounding spheres first to avoid unnecessary computation
-        if (!ICollider::check(other))
-            return false;
-
-        const auto  [center, _, halfHeight] = getBounds();
-        const float radius = getRadius();
-        const auto  orientedHeight = getUpDirection() * (halfHeight - radius) * 2.f;
-
-        const auto  [otherCenter, _o, otherHalfHeight] = other.getBounds();
-        const float otherRadius = other.getRadius();
-        const auto  otherOrientedHeight = other.getUpDirection() * (otherHalfHeight - otherRadius) * 2.f;
-
-        const float totalRadius = radius + otherRadius;
+        return checkCapsuleCapsule(getWorldShape(), other.getWorldShape());
+    }
 
-        const Ray ray = { center, getUpDirection() };
-        const Ray otherRay = { otherCenter, other.getUpDirection() };
+    bool CapsuleCollider::check(const SphereShape& sphere) const
+    {
+        return checkSphereCapsule(sphere.getWorldShape(), getWorldShape());
+    }
 
-        auto [closest, otherClosest] = ray.getClosestPoints(otherRay);
+    bool CapsuleCollider::check(const BoxShape& box) const
+    {
+        return checkBoxCapsule(box.getWorldShape(), getWorldShape());
+    }
 
-        closest = getClosestPointOnSegment(closest,
-            center - orientedHeight / 2.f,
-            center + orientedHeight / 2.f);
+    bool CapsuleCollider::check(const CapsuleShape& capsule) const
+    {
+        return checkCapsuleCapsule(getWorldShape(), capsule.getWorldShape());
+    }
 
-        otherClosest = getClosestPointOnSegment(closest,
-            otherCenter - otherOrientedHeight / 2.f,
-            otherCenter + otherOrientedHeight / 2.f);
+    Vector3 CapsuleCollider::getSupportPoint(const Vector3& direction) const
+    {
+        return getCapsuleSupportPoint(getWorldShape(), direction);
+    }
 
-        return closest.distanceSquaredFrom(otherClosest) <= totalRadius * totalRadius;
+    float CapsuleCollider::getSupportRadius() const
+    {
+        return getWorldRadius();
     }
 
     Vector3 CapsuleCollider::getClosestPoint(const Vector3& point) const
+    {
+        return getClosestPointOnCapsule(getWorldShape(), point);
+    }
+
+    Vector3 CapsuleCollider::getClosestPointOnSurface(const Vector3& point) const
     {
         const auto  [center, _, halfHeight] = getBounds();
         const float radius = getRadius();
@@ -154,34 +125,49 @@ namespace LibGL::Physics
 
         const Vector3 centerPoint = getClosestPointOnSegment(point, base, tip);
 
-        return centerPoint + (point - centerPoint).normalized() * min(radius, centerPoint.distanceFrom(point));
+        return centerPoint + (point - centerPoint).normalized() * radius;
     }
 
-    Vector3 CapsuleCollider::getClosestPointOnSurface(const Vector3& point) const
+    float CapsuleCollider::computeWorldRadius(const Bounds&) const
     {
-        const auto  [center, _, halfHeight] = getBounds();
-        const float radius = getRadius();
+        const auto ownerScale = getOwner().getWorldScale();
 
-        const Vector3 offset = getUpDirection() * (halfHeight - radius);
-        const Vector3 base = center - offset;
-        const Vector3 tip = center + offset;
+        const Matrix4 rotationMat = rotationFromTo(Vector3::up(), m_upDirection);
+        const Vector3 rightScale = (rotationMat * Vector4::right()).xyz() * ownerScale;
+        const Vector3 frontScale = (rotationMat * Vector4::front()).xyz() * ownerScale;
 
-        const Vector3 centerPoint = getClosestPointOnSegment(point, base, tip);
+        return (rightScale.isLongerThan(frontScale) ? rightScale : frontScale).magnitude() * m_radius;
+    }
 
-        return centerPoint + (point - centerPoint).normalized() * radius;
+    Vector3 CapsuleCollider::computeWorldAxis() const
+    {
+        return (getOwner().getWorldMatrix() * Vector4(m_upDirection, 0.f)).xyz();
     }
 
     Bounds CapsuleCollider::calculateBounds(const Vector3& center, const Vector3& upDir, const float height, const float radius)
     {
-        const Matrix4 rotationMat = rotationFromTo(Vector3::up(), upDir);
-        const Vector3 rightDir = (rotationMat * Vector4::right()).xyz();
-        const Vector3 frontDir = (rotationMat * Vector4::front()).xyz();
+        return CapsuleShape{ center, upDir, height, radius }.getBounds();
+    }
+
+    void CapsuleCollider::serialize(Resources::SceneWriter& writer) const
+    {
+        writer.write(m_center);
+        writer.write(m_upDirection);
+        writer.write(m_height);
+        writer.write(m_radius);
+        serializeSettings(writer);
+    }
+
+    CapsuleCollider& CapsuleCollider::deserialize(Entity& owner, Resources::SceneReader& reader)
+    {
+        const Vector3 center = reader.read<Vector3>();
+        const Vector3 upDirection = reader.read<Vector3>();
+        const float   height = reader.read<float>();
+        const float   radius = reader.read<float>();
+
+        CapsuleCollider& collider = owner.addComponent<CapsuleCollider>(center, upDirection, height, radius);
+        collider.deserializeSettings(reader);
 
-        return
-        {
-            center,
-            upDir * height + rightDir * radius + frontDir * radius,
-            height / 2.f
-        };
+        return collider;
     }
 }
@@ -1,66 +1,62 @@
 #include "ColliderOverlaps.h"
 
-#include "BoxCollider.h"
-#include "CapsuleCollider.h"
-#include "Entity.h"
 #include "ICollider.h"
-#include "SphereCollider.h"
-
-#include <algorithm>
 
 using namespace LibMath;
 
 namespace LibGL::Physics
 {
-    std::vector<ICollider*> overlapBox(const Vector3& center, const Vector3& size)
+    void overlapBox(const BoxShape& box, std::vector<ICollider*>& results, const uint32_t layerMask)
     {
-        Entity                  tmpEntity(nullptr, { Vector3::zero(), Vector3::zero(), Vector3::one() });
-        const BoxCollider       tmpCollider(tmpEntity, center, size);
-        std::vector<ICollider*> colliders;
+        results.clear();
+        ICollider::getBroadphase().query(box.getAABB(), results);
 
-        for (const auto& worldCollider : ICollider::getColliders())
+        std::erase_if(results, [&box, layerMask](const ICollider* worldCollider)
         {
-            if (worldCollider != nullptr &&
-                worldCollider != &tmpCollider &&
-                worldCollider->isActive() &&
-                tmpCollider.check(*worldCollider))
-                colliders.push_back(worldCollider);
-        }
+            return !worldCollider->isActive() || !worldCollider->isInLayers(layerMask) || !worldCollider->check(box);
+        });
+    }
 
-        return colliders;
+    void overlapSphere(const SphereShape& sphere, std::vector<ICollider*>& results, const uint32_t layerMask)
+    {
+        results.clear();
+        ICollider::getBroadphase().query(sphere.getAABB(), results);
+
+        std::erase_if(results, [&sphere, layerMask](const ICollider* worldCollider)
+        {
+            return !worldCollider->isActive() || !worldCollider->isInLayers(layerMask) || !worldCollider->check(sphere);
+        });
     }
 
-    std::vector<ICollider*> overlapSphere(const Vector3& center, const float radius)
+    void overlapCapsule(const CapsuleShape& capsule, std::vector<ICollider*>& results, const uint32_t layerMask)
     {
-        Entity                  tmpEntity(nullptr, { Vector3::zero(), Vector3::zero(), Vector3::one() });
-        const SphereCollider    tmpCollider(tmpEntity, center, radius);
-        std::vector<ICollider*> colliders;
+        results.clear();
+        ICollider::getBroadphase().query(capsule.getAABB(), results);
 
-        for (const auto& worldCollider : ICollider::getColliders())
+        std::erase_if(results, [&capsule, layerMask](const ICollider* worldCollider)
         {
-            if (worldCollider != nullptr &&
-                worldCollider != &tmpCollider &&
-                worldCollider->isActive() &&
-                tmpCollider.check(*worldCollider))
-                colliders.push_back(worldCollider);
-        }
+            return !worldCollider->isActive() || !worldCollider->isInLayers(layerMask) || !worldCollider->check(capsule);
+        });
+    }
 
+    std::vector<ICollider*> overlapBox(const Vector3& center, const Vector3& size)
+    {
+        std::vector<ICollider*> colliders;
+        overlapBox(BoxShape{ center, size }, colliders);
         return colliders;
     }
 
-    std::vector<ICollider*> overlapCapsule(const Vector3& center, const Vector3& up, const float height, const float radius)
+    std::vector<ICollider*> overlapSphere(const Vector3& center, const float radius)
     {
-        Entity                  tmpEntity(nullptr, { Vector3::zero(), Vector3::zero(), Vector3::one() });
-        const CapsuleCollider   tmpCollider(tmpEntity, center, up, height, radius);
         std::vector<ICollider*> colliders;
+        overlapSphere(SphereShape{ center, radius }, colliders);
+        return colliders;
+    }
 
-        for (const auto& worldCollider : ICollider::getColliders())
-        {
-            if (worldCollider != nullptr && worldCollider != &tmpCollider && worldCollider->isActive()
-                && tmpCollider.check(*worldCollider))
-                colliders.push_back(worldCollider);
-        }
-
+    std::vector<ICollider*> overlapCapsule(const Vector3& center, const Vector3& up, const float height, const float radius)
+    {
+        std::vector<ICollider*> colliders;
+        overlapCapsule(CapsuleShape{ center, up, height, radius }, colliders);
         return colliders;
     }
 }
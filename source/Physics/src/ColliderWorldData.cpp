@@ -0,0 +1,87 @@
+#include "ColliderWorldData.h"
+
+#include "Debug/Assertion.h"
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+    uint32_t ColliderWorldData::allocate()
+    {
+        if (!m_freeIndices.empty())
+        {
+            const uint32_t index = m_freeIndices.back();
+            m_freeIndices.pop_back();
+
+            m_isValid[index] = false;
+            return index;
+        }
+
+        m_centers.emplace_back();
+        m_boxSizes.emplace_back();
+        m_axes.emplace_back();
+        m_sphereRadii.emplace_back();
+        m_radii.emplace_back();
+        m_isValid.emplace_back(false);
+
+        return static_cast<uint32_t>(m_isValid.size() - 1);
+    }
+
+    void ColliderWorldData::release(const uint32_t index)
+    {
+        ASSERT(index < m_isValid.size(), "Invalid collider world data index");
+
+        m_isValid[index] = false;
+        m_freeIndices.push_back(index);
+    }
+
+    void ColliderWorldData::invalidate(const uint32_t index)
+    {
+        m_isValid[index] = false;
+    }
+
+    bool ColliderWorldData::isValid(const uint32_t index) const
+    {
+        return m_isValid[index];
+    }
+
+    void ColliderWorldData::update(const uint32_t index, const Bounds& bounds, const float radius, const Vector3& axis)
+    {
+        m_centers[index] = bounds.m_center;
+        m_boxSizes[index] = bounds.m_boxSize;
+        m_sphereRadii[index] = bounds.m_sphereRadius;
+        m_radii[index] = radius;
+        m_axes[index] = axis;
+        m_isValid[index] = true;
+    }
+
+    Bounds ColliderWorldData::getBounds(const uint32_t index) const
+    {
+        return { m_centers[index], m_boxSizes[index], m_sphereRadii[index] };
+    }
+
+    const Vector3& ColliderWorldData::getCenter(const uint32_t index) const
+    {
+        return m_centers[index];
+    }
+
+    float ColliderWorldData::getSphereRadius(const uint32_t index) const
+    {
+        return m_sphereRadii[index];
+    }
+
+    float ColliderWorldData::getRadius(const uint32_t index) const
+    {
+        return m_radii[index];
+    }
+
+    const Vector3& ColliderWorldData::getAxis(const uint32_t index) const
+    {
+        return m_axes[index];
+    }
+
+    size_t ColliderWorldData::size() const
+    {
+        return m_isValid.size();
+    }
+}
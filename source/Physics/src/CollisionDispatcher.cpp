@@ -0,0 +1,74 @@
+#include "CollisionDispatcher.h"
+
+#include "ICollider.h"
+#include "Narrowphase.h"
+#include "Debug/Assertion.h"
+
+namespace LibGL::Physics
+{
+    template <bool (*Func)(const WorldShape&, const WorldShape&)>
+    bool CollisionDispatcher::checkWorldShapes(const ICollider& first, const ICollider& second)
+    {
+        return Func(first.getWorldShape(), second.getWorldShape());
+    }
+
+    constexpr CollisionDispatcher::Table CollisionDispatcher::makeBuiltinChecks()
+    {
+        Table table{};
+
+        for (auto& row : table)
+            row.fill({ &checkUnsupported, false });
+
+        const auto setCheck = [&table](const EShapeType first, const EShapeType second, const CheckFunc func)
+        {
+            table[static_cast<size_t>(first)][static_cast<size_t>(second)] = { func, false };
+            table[static_cast<size_t>(second)][static_cast<size_t>(first)] = { func, first != second };
+        };
+
+        setCheck(EShapeType::BOX, EShapeType::BOX, &checkWorldShapes<&checkBoxBox>);
+        setCheck(EShapeType::BOX, EShapeType::SPHERE, &checkWorldShapes<&checkBoxSphere>);
+        setCheck(EShapeType::BOX, EShapeType::CAPSULE, &checkWorldShapes<&checkBoxCapsule>);
+        setCheck(EShapeType::SPHERE, EShapeType::SPHERE, &checkWorldShapes<&checkSphereSphere>);
+        setCheck(EShapeType::SPHERE, EShapeType::CAPSULE, &checkWorldShapes<&checkSphereCapsule>);
+        setCheck(EShapeType::CAPSULE, EShapeType::CAPSULE, &checkWorldShapes<&checkCapsuleCapsule>);
+
+        return table;
+    }
+
+    // Constant initialized so the types registered by other translation units' static variables are never overwritten
+    constinit CollisionDispatcher::Table CollisionDispatcher::s_checks = makeBuiltinChecks();
+    constinit uint8_t CollisionDispatcher::s_shapeTypeCount = static_cast<uint8_t>(EShapeType::CAPSULE) + 1;
+
+    EShapeType CollisionDispatcher::registerShapeType()
+    {
+        ASSERT(s_shapeTypeCount < MAX_SHAPE_TYPES, "Too many collider shape types");
+        return static_cast<EShapeType>(s_shapeTypeCount++);
+    }
+
+    void CollisionDispatcher::registerCheck(const EShapeType first, const EShapeType second, const CheckFunc func)
+    {
+        ASSERT(static_cast<uint8_t>(first) < s_shapeTypeCount && static_cast<uint8_t>(second) < s_shapeTypeCount,
+            "Unregistered collider shape type");
+
+        s_checks[static_cast<size_t>(first)][static_cast<size_t>(second)] = { func, false };
+        s_checks[static_cast<size_t>(second)][static_cast<size_t>(first)] = { func, first != second };
+    }
+
+    bool CollisionDispatcher::isSupported(const EShapeType first, const EShapeType second)
+    {
+        return s_checks[static_cast<size_t>(first)][static_cast<size_t>(second)].m_func != &checkUnsupported;
+    }
+
+    bool CollisionDispatcher::check(const ICollider& first, const ICollider& second)
+    {
+        const auto [func, isSwapped] =
+            s_checks[static_cast<size_t>(first.getShapeType())][static_cast<size_t>(second.getShapeType())];
+
+        return isSwapped ? func(second, first) : func(first, second);
+    }
+
+    bool CollisionDispatcher::checkUnsupported(const ICollider&, const ICollider&)
+    {
+        return false;
+    }
+}
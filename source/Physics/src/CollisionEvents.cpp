@@ -0,0 +1,186 @@
+#include "CollisionEvents.h"
+
+#include "ContactManifold.h"
+#include "ICollider.h"
+
+#include <algorithm>
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+    void CollisionEvents::update()
+    {
+        const IBroadphase&  broadphase = ICollider::getBroadphase();
+        const ContactCache& contacts = ICollider::getContacts();
+
+        ++m_updateCount;
+
+        for (const OverlapPair& pair : broadphase.getPairCache().getPairs())
+        {
+            ICollider& first = *broadphase.getCollider(pair.m_first);
+            ICollider& second = *broadphase.getCollider(pair.m_second);
+
+            if (!first.isActive() || !second.isActive() || &first.getOwner() == &second.getOwner() ||
+                !first.canCollideWith(second))
+                continue;
+
+            const bool             isTrigger = first.isTrigger() || second.isTrigger();
+            const ContactManifold* manifold = isTrigger ? nullptr : contacts.findManifold(first, second);
+
+            if (isTrigger ? !first.check(second) : manifold == nullptr || manifold->getPoints().empty())
+                continue;
+
+            const uint64_t key = getKey(first, second);
+            const auto [it, isNew] = m_touchingPairs.try_emplace(key, TouchingPair{ &first, &second, 0, isTrigger });
+
+            TouchingPair& touchingPair = it->second;
+
+            // A collider which became a trigger ends its contact before starting to overlap, and the other way around
+            if (!isNew && touchingPair.m_isTrigger != isTrigger)
+            {
+                m_queue.push_back({
+                    &first, &second, Vector3::zero(), Vector3::zero(), 0.f, EPairState::END, touchingPair.m_isTrigger
+                });
+
+                touchingPair.m_isTrigger = isTrigger;
+                touchingPair.m_lastUpdate = 0;
+            }
+
+            const bool isBeginning = touchingPair.m_lastUpdate == 0;
+            touchingPair.m_lastUpdate = m_updateCount;
+
+            if (isTrigger)
+            {
+                if (isBeginning)
+                {
+                    m_queue.push_back({
+                        &first, &second, Vector3::zero(), Vector3::zero(), 0.f, EPairState::BEGIN, true
+                    });
+                }
+
+                continue;
+            }
+
+            // The manifold's normal points from its own first collider, which isn't always the pair's
+            const bool     isSwapped = &manifold->getFirst() != &first;
+            const Vector3& normal = manifold->getNormal();
+
+            Vector3 point = Vector3::zero();
+
+            for (const ContactPoint& contactPoint : manifold->getPoints())
+                point += (contactPoint.m_positionA + contactPoint.m_positionB) / 2.f;
+
+            m_queue.push_back({
+                &first, &second, isSwapped ? -normal : normal,
+                point / static_cast<float>(manifold->getPoints().size()), manifold->getMaxDepth(),
+                isBeginning ? EPairState::BEGIN : EPairState::PERSIST, false
+            });
+        }
+
+        m_endedKeys.clear();
+
+        for (const auto& [key, touchingPair] : m_touchingPairs)
+        {
+            if (touchingPair.m_lastUpdate != m_updateCount)
+                m_endedKeys.push_back(key);
+        }
+
+        // The pairs are stored unordered, sorting their keys keeps the exit events' order reproducible
+        std::ranges::sort(m_endedKeys);
+
+        for (const uint64_t key : m_endedKeys)
+        {
+            const auto          it = m_touchingPairs.find(key);
+            const TouchingPair& pair = it->second;
+
+            m_queue.push_back({
+                pair.m_first, pair.m_second, Vector3::zero(), Vector3::zero(), 0.f, EPairState::END, pair.m_isTrigger
+            });
+
+            m_touchingPairs.erase(it);
+        }
+    }
+
+    void CollisionEvents::dispatch()
+    {
+        // The callbacks can destroy colliders, whose events are then removed from the queue
+        for (size_t i = 0; i < m_queue.size(); ++i)
+            send(i);
+
+        m_queue.clear();
+    }
+
+    void CollisionEvents::removeCollider(const ICollider& collider)
+    {
+        std::erase_if(m_touchingPairs, [&collider](const auto& entry)
+        {
+            return entry.second.m_first == &collider || entry.second.m_second == &collider;
+        });
+
+        for (QueuedEvent& event : m_queue)
+        {
+            if (event.m_first == &collider || event.m_second == &collider)
+            {
+                event.m_first = nullptr;
+                event.m_second = nullptr;
+            }
+        }
+    }
+
+    size_t CollisionEvents::getTouchingPairCount() const
+    {
+        return m_touchingPairs.size();
+    }
+
+    void CollisionEvents::send(const size_t index) const
+    {
+        const auto sendTo = [this, index](const bool isFirst)
+        {
+            const QueuedEvent& event = m_queue[index];
+
+            if (event.m_first == nullptr)
+                return;
+
+            ICollider& receiver = isFirst ? *event.m_first : *event.m_second;
+            ICollider& other = isFirst ? *event.m_second : *event.m_first;
+
+            if (event.m_isTrigger)
+            {
+                if (event.m_state == EPairState::BEGIN)
+                    receiver.m_triggerEnterEvent.invoke(other);
+                else
+                    receiver.m_triggerExitEvent.invoke(other);
+
+                return;
+            }
+
+            const Vector3   normal = isFirst ? -event.m_normal : event.m_normal;
+            const Collision collision{ &other, normal, event.m_point, event.m_depth };
+
+            switch (event.m_state)
+            {
+            case EPairState::BEGIN:
+                receiver.m_collisionEnterEvent.invoke(collision);
+                break;
+            case EPairState::PERSIST:
+                receiver.m_collisionStayEvent.invoke(collision);
+                break;
+            case EPairState::END:
+                receiver.m_collisionExitEvent.invoke(collision);
+                break;
+            }
+        };
+
+        sendTo(true);
+        sendTo(false);
+    }
+
+    uint64_t CollisionEvents::getKey(const ICollider& first, const ICollider& second)
+    {
+        const uint64_t low = std::min(first.getDataIndex(), second.getDataIndex());
+        const uint64_t high = std::max(first.getDataIndex(), second.getDataIndex());
+
+        return high << 32 | low;
+    }
+}
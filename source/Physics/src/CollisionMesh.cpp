@@ -0,0 +1,66 @@
+#include "CollisionMesh.h"
+
+#include "Debug/Log.h"
+#include "Utility/BinaryReader.h"
+#include "Utility/BinaryWriter.h"
+#include "Utility/MappedFile.h"
+
+using namespace LibGL::Utility;
+
+namespace LibGL::Physics
+{
+    REGISTER_RESOURCE_TYPE(CollisionMesh);
+
+    CollisionMesh::CollisionMesh(TriangleMesh mesh)
+        : m_mesh(std::make_shared<const TriangleMesh>(std::move(mesh)))
+    {
+    }
+
+    bool CollisionMesh::load(const char* fileName)
+    {
+        const MappedFile file(fileName);
+
+        if (!file.isValid())
+        {
+            DEBUG_LOG("Unable to open collision mesh file \"%s\"\n", fileName);
+            return false;
+        }
+
+        BinaryReader reader(file.getData(), file.getSize());
+
+        const uint32_t magic = reader.read<uint32_t>();
+        const uint32_t version = reader.read<uint32_t>();
+
+        if (magic != MAGIC || version != VERSION)
+        {
+            DEBUG_LOG("Invalid collision mesh file \"%s\"\n", fileName);
+            return false;
+        }
+
+        TriangleMesh mesh = TriangleMesh::deserialize(reader);
+
+        if (!reader.isValid() || mesh.getTriangleCount() == 0)
+        {
+            DEBUG_LOG("Invalid collision mesh file \"%s\"\n", fileName);
+            return false;
+        }
+
+        m_mesh = std::make_shared<const TriangleMesh>(std::move(mesh));
+        return true;
+    }
+
+    bool CollisionMesh::save(const std::string& fileName) const
+    {
+        BinaryWriter writer;
+        writer.write(MAGIC);
+        writer.write(VERSION);
+        m_mesh->serialize(writer);
+
+        return writer.saveToFile(fileName);
+    }
+
+    const std::shared_ptr<const TriangleMesh>& CollisionMesh::getMesh() const
+    {
+        return m_mesh;
+    }
+}
@@ -0,0 +1,59 @@
+#include "ContactCache.h"
+
+#include "ICollider.h"
+
+#include <algorithm>
+
+namespace LibGL::Physics
+{
+    ContactManifold& ContactCache::getManifold(const ICollider& first, const ICollider& second)
+    {
+        const bool       isOrdered = first.getProxyId() < second.getProxyId();
+        const ICollider& low = isOrdered ? first : second;
+        const ICollider& high = isOrdered ? second : first;
+
+        return m_manifolds.try_emplace(getKey(low.getProxyId(), high.getProxyId()), low, high).first->second;
+    }
+
+    const ContactManifold* ContactCache::findManifold(const ICollider& first, const ICollider& second) const
+    {
+        const auto it = m_manifolds.find(getKey(first.getProxyId(), second.getProxyId()));
+        return it != m_manifolds.end() ? &it->second : nullptr;
+    }
+
+    void ContactCache::removePairs(const std::span<const OverlapPair> pairs)
+    {
+        if (m_manifolds.empty())
+            return;
+
+        for (const OverlapPair& pair : pairs)
+            m_manifolds.erase(getKey(pair.m_first, pair.m_second));
+    }
+
+    void ContactCache::removeProxy(const int32_t proxyId)
+    {
+        std::erase_if(m_manifolds, [proxyId](const auto& entry)
+        {
+            return static_cast<int32_t>(entry.first >> 32) == proxyId ||
+                static_cast<int32_t>(entry.first & 0xFFFFFFFF) == proxyId;
+        });
+    }
+
+    void ContactCache::clear()
+    {
+        m_manifolds.clear();
+    }
+
+    size_t ContactCache::getManifoldCount() const
+    {
+        return m_manifolds.size();
+    }
+
+    uint64_t ContactCache::getKey(const int32_t first, const int32_t second)
+    {
+        const uint64_t low = static_cast<uint32_t>(std::min(first, second));
+        const uint64_t high = static_cast<uint32_t>(std::max(first, second));
+
+        return high << 32 | low;
+    }
+}
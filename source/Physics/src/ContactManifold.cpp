@@ -0,0 +1,171 @@
+#include "ContactManifold.h"
+
+#include "Arithmetic.h"
+#include "Gjk.h"
+#include "ICollider.h"
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+    ContactManifold::ContactManifold(const ICollider& first, const ICollider& second)
+        : m_normal(Vector3::zero()), m_first(&first), m_second(&second)
+    {
+    }
+
+    bool ContactManifold::update()
+    {
+        Contact contact;
+
+        if (!m_first->computeContact(*m_second, contact))
+        {
+            m_pointCount = 0;
+            return false;
+        }
+
+        m_normal = contact.m_normal;
+
+        refreshPoints();
+        addPoint(contact);
+
+        return true;
+    }
+
+    const ICollider& ContactManifold::getFirst() const
+    {
+        return *m_first;
+    }
+
+    const ICollider& ContactManifold::getSecond() const
+    {
+        return *m_second;
+    }
+
+    const Vector3& ContactManifold::getNormal() const
+    {
+        return m_normal;
+    }
+
+    std::span<const ContactPoint> ContactManifold::getPoints() const
+    {
+        return { m_points.data(), m_pointCount };
+    }
+
+    std::span<ContactPoint> ContactManifold::getPoints()
+    {
+        return { m_points.data(), m_pointCount };
+    }
+
+    float ContactManifold::getMaxDepth() const
+    {
+        float maxDepth = 0.f;
+
+        for (const ContactPoint& point : getPoints())
+            maxDepth = max(maxDepth, point.m_depth);
+
+        return maxDepth;
+    }
+
+    void ContactManifold::refreshPoints()
+    {
+        const Vector3 firstCenter = m_first->getBounds().m_center;
+        const Vector3 secondCenter = m_second->getBounds().m_center;
+
+        for (uint8_t i = 0; i < m_pointCount;)
+        {
+            ContactPoint& point = m_points[i];
+
+            point.m_positionA = firstCenter + point.m_anchorA;
+            point.m_positionB = secondCenter + point.m_anchorB;
+
+            const Vector3 offset = point.m_positionA - point.m_positionB;
+            point.m_depth = offset.dot(m_normal);
+
+            const Vector3 slide = offset - m_normal * point.m_depth;
+
+            if (point.m_depth < -PERSISTENCE_THRESHOLD ||
+                slide.magnitudeSquared() > PERSISTENCE_THRESHOLD * PERSISTENCE_THRESHOLD)
+                point = m_points[--m_pointCount];
+            else
+                ++i;
+        }
+    }
+
+    void ContactManifold::addPoint(const Contact& contact)
+    {
+        ContactPoint point
+        {
+            contact.m_pointA,
+            contact.m_pointB,
+            contact.m_pointA - m_first->getBounds().m_center,
+            contact.m_pointB - m_second->getBounds().m_center,
+            contact.m_depth,
+            0.f,
+            Vector3::zero()
+        };
+
+        // Replace the point found on a previous frame at the same place, keeping its impulses
+        for (uint8_t i = 0; i < m_pointCount; ++i)
+        {
+            if (m_points[i].m_positionA.distanceSquaredFrom(point.m_positionA) <=
+                PERSISTENCE_THRESHOLD * PERSISTENCE_THRESHOLD)
+            {
+                point.m_normalImpulse = m_points[i].m_normalImpulse;
+                point.m_tangentImpulse = m_points[i].m_tangentImpulse;
+                m_points[i] = point;
+                return;
+            }
+        }
+
+        if (m_pointCount < MAX_POINTS)
+            m_points[m_pointCount++] = point;
+        else
+            m_points[getReplacedIndex(point)] = point;
+    }
+
+    uint8_t ContactManifold::getReplacedIndex(const ContactPoint& point) const
+    {
+        uint8_t deepestIndex = MAX_POINTS;
+        float   maxDepth = point.m_depth;
+
+        for (uint8_t i = 0; i < MAX_POINTS; ++i)
+        {
+            if (m_points[i].m_depth > maxDepth)
+            {
+                maxDepth = m_points[i].m_depth;
+                deepestIndex = i;
+            }
+        }
+
+        // The largest squared cross product of the quad's diagonals approximates its area
+        const auto getArea = [](const Vector3& a, const Vector3& b, const Vector3& c, const Vector3& d)
+        {
+            return max((a - b).cross(c - d).magnitudeSquared(),
+                max((a - c).cross(b - d).magnitudeSquared(), (a - d).cross(b - c).magnitudeSquared()));
+        };
+
+        uint8_t replacedIndex = 0;
+        float   maxArea = -1.f;
+
+        for (uint8_t i = 0; i < MAX_POINTS; ++i)
+        {
+            if (i == deepestIndex)
+                continue;
+
+            std::array<Vector3, MAX_POINTS> positions;
+
+            for (uint8_t j = 0; j < MAX_POINTS; ++j)
+                positions[j] = j == i ? point.m_positionA : m_points[j].m_positionA;
+
+            const float area = getArea(positions[0], positions[1], positions[2], positions[3]);
+
+            if (area > maxArea)
+            {
+                maxArea = area;
+                replacedIndex = i;
+            }
+        }
+
+        return replacedIndex;
+    }
+}
@@ -0,0 +1,147 @@
+#include "ContactSolver.h"
+
+#include "Arithmetic.h"
+#include "ContactManifold.h"
+#include "Debug/Assertion.h"
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+    ContactSolver::ContactSolver()
+    {
+        clear();
+    }
+
+    void ContactSolver::clear()
+    {
+        m_bodies.clear();
+        m_constraints.clear();
+
+        m_bodies.push_back({ Vector3::zero(), Vector3::zero(), 0.f });
+    }
+
+    uint32_t ContactSolver::addBody(const Vector3& velocity, const float inverseMass)
+    {
+        m_bodies.push_back({ velocity, Vector3::zero(), inverseMass });
+        return static_cast<uint32_t>(m_bodies.size() - 1);
+    }
+
+    const ContactSolver::Body& ContactSolver::getBody(const uint32_t index) const
+    {
+        return m_bodies[index];
+    }
+
+    bool ContactSolver::isDynamic(const uint32_t index) const
+    {
+        return m_bodies[index].m_inverseMass > 0.f;
+    }
+
+    void ContactSolver::addManifold(ContactManifold& manifold, const uint32_t firstBody, const uint32_t secondBody,
+                                    const float friction)
+    {
+        ASSERT(firstBody < m_bodies.size() && secondBody < m_bodies.size(), "Invalid contact solver body");
+
+        const float inverseMass = m_bodies[firstBody].m_inverseMass + m_bodies[secondBody].m_inverseMass;
+
+        if (inverseMass <= 0.f)
+            return;
+
+        // Bodies can't rotate so every point shares the same effective mass
+        for (ContactPoint& point : manifold.getPoints())
+            m_constraints.push_back({ &point, manifold.getNormal(), firstBody, secondBody, 1.f / inverseMass, friction });
+    }
+
+    void ContactSolver::solveVelocities()
+    {
+        for (const Constraint& constraint : m_constraints)
+        {
+            ContactPoint& point = *constraint.m_point;
+
+            // The normal may have changed since the impulses were found
+            point.m_tangentImpulse -= constraint.m_normal * point.m_tangentImpulse.dot(constraint.m_normal);
+
+            applyImpulse(constraint, constraint.m_normal * point.m_normalImpulse + point.m_tangentImpulse);
+        }
+
+        for (uint8_t i = 0; i < s_velocityIterations; ++i)
+        {
+            for (const Constraint& constraint : m_constraints)
+            {
+                ContactPoint& point = *constraint.m_point;
+
+                // Friction first since the normal impulse matters more and should be solved last
+                const Vector3 relativeVelocity = m_bodies[constraint.m_second].m_velocity -
+                    m_bodies[constraint.m_first].m_velocity;
+
+                const Vector3 slidingVelocity = relativeVelocity -
+                    constraint.m_normal * relativeVelocity.dot(constraint.m_normal);
+
+                const float maxFriction = constraint.m_friction * point.m_normalImpulse;
+                Vector3     tangentImpulse = point.m_tangentImpulse - slidingVelocity * constraint.m_mass;
+
+                if (tangentImpulse.magnitudeSquared() > maxFriction * maxFriction)
+                    tangentImpulse = tangentImpulse.normalized() * maxFriction;
+
+                applyImpulse(constraint, tangentImpulse - point.m_tangentImpulse);
+                point.m_tangentImpulse = tangentImpulse;
+
+                const float normalVelocity = (m_bodies[constraint.m_second].m_velocity -
+                    m_bodies[constraint.m_first].m_velocity).dot(constraint.m_normal);
+
+                // The accumulated impulse can only push the bodies apart
+                const float normalImpulse = max(point.m_normalImpulse - normalVelocity * constraint.m_mass, 0.f);
+
+                applyImpulse(constraint, constraint.m_normal * (normalImpulse - point.m_normalImpulse));
+                point.m_normalImpulse = normalImpulse;
+            }
+        }
+    }
+
+    void ContactSolver::integratePositions(const float deltaTime)
+    {
+        for (Body& body : m_bodies)
+            body.m_displacement = body.m_velocity * deltaTime;
+    }
+
+    void ContactSolver::solvePositions()
+    {
+        for (uint8_t i = 0; i < s_positionIterations; ++i)
+        {
+            for (const Constraint& constraint : m_constraints)
+            {
+                Body& first = m_bodies[constraint.m_first];
+                Body& second = m_bodies[constraint.m_second];
+
+                // Estimate the current depth from the depth measured before the bodies moved
+                const float depth = constraint.m_point->m_depth -
+                    (second.m_displacement - first.m_displacement).dot(constraint.m_normal);
+
+                const float correction = clamp(s_correctionFactor * (depth - s_allowedPenetration), 0.f,
+                    s_maxCorrection);
+
+                if (correction <= 0.f)
+                    continue;
+
+                const Vector3 impulse = constraint.m_normal * (correction * constraint.m_mass);
+
+                first.m_displacement -= impulse * first.m_inverseMass;
+                second.m_displacement += impulse * second.m_inverseMass;
+            }
+        }
+    }
+
+    size_t ContactSolver::getContactCount() const
+    {
+        return m_constraints.size();
+    }
+
+    void ContactSolver::applyImpulse(const Constraint& constraint, const Vector3& impulse)
+    {
+        Body& first = m_bodies[constraint.m_first];
+        Body& second = m_bodies[constraint.m_second];
+
+        first.m_velocity -= impulse * first.m_inverseMass;
+        second.m_velocity += impulse * second.m_inverseMass;
+    }
+}
@@ -0,0 +1,380 @@
+#include "DynamicAABBTree.h"
+
+#include "Arithmetic.h"
+#include "Debug/Assertion.h"
+
+#include <array>
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+    DynamicAABBTree::DynamicAABBTree(const float margin)
+        : IBroadphase(margin)
+    {
+    }
+
+    int32_t DynamicAABBTree::createProxy(const AABB& bounds, ICollider* collider)
+    {
+        const int32_t proxyId = allocateNode();
+        Node&         node = m_nodes[static_cast<size_t>(proxyId)];
+
+        node.m_bounds = bounds.expanded(m_margin);
+        node.m_collider = collider;
+        node.m_height = 0;
+
+        insertLeaf(proxyId);
+        ++m_proxyCount;
+
+        updatePairs(proxyId);
+
+        return proxyId;
+    }
+
+    void DynamicAABBTree::destroyProxy(const int32_t proxyId)
+    {
+        ASSERT(m_nodes[static_cast<size_t>(proxyId)].isLeaf(), "Invalid dynamic AABB tree proxy");
+
+        m_pairCache.removeProxy(proxyId);
+
+        removeLeaf(proxyId);
+        freeNode(proxyId);
+        --m_proxyCount;
+    }
+
+    bool DynamicAABBTree::moveProxy(const int32_t proxyId, const AABB& bounds)
+    {
+        ASSERT(m_nodes[static_cast<size_t>(proxyId)].isLeaf(), "Invalid dynamic AABB tree proxy");
+
+        const AABB& fatBounds = m_nodes[static_cast<size_t>(proxyId)].m_bounds;
+
+        // Keep the current leaf unless the collider left it or got much smaller than it (e.g. after a scale change)
+        if (fatBounds.contains(bounds) && bounds.expanded(m_margin * 4.f).contains(fatBounds))
+            return false;
+
+        removeLeaf(proxyId);
+        m_nodes[static_cast<size_t>(proxyId)].m_bounds = bounds.expanded(m_margin);
+        insertLeaf(proxyId);
+
+        updatePairs(proxyId);
+
+        return true;
+    }
+
+    ICollider* DynamicAABBTree::getCollider(const int32_t proxyId) const
+    {
+        return m_nodes[static_cast<size_t>(proxyId)].m_collider;
+    }
+
+    const AABB& DynamicAABBTree::getFatBounds(const int32_t proxyId) const
+    {
+        return m_nodes[static_cast<size_t>(proxyId)].m_bounds;
+    }
+
+    void DynamicAABBTree::query(const AABB& bounds, std::vector<ICollider*>& colliders) const
+    {
+        std::array<int32_t, STACK_SIZE> stack;
+        size_t                          stackSize = 0;
+
+        if (m_root != NULL_NODE)
+            stack[stackSize++] = m_root;
+
+        while (stackSize > 0)
+        {
+            const Node& node = m_nodes[static_cast<size_t>(stack[--stackSize])];
+
+            if (!node.m_bounds.overlaps(bounds))
+                continue;
+
+            if (node.isLeaf())
+            {
+                colliders.push_back(node.m_collider);
+                continue;
+            }
+
+            ASSERT(stackSize + 2 <= STACK_SIZE, "Dynamic AABB tree is too deep");
+            stack[stackSize++] = node.m_left;
+            stack[stackSize++] = node.m_right;
+        }
+    }
+
+    void DynamicAABBTree::raycast(const Vector3&         origin, const Vector3& direction, float maxDistance,
+                                  const RaycastCallback& callback) const
+    {
+        std::array<int32_t, STACK_SIZE> stack;
+        size_t                          stackSize = 0;
+
+        if (m_root != NULL_NODE)
+            stack[stackSize++] = m_root;
+
+        while (stackSize > 0)
+        {
+            const Node& node = m_nodes[static_cast<size_t>(stack[--stackSize])];
+            float       distance;
+
+            if (!node.m_bounds.raycast(origin, direction, maxDistance, distance))
+                continue;
+
+            if (node.isLeaf())
+            {
+                maxDistance = callback(node.m_collider, maxDistance);
+
+                if (maxDistance < 0.f)
+                    return;
+
+                continue;
+            }
+
+            ASSERT(stackSize + 2 <= STACK_SIZE, "Dynamic AABB tree is too deep");
+            stack[stackSize++] = node.m_left;
+            stack[stackSize++] = node.m_right;
+        }
+    }
+
+    void DynamicAABBTree::raycast(RayPacket& packet, const PacketRaycastCallback& callback) const
+    {
+        std::array<int32_t, STACK_SIZE> stack;
+        size_t                          stackSize = 0;
+
+        if (m_root != NULL_NODE)
+            stack[stackSize++] = m_root;
+
+        while (stackSize > 0)
+        {
+            const Node&   node = m_nodes[static_cast<size_t>(stack[--stackSize])];
+            const uint8_t hitMask = packet.raycast(node.m_bounds);
+
+            if (hitMask == 0)
+                continue;
+
+            if (node.isLeaf())
+            {
+                callback(node.m_collider, hitMask);
+                continue;
+            }
+
+            ASSERT(stackSize + 2 <= STACK_SIZE, "Dynamic AABB tree is too deep");
+            stack[stackSize++] = node.m_left;
+            stack[stackSize++] = node.m_right;
+        }
+    }
+
+    size_t DynamicAABBTree::getProxyCount() const
+    {
+        return m_proxyCount;
+    }
+
+    int32_t DynamicAABBTree::getHeight() const
+    {
+        return m_root == NULL_NODE ? 0 : m_nodes[static_cast<size_t>(m_root)].m_height;
+    }
+
+    bool DynamicAABBTree::Node::isLeaf() const
+    {
+        return m_left == NULL_NODE;
+    }
+
+    int32_t DynamicAABBTree::allocateNode()
+    {
+        if (m_freeList == NULL_NODE)
+        {
+            m_nodes.emplace_back();
+            return static_cast<int32_t>(m_nodes.size() - 1);
+        }
+
+        const int32_t nodeId = m_freeList;
+        Node&         node = m_nodes[static_cast<size_t>(nodeId)];
+
+        m_freeList = node.m_parent;
+        node = Node();
+
+        return nodeId;
+    }
+
+    void DynamicAABBTree::freeNode(const int32_t nodeId)
+    {
+        Node& node = m_nodes[static_cast<size_t>(nodeId)];
+
+        node = Node();
+        node.m_parent = m_freeList;
+
+        m_freeList = nodeId;
+    }
+
+    void DynamicAABBTree::insertLeaf(const int32_t leafId)
+    {
+        if (m_root == NULL_NODE)
+        {
+            m_root = leafId;
+            m_nodes[static_cast<size_t>(leafId)].m_parent = NULL_NODE;
+            return;
+        }
+
+        const AABB leafBounds = m_nodes[static_cast<size_t>(leafId)].m_bounds;
+
+        // Find the sibling whose merge with the leaf increases the tree's total surface area the least
+        int32_t siblingId = m_root;
+
+        while (!m_nodes[static_cast<size_t>(siblingId)].isLeaf())
+        {
+            const Node& node = m_nodes[static_cast<size_t>(siblingId)];
+
+            const float area = node.m_bounds.getSurfaceArea();
+            const float mergedArea = node.m_bounds.merged(leafBounds).getSurfaceArea();
+
+            // Cost of creating a new parent for this node and the leaf
+            const float cost = 2.f * mergedArea;
+
+            // Minimum cost of pushing the leaf further down the tree
+            const float inheritanceCost = 2.f * (mergedArea - area);
+
+            const auto getDescentCost = [this, &leafBounds, inheritanceCost](const int32_t childId)
+            {
+                const Node& child = m_nodes[static_cast<size_t>(childId)];
+                const float childMergedArea = child.m_bounds.merged(leafBounds).getSurfaceArea();
+
+                return child.isLeaf()
+                           ? childMergedArea + inheritanceCost
+                           : childMergedArea - child.m_bounds.getSurfaceArea() + inheritanceCost;
+            };
+
+            const float leftCost = getDescentCost(node.m_left);
+            const float rightCost = getDescentCost(node.m_right);
+
+            if (cost < leftCost && cost < rightCost)
+                break;
+
+            siblingId = leftCost < rightCost ? node.m_left : node.m_right;
+        }
+
+        const int32_t oldParentId = m_nodes[static_cast<size_t>(siblingId)].m_parent;
+        const int32_t newParentId = allocateNode();
+
+        Node& newParent = m_nodes[static_cast<size_t>(newParentId)];
+        Node& sibling = m_nodes[static_cast<size_t>(siblingId)];
+
+        newParent.m_parent = oldParentId;
+        newParent.m_bounds = sibling.m_bounds.merged(leafBounds);
+        newParent.m_height = sibling.m_height + 1;
+        newParent.m_left = siblingId;
+        newParent.m_right = leafId;
+
+        sibling.m_parent = newParentId;
+        m_nodes[static_cast<size_t>(leafId)].m_parent = newParentId;
+
+        replaceChild(oldParentId, siblingId, newParentId);
+        refit(newParentId);
+    }
+
+    void DynamicAABBTree::removeLeaf(const int32_t leafId)
+    {
+        if (leafId == m_root)
+        {
+            m_root = NULL_NODE;
+            return;
+        }
+
+        const int32_t parentId = m_nodes[static_cast<size_t>(leafId)].m_parent;
+        const Node&   parent = m_nodes[static_cast<size_t>(parentId)];
+        const int32_t grandParentId = parent.m_parent;
+        const int32_t siblingId = parent.m_left == leafId ? parent.m_right : parent.m_left;
+
+        // The sibling takes the parent's place
+        replaceChild(grandParentId, parentId, siblingId);
+        m_nodes[static_cast<size_t>(siblingId)].m_parent = grandParentId;
+        freeNode(parentId);
+
+        refit(grandParentId);
+    }
+
+    void DynamicAABBTree::refit(int32_t nodeId)
+    {
+        while (nodeId != NULL_NODE)
+        {
+            nodeId = balance(nodeId);
+
+            Node&       node = m_nodes[static_cast<size_t>(nodeId)];
+            const Node& left = m_nodes[static_cast<size_t>(node.m_left)];
+            const Node& right = m_nodes[static_cast<size_t>(node.m_right)];
+
+            node.m_height = 1 + max(left.m_height, right.m_height);
+            node.m_bounds = left.m_bounds.merged(right.m_bounds);
+
+            nodeId = node.m_parent;
+        }
+    }
+
+    int32_t DynamicAABBTree::balance(const int32_t nodeId)
+    {
+        Node& node = m_nodes[static_cast<size_t>(nodeId)];
+
+        if (node.isLeaf() || node.m_height < 2)
+            return nodeId;
+
+        const int32_t leftId = node.m_left;
+        const int32_t rightId = node.m_right;
+
+        Node& left = m_nodes[static_cast<size_t>(leftId)];
+        Node& right = m_nodes[static_cast<size_t>(rightId)];
+
+        const int32_t heightDiff = right.m_height - left.m_height;
+
+        if (heightDiff >= -1 && heightDiff <= 1)
+            return nodeId;
+
+        // Promote the taller child and give its shorter grandchild to the current node
+        const bool    isRightTaller = heightDiff > 1;
+        const int32_t pivotId = isRightTaller ? rightId : leftId;
+        Node&         pivot = isRightTaller ? right : left;
+        const Node&   other = isRightTaller ? left : right;
+
+        const int32_t firstId = pivot.m_left;
+        const int32_t secondId = pivot.m_right;
+        Node&         first = m_nodes[static_cast<size_t>(firstId)];
+        Node&         second = m_nodes[static_cast<size_t>(secondId)];
+
+        const bool    keepFirst = first.m_height > second.m_height;
+        const int32_t keptId = keepFirst ? firstId : secondId;
+        const int32_t givenId = keepFirst ? secondId : firstId;
+        const Node&   kept = keepFirst ? first : second;
+        Node&         given = keepFirst ? second : first;
+
+        pivot.m_left = nodeId;
+        pivot.m_right = keptId;
+        pivot.m_parent = node.m_parent;
+        node.m_parent = pivotId;
+
+        replaceChild(pivot.m_parent, nodeId, pivotId);
+
+        if (isRightTaller)
+            node.m_right = givenId;
+        else
+            node.m_left = givenId;
+
+        given.m_parent = nodeId;
+
+        node.m_bounds = other.m_bounds.merged(given.m_bounds);
+        node.m_height = 1 + max(other.m_height, given.m_height);
+
+        pivot.m_bounds = node.m_bounds.merged(kept.m_bounds);
+        pivot.m_height = 1 + max(node.m_height, kept.m_height);
+
+        return pivotId;
+    }
+
+    void DynamicAABBTree::replaceChild(const int32_t parentId, const int32_t oldChildId, const int32_t newChildId)
+    {
+        if (parentId == NULL_NODE)
+        {
+            m_root = newChildId;
+            return;
+        }
+
+        Node& parent = m_nodes[static_cast<size_t>(parentId)];
+
+        if (parent.m_left == oldChildId)
+            parent.m_left = newChildId;
+        else
+            parent.m_right = newChildId;
+    }
+}
@@ -0,0 +1,656 @@
+#include "Gjk.h"
+
+#include "Arithmetic.h"
+#include "ICollider.h"
+#include "Shapes.h"
+
+#include <cfloat>
+#include <cmath>
+#include <utility>
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+    float Gjk::computeDistance(const ICollider& first, const ICollider& second, Vector3& pointA, Vector3& pointB)
+    {
+        Simplex     simplex;
+        const float coreDistance = runGjk({ &first }, { &second }, simplex);
+        const float firstRadius = first.getSupportRadius();
+        const float secondRadius = second.getSupportRadius();
+
+        if (coreDistance <= firstRadius + secondRadius)
+            return 0.f;
+
+        Vector3 coreA = Vector3::zero();
+        Vector3 coreB = Vector3::zero();
+
+        for (uint8_t i = 0; i < simplex.m_count; ++i)
+        {
+            coreA += simplex.m_vertices[i].m_pointA * simplex.m_weights[i];
+            coreB += simplex.m_vertices[i].m_pointB * simplex.m_weights[i];
+        }
+
+        const Vector3 normal = (coreB - coreA) / coreDistance;
+
+        pointA = coreA + normal * firstRadius;
+        pointB = coreB - normal * secondRadius;
+
+        return coreDistance - firstRadius - secondRadius;
+    }
+
+    bool Gjk::computeContact(const ICollider& first, const ICollider& second, Contact& contact, const float maxSeparation)
+    {
+        return computeContact({ &first }, { &second }, contact, maxSeparation);
+    }
+
+    bool Gjk::computeContact(const TriangleShape& first, const ICollider& second, Contact& contact,
+                             const float          maxSeparation)
+    {
+        return computeContact({ nullptr, &first }, { &second }, contact, maxSeparation);
+    }
+
+    bool Gjk::computeTimeOfImpact(const ICollider& first, const ICollider& second, const Vector3& displacement,
+                                  float& fraction, Vector3& normal)
+    {
+        return computeTimeOfImpact({ &first }, { &second }, displacement, fraction, normal);
+    }
+
+    bool Gjk::computeTimeOfImpact(const ICollider& first, const TriangleShape& second, const Vector3& displacement,
+                                  float& fraction, Vector3& normal)
+    {
+        return computeTimeOfImpact({ &first }, { nullptr, &second }, displacement, fraction, normal);
+    }
+
+    bool Gjk::computeContact(const SupportShape& first, const SupportShape& second, Contact& contact,
+                             const float         maxSeparation)
+    {
+        Simplex     simplex;
+        const float coreDistance = runGjk(first, second, simplex);
+
+        // Overlapping cores leave no closest points to derive the normal from
+        if (coreDistance <= 0.f)
+            return runEpa(first, second, simplex, contact);
+
+        const float firstRadius = first.getSupportRadius();
+        const float secondRadius = second.getSupportRadius();
+        const float depth = firstRadius + secondRadius - coreDistance;
+
+        if (-depth > maxSeparation)
+            return false;
+
+        Vector3 coreA = Vector3::zero();
+        Vector3 coreB = Vector3::zero();
+
+        for (uint8_t i = 0; i < simplex.m_count; ++i)
+        {
+            coreA += simplex.m_vertices[i].m_pointA * simplex.m_weights[i];
+            coreB += simplex.m_vertices[i].m_pointB * simplex.m_weights[i];
+        }
+
+        const Vector3 normal = (coreB - coreA) / coreDistance;
+
+        contact = { normal, coreA + normal * firstRadius, coreB - normal * secondRadius, depth };
+        return true;
+    }
+
+    bool Gjk::computeTimeOfImpact(const SupportShape& first, const SupportShape& second, const Vector3& displacement,
+                                  float& fraction, Vector3& normal)
+    {
+        const float radius = first.getSupportRadius() + second.getSupportRadius();
+        float       time = 0.f;
+
+        for (int i = 0; i < MAX_TOI_ITERATIONS; ++i)
+        {
+            SupportShape movedFirst = first;
+            movedFirst.m_offset += displacement * time;
+
+            Simplex     simplex;
+            const float coreDistance = runGjk(movedFirst, second, simplex);
+            const float gap = coreDistance - radius;
+
+            if (gap <= TOI_TOLERANCE)
+            {
+                // Touching colliders are handled by their contacts
+                if (i == 0)
+                    return false;
+
+                fraction = time;
+                return true;
+            }
+
+            Vector3 coreA = Vector3::zero();
+            Vector3 coreB = Vector3::zero();
+
+            for (uint8_t j = 0; j < simplex.m_count; ++j)
+            {
+                coreA += simplex.m_vertices[j].m_pointA * simplex.m_weights[j];
+                coreB += simplex.m_vertices[j].m_pointB * simplex.m_weights[j];
+            }
+
+            normal = (coreB - coreA) / coreDistance;
+
+            // Once the colliders stop closing in, the distance can only grow for the rest of the displacement
+            const float closingDistance = displacement.dot(normal);
+
+            if (closingDistance <= 0.f)
+                return false;
+
+            // Stop just before the impact, keeping a small gap for the contacts to pick up
+            time += (gap - TOI_TOLERANCE * .5f) / closingDistance;
+
+            if (time > 1.f)
+                return false;
+        }
+
+        fraction = time;
+        return true;
+    }
+
+    float Gjk::runGjk(const SupportShape& first, const SupportShape& second, Simplex& simplex)
+    {
+        // The difference of the cores is around the difference of their centers, so start towards the origin from there
+        Vector3 direction = second.getCenter() - first.getCenter();
+
+        if (floatEquals(direction.magnitudeSquared(), 0.f))
+            direction = Vector3::right();
+
+        simplex.m_vertices[0] = getCoreSupport(first, second, direction);
+        simplex.m_count = 1;
+
+        Vector3 closest = solveSimplex(simplex);
+
+        // The closest point's precision degrades with the size of the shapes, so the tolerance scales with them
+        const auto isOverlapping = [&simplex, &closest]
+        {
+            if (simplex.m_count == 4)
+                return true;
+
+            float scaleSqr = 1.f;
+
+            for (uint8_t i = 0; i < simplex.m_count; ++i)
+                scaleSqr = max(scaleSqr, simplex.m_vertices[i].m_point.magnitudeSquared());
+
+            return closest.magnitudeSquared() <= OVERLAP_DISTANCE * OVERLAP_DISTANCE * scaleSqr;
+        };
+
+        for (int i = 0; i < MAX_GJK_ITERATIONS && !isOverlapping(); ++i)
+        {
+            const SupportPoint support = getCoreSupport(first, second, -closest);
+            const float        distanceSqr = closest.magnitudeSquared();
+
+            // Stop once the new support point can't bring the simplex meaningfully closer to the origin
+            if (distanceSqr - closest.dot(support.m_point) <= GJK_TOLERANCE * distanceSqr)
+                break;
+
+            bool isDuplicate = false;
+
+            for (uint8_t j = 0; j < simplex.m_count; ++j)
+                isDuplicate |= simplex.m_vertices[j].m_point.distanceSquaredFrom(support.m_point) <= FLT_EPSILON;
+
+            if (isDuplicate)
+                break;
+
+            simplex.m_vertices[simplex.m_count++] = support;
+            closest = solveSimplex(simplex);
+        }
+
+        return isOverlapping() ? 0.f : closest.magnitude();
+    }
+
+    bool Gjk::runEpa(const SupportShape& first, const SupportShape& second, Simplex& simplex, Contact& contact)
+    {
+        if (simplex.m_count < 4 && !growSimplex(first, second, simplex))
+            return false;
+
+        std::array<SupportPoint, MAX_EPA_VERTICES> vertices;
+        std::array<Face, MAX_EPA_FACES>            faces;
+        std::array<Edge, 3 * MAX_EPA_FACES>        horizon;
+
+        for (uint8_t i = 0; i < 4; ++i)
+            vertices[i] = simplex.m_vertices[i];
+
+        // Wind the first face away from the last vertex so every face's normal points outwards
+        const Vector3 firstEdge = vertices[1].m_point - vertices[0].m_point;
+        const Vector3 secondEdge = vertices[2].m_point - vertices[0].m_point;
+
+        if (firstEdge.cross(secondEdge).dot(vertices[3].m_point - vertices[0].m_point) > 0.f)
+            std::swap(vertices[1], vertices[2]);
+
+        faces[0] = { Vector3::zero(), 0.f, 0, 1, 2 };
+        faces[1] = { Vector3::zero(), 0.f, 0, 3, 1 };
+        faces[2] = { Vector3::zero(), 0.f, 0, 2, 3 };
+        faces[3] = { Vector3::zero(), 0.f, 1, 3, 2 };
+
+        for (size_t i = 0; i < 4; ++i)
+            updateFace(vertices, faces[i]);
+
+        size_t  faceCount = 4;
+        uint8_t vertexCount = 4;
+        Face    closestFace = faces[0];
+        float   supportDistance = 0.f;
+
+        // Removing an edge shared with an already removed face leaves only the border of the removed faces
+        size_t     edgeCount = 0;
+        const auto addEdge = [&horizon, &edgeCount](const uint8_t a, const uint8_t b)
+        {
+            for (size_t i = 0; i < edgeCount; ++i)
+            {
+                if (horizon[i].m_a == b && horizon[i].m_b == a)
+                {
+                    horizon[i] = horizon[--edgeCount];
+                    return;
+                }
+            }
+
+            horizon[edgeCount++] = { a, b };
+        };
+
+        while (true)
+        {
+            closestFace = faces[0];
+
+            for (size_t i = 1; i < faceCount; ++i)
+            {
+                if (faces[i].m_distance < closestFace.m_distance)
+                    closestFace = faces[i];
+            }
+
+            if (std::isinf(closestFace.m_distance))
+                return false;
+
+            const SupportPoint support = getShapeSupport(first, second, closestFace.m_normal);
+            supportDistance = support.m_point.dot(closestFace.m_normal);
+
+            if (supportDistance - closestFace.m_distance <= EPA_TOLERANCE ||
+                vertexCount == MAX_EPA_VERTICES)
+                break;
+
+            vertices[vertexCount] = support;
+            edgeCount = 0;
+
+            for (size_t i = 0; i < faceCount;)
+            {
+                const Face& face = faces[i];
+
+                if (face.m_normal.dot(support.m_point - vertices[face.m_a].m_point) <= 0.f)
+                {
+                    ++i;
+                    continue;
+                }
+
+                addEdge(face.m_a, face.m_b);
+                addEdge(face.m_b, face.m_c);
+                addEdge(face.m_c, face.m_a);
+
+                faces[i] = faces[--faceCount];
+            }
+
+            // The polytope can't grow any further, keep the best face found so far
+            if (faceCount + edgeCount > MAX_EPA_FACES)
+                break;
+
+            for (size_t i = 0; i < edgeCount; ++i)
+            {
+                faces[faceCount] = { Vector3::zero(), 0.f, horizon[i].m_a, horizon[i].m_b, vertexCount };
+                updateFace(vertices, faces[faceCount++]);
+            }
+
+            ++vertexCount;
+        }
+
+        // The closest face's point to the origin gives the deepest points through its barycentric coordinates
+        const SupportPoint& a = vertices[closestFace.m_a];
+        const SupportPoint& b = vertices[closestFace.m_b];
+        const SupportPoint& c = vertices[closestFace.m_c];
+
+        const Vector3 ab = b.m_point - a.m_point;
+        const Vector3 ac = c.m_point - a.m_point;
+        const Vector3 ap = closestFace.m_normal * closestFace.m_distance - a.m_point;
+
+        const float abSqr = ab.dot(ab);
+        const float abDotAc = ab.dot(ac);
+        const float acSqr = ac.dot(ac);
+        const float apDotAb = ap.dot(ab);
+        const float apDotAc = ap.dot(ac);
+        const float denominator = abSqr * acSqr - abDotAc * abDotAc;
+
+        float v = 0.f;
+        float w = 0.f;
+
+        if (denominator > FLT_EPSILON * abSqr * acSqr)
+        {
+            v = (acSqr * apDotAb - abDotAc * apDotAc) / denominator;
+            w = (abSqr * apDotAc - abDotAc * apDotAb) / denominator;
+        }
+
+        const float u = 1.f - v - w;
+
+        // The face is inside the rounded shapes' surface, which is exactly reached along the normal at the support point
+        const Vector3 surfaceOffset = closestFace.m_normal * ((supportDistance - closestFace.m_distance) * .5f);
+
+        contact =
+        {
+            closestFace.m_normal,
+            a.m_pointA * u + b.m_pointA * v + c.m_pointA * w + surfaceOffset,
+            a.m_pointB * u + b.m_pointB * v + c.m_pointB * w - surfaceOffset,
+            supportDistance
+        };
+
+        return true;
+    }
+
+    Vector3 Gjk::SupportShape::getCenter() const
+    {
+        if (m_triangle != nullptr)
+            return (m_triangle->m_a + m_triangle->m_b + m_triangle->m_c) / 3.f + m_offset;
+
+        return m_collider->getBounds().m_center + m_offset;
+    }
+
+    Vector3 Gjk::SupportShape::getSupportPoint(const Vector3& direction) const
+    {
+        if (m_triangle == nullptr)
+            return m_collider->getSupportPoint(direction) + m_offset;
+
+        const float a = m_triangle->m_a.dot(direction);
+        const float b = m_triangle->m_b.dot(direction);
+        const float c = m_triangle->m_c.dot(direction);
+
+        if (a >= b && a >= c)
+            return m_triangle->m_a + m_offset;
+
+        return (b >= c ? m_triangle->m_b : m_triangle->m_c) + m_offset;
+    }
+
+    float Gjk::SupportShape::getSupportRadius() const
+    {
+        return m_triangle != nullptr ? 0.f : m_collider->getSupportRadius();
+    }
+
+    Gjk::SupportPoint Gjk::getCoreSupport(const SupportShape& first, const SupportShape& second,
+                                          const Vector3&      direction)
+    {
+        const Vector3 pointA = first.getSupportPoint(direction);
+        const Vector3 pointB = second.getSupportPoint(-direction);
+
+        return { pointA, pointB, pointA - pointB };
+    }
+
+    Gjk::SupportPoint Gjk::getShapeSupport(const SupportShape& first, const SupportShape& second,
+                                           const Vector3&      direction)
+    {
+        const Vector3 normal = direction.normalized();
+        const Vector3 pointA = first.getSupportPoint(direction) + normal * first.getSupportRadius();
+        const Vector3 pointB = second.getSupportPoint(-direction) - normal * second.getSupportRadius();
+
+        return { pointA, pointB, pointA - pointB };
+    }
+
+    Vector3 Gjk::solveSimplex(Simplex& simplex)
+    {
+        switch (simplex.m_count)
+        {
+        case 1:
+            simplex.m_weights[0] = 1.f;
+            break;
+        case 2:
+            solveSegment(simplex);
+            break;
+        case 3:
+            solveTriangle(simplex);
+            break;
+        default:
+            solveTetrahedron(simplex);
+            break;
+        }
+
+        // The origin is inside the tetrahedron
+        if (simplex.m_count == 4)
+            return Vector3::zero();
+
+        Vector3 closest = Vector3::zero();
+
+        for (uint8_t i = 0; i < simplex.m_count; ++i)
+            closest += simplex.m_vertices[i].m_point * simplex.m_weights[i];
+
+        return closest;
+    }
+
+    void Gjk::solveSegment(Simplex& simplex)
+    {
+        const Vector3& a = simplex.m_vertices[0].m_point;
+        const Vector3  ab = simplex.m_vertices[1].m_point - a;
+
+        const float projection = -a.dot(ab);
+        const float lengthSqr = ab.dot(ab);
+
+        if (projection <= 0.f)
+        {
+            simplex.m_weights[0] = 1.f;
+            simplex.m_count = 1;
+        }
+        else if (projection >= lengthSqr)
+        {
+            simplex.m_vertices[0] = simplex.m_vertices[1];
+            simplex.m_weights[0] = 1.f;
+            simplex.m_count = 1;
+        }
+        else
+        {
+            const float ratio = projection / lengthSqr;
+
+            simplex.m_weights[0] = 1.f - ratio;
+            simplex.m_weights[1] = ratio;
+        }
+    }
+
+    void Gjk::solveTriangle(Simplex& simplex)
+    {
+        // Voronoi regions test from Real-Time Collision Detection's closest point on triangle
+        const SupportPoint a = simplex.m_vertices[0];
+        const SupportPoint b = simplex.m_vertices[1];
+        const SupportPoint c = simplex.m_vertices[2];
+
+        const auto setVertex = [&simplex](const SupportPoint& vertex)
+        {
+            simplex.m_vertices[0] = vertex;
+            simplex.m_weights[0] = 1.f;
+            simplex.m_count = 1;
+        };
+
+        const auto setEdge = [&simplex](const SupportPoint& start, const SupportPoint& end, const float numerator,
+                                        const float denominator)
+        {
+            const float ratio = denominator > 0.f ? numerator / denominator : 0.f;
+
+            simplex.m_vertices[0] = start;
+            simplex.m_vertices[1] = end;
+            simplex.m_weights[0] = 1.f - ratio;
+            simplex.m_weights[1] = ratio;
+            simplex.m_count = 2;
+        };
+
+        const Vector3 ab = b.m_point - a.m_point;
+        const Vector3 ac = c.m_point - a.m_point;
+
+        const float d1 = -ab.dot(a.m_point);
+        const float d2 = -ac.dot(a.m_point);
+
+        if (d1 <= 0.f && d2 <= 0.f)
+            return setVertex(a);
+
+        const float d3 = -ab.dot(b.m_point);
+        const float d4 = -ac.dot(b.m_point);
+
+        if (d3 >= 0.f && d4 <= d3)
+            return setVertex(b);
+
+        const float vc = d1 * d4 - d3 * d2;
+
+        if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f)
+            return setEdge(a, b, d1, d1 - d3);
+
+        const float d5 = -ab.dot(c.m_point);
+        const float d6 = -ac.dot(c.m_point);
+
+        if (d6 >= 0.f && d5 <= d6)
+            return setVertex(c);
+
+        const float vb = d5 * d2 - d1 * d6;
+
+        if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f)
+            return setEdge(a, c, d2, d2 - d6);
+
+        const float va = d3 * d6 - d5 * d4;
+
+        if (va <= 0.f && d4 - d3 >= 0.f && d5 - d6 >= 0.f)
+            return setEdge(b, c, d4 - d3, (d4 - d3) + (d5 - d6));
+
+        const float sum = va + vb + vc;
+
+        // Flat triangles have no inner region
+        if (sum <= 0.f)
+        {
+            simplex.m_count = 2;
+            return solveSegment(simplex);
+        }
+
+        simplex.m_weights[0] = va / sum;
+        simplex.m_weights[1] = vb / sum;
+        simplex.m_weights[2] = vc / sum;
+    }
+
+    void Gjk::solveTetrahedron(Simplex& simplex)
+    {
+        // Each face lists its vertices then the opposite vertex
+        constexpr uint8_t faces[4][4] = { { 0, 1, 2, 3 }, { 0, 2, 3, 1 }, { 0, 3, 1, 2 }, { 1, 3, 2, 0 } };
+
+        Simplex closestFace;
+        float   closestDistanceSqr = INFINITY;
+        bool    isOriginOutside = false;
+
+        for (const auto& [ia, ib, ic, id] : faces)
+        {
+            const Vector3& a = simplex.m_vertices[ia].m_point;
+            const Vector3  normal = (simplex.m_vertices[ib].m_point - a).cross(simplex.m_vertices[ic].m_point - a);
+            const Vector3  toOpposite = simplex.m_vertices[id].m_point - a;
+
+            const float originSide = -a.dot(normal);
+            const float oppositeSide = toOpposite.dot(normal);
+
+            // Flat tetrahedrons have no inside so all their faces must be checked
+            const bool isFlat = LibMath::abs(oppositeSide) <= FLT_EPSILON * normal.magnitude() * toOpposite.magnitude();
+
+            if (!isFlat && originSide * oppositeSide >= 0.f)
+                continue;
+
+            Simplex face;
+            face.m_vertices = { simplex.m_vertices[ia], simplex.m_vertices[ib], simplex.m_vertices[ic] };
+            face.m_count = 3;
+
+            const float distanceSqr = solveSimplex(face).magnitudeSquared();
+            isOriginOutside = true;
+
+            if (distanceSqr < closestDistanceSqr)
+            {
+                closestDistanceSqr = distanceSqr;
+                closestFace = face;
+            }
+        }
+
+        if (isOriginOutside)
+            simplex = closestFace;
+    }
+
+    bool Gjk::growSimplex(const SupportShape& first, const SupportShape& second, Simplex& simplex)
+    {
+        const std::array<Vector3, 6> axes =
+        {
+            Vector3::right(), -Vector3::right(), Vector3::up(), -Vector3::up(), Vector3::front(), -Vector3::front()
+        };
+
+        if (simplex.m_count == 1)
+        {
+            for (const Vector3& axis : axes)
+            {
+                const SupportPoint support = getShapeSupport(first, second, axis);
+
+                if (support.m_point.distanceSquaredFrom(simplex.m_vertices[0].m_point) > FLT_EPSILON)
+                {
+                    simplex.m_vertices[simplex.m_count++] = support;
+                    break;
+                }
+            }
+
+            if (simplex.m_count == 1)
+                return false;
+        }
+
+        if (simplex.m_count == 2)
+        {
+            const Vector3& a = simplex.m_vertices[0].m_point;
+            const Vector3  ab = simplex.m_vertices[1].m_point - a;
+
+            // Cross the segment with the axis it is the least aligned with to get a perpendicular direction
+            const Vector3 absAb{ LibMath::abs(ab.m_x), LibMath::abs(ab.m_y), LibMath::abs(ab.m_z) };
+            const Vector3 axis = absAb.m_x <= absAb.m_y && absAb.m_x <= absAb.m_z
+                                     ? Vector3::right()
+                                     : absAb.m_y <= absAb.m_z ? Vector3::up() : Vector3::front();
+
+            const Vector3 perpendicular = ab.cross(axis);
+            const Vector3 otherPerpendicular = ab.cross(perpendicular);
+
+            for (const Vector3& direction : { perpendicular, -perpendicular, otherPerpendicular, -otherPerpendicular })
+            {
+                const SupportPoint support = getShapeSupport(first, second, direction);
+
+                if ((support.m_point - a).cross(ab).magnitudeSquared() > FLT_EPSILON * ab.magnitudeSquared())
+                {
+                    simplex.m_vertices[simplex.m_count++] = support;
+                    break;
+                }
+            }
+
+            if (simplex.m_count == 2)
+                return false;
+        }
+
+        if (simplex.m_count == 3)
+        {
+            const Vector3& a = simplex.m_vertices[0].m_point;
+            const Vector3  normal = (simplex.m_vertices[1].m_point - a).cross(simplex.m_vertices[2].m_point - a);
+
+            for (const Vector3& direction : { normal, -normal })
+            {
+                const SupportPoint support = getShapeSupport(first, second, direction);
+
+                if (LibMath::abs((support.m_point - a).dot(normal)) > FLT_EPSILON * normal.magnitude())
+                {
+                    simplex.m_vertices[simplex.m_count++] = support;
+                    break;
+                }
+            }
+        }
+
+        return simplex.m_count == 4;
+    }
+
+    void Gjk::updateFace(const std::array<SupportPoint, MAX_EPA_VERTICES>& vertices, Face& face)
+    {
+        const Vector3& a = vertices[face.m_a].m_point;
+        const Vector3  normal = (vertices[face.m_b].m_point - a).cross(vertices[face.m_c].m_point - a);
+        const float    length = normal.magnitude();
+
+        // Degenerate faces are never picked as the closest one
+        if (length <= FLT_EPSILON)
+        {
+            face.m_normal = Vector3::zero();
+            face.m_distance = INFINITY;
+            return;
+        }
+
+        face.m_normal = normal / length;
+        face.m_distance = face.m_normal.dot(a);
+    }
+}
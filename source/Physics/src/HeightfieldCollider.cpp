@@ -0,0 +1,372 @@
+#include "HeightfieldCollider.h"
+
+#include "Arithmetic.h"
+#include "Entity.h"
+#include "Narrowphase.h"
+#include "SceneSerializer.h"
+#include "Debug/Assertion.h"
+#include "Vector/Vector4.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+    REGISTER_COMPONENT_TYPE(HeightfieldCollider);
+
+    const EShapeType HeightfieldCollider::s_shapeType = registerShapeType();
+
+    template <typename Func>
+    bool HeightfieldCollider::forEachCell(const AABB& bounds, Func&& callback) const
+    {
+        if (!bounds.overlaps(getLocalBounds()))
+            return false;
+
+        const auto toCell = [this](const float position, const uint32_t sampleCount)
+        {
+            const float cell = std::floor(position / m_cellSize);
+            return static_cast<uint32_t>(std::clamp(cell, 0.f, static_cast<float>(sampleCount - 2)));
+        };
+
+        const uint32_t firstColumn = toCell(bounds.m_min.m_x, m_columnCount);
+        const uint32_t lastColumn = toCell(bounds.m_max.m_x, m_columnCount);
+        const uint32_t firstRow = toCell(bounds.m_min.m_z, m_rowCount);
+        const uint32_t lastRow = toCell(bounds.m_max.m_z, m_rowCount);
+
+        for (uint32_t row = firstRow; row <= lastRow; ++row)
+        {
+            for (uint32_t column = firstColumn; column <= lastColumn; ++column)
+            {
+                const size_t index = static_cast<size_t>(row) * m_columnCount + column;
+
+                const auto [minHeight, maxHeight] = std::minmax({
+                    m_heights[index], m_heights[index + 1],
+                    m_heights[index + m_columnCount], m_heights[index + m_columnCount + 1]
+                });
+
+                if (minHeight > bounds.m_max.m_y || maxHeight < bounds.m_min.m_y)
+                    continue;
+
+                if (callback(column, row))
+                    return true;
+            }
+        }
+
+        return false;
+    }
+
+    HeightfieldCollider::HeightfieldCollider(Entity& owner, const uint32_t columnCount, const uint32_t rowCount,
+                                             std::vector<float> heights, const float    cellSize)
+        : ITriangleCollider(owner, calculateBounds(columnCount, rowCount, heights, cellSize), s_shapeType),
+        m_heights(std::move(heights)), m_columnCount(columnCount), m_rowCount(rowCount), m_cellSize(cellSize)
+    {
+        const auto [minHeight, maxHeight] = std::minmax_element(m_heights.begin(), m_heights.end());
+
+        m_minHeight = *minHeight;
+        m_maxHeight = *maxHeight;
+    }
+
+    AABB HeightfieldCollider::getAABB() const
+    {
+        return transformBox(getLocalBounds(), getWorldMatrix());
+    }
+
+    bool HeightfieldCollider::check(const Vector3& point) const
+    {
+        const Vector3 localPoint = (getInverseWorldMatrix() * Vector4(point, 1.f)).xyz();
+        const AABB    localBounds = getLocalBounds();
+
+        if (localPoint.m_x < localBounds.m_min.m_x || localPoint.m_x > localBounds.m_max.m_x ||
+            localPoint.m_z < localBounds.m_min.m_z || localPoint.m_z > localBounds.m_max.m_z)
+            return false;
+
+        return localPoint.m_y <= getHeight(localPoint.m_x, localPoint.m_z) + SURFACE_TOLERANCE;
+    }
+
+    bool HeightfieldCollider::check(const Ray& ray, float& distanceSqr) const
+    {
+        distanceSqr = INFINITY;
+
+        // The ray is transformed as a whole so the hit's distance is the same in local and world space
+        const Matrix4& inverseMatrix = getInverseWorldMatrix();
+        const Vector3  origin = (inverseMatrix * Vector4(ray.m_origin, 1.f)).xyz();
+        const Vector3  direction = (inverseMatrix * Vector4(ray.m_direction, 0.f)).xyz();
+
+        const AABB    localBounds = getLocalBounds();
+        const Vector3 toMin = (localBounds.m_min - origin) / direction;
+        const Vector3 toMax = (localBounds.m_max - origin) / direction;
+
+        const float entry = max(max(max(min(toMin.m_x, toMax.m_x), min(toMin.m_y, toMax.m_y)),
+            min(toMin.m_z, toMax.m_z)), 0.f);
+
+        const float exit = min(min(max(toMin.m_x, toMax.m_x), max(toMin.m_y, toMax.m_y)),
+            max(toMin.m_z, toMax.m_z));
+
+        if (entry > exit)
+            return false;
+
+        // Walk through the cells crossed by the ray, in order, until one of their triangles is hit
+        const Vector3 entryPoint = origin + direction * entry;
+
+        const auto toCell = [this](const float position, const uint32_t sampleCount)
+        {
+            const float cell = std::floor(position / m_cellSize);
+            return static_cast<int64_t>(std::clamp(cell, 0.f, static_cast<float>(sampleCount - 2)));
+        };
+
+        int64_t column = toCell(entryPoint.m_x, m_columnCount);
+        int64_t row = toCell(entryPoint.m_z, m_rowCount);
+
+        const int64_t columnStep = direction.m_x > 0.f ? 1 : -1;
+        const int64_t rowStep = direction.m_z > 0.f ? 1 : -1;
+
+        const float columnDelta = direction.m_x != 0.f ? m_cellSize / std::abs(direction.m_x) : INFINITY;
+        const float rowDelta = direction.m_z != 0.f ? m_cellSize / std::abs(direction.m_z) : INFINITY;
+
+        float nextColumn = direction.m_x != 0.f ?
+                               (static_cast<float>(column + (columnStep > 0)) * m_cellSize - origin.m_x) /
+                               direction.m_x :
+                               INFINITY;
+
+        float nextRow = direction.m_z != 0.f ?
+                            (static_cast<float>(row + (rowStep > 0)) * m_cellSize - origin.m_z) / direction.m_z :
+                            INFINITY;
+
+        while (true)
+        {
+            const auto [first, second] = getCellTriangles(static_cast<uint32_t>(column), static_cast<uint32_t>(row));
+
+            float distance = INFINITY;
+            float hitDistance;
+
+            if (raycastTriangle(first, origin, direction, hitDistance))
+                distance = hitDistance;
+
+            if (raycastTriangle(second, origin, direction, hitDistance))
+                distance = min(distance, hitDistance);
+
+            if (distance <= exit)
+            {
+                distanceSqr = (ray.m_direction * distance).magnitudeSquared();
+                return true;
+            }
+
+            if (nextColumn < nextRow)
+            {
+                if (nextColumn > exit)
+                    return false;
+
+                column += columnStep;
+                nextColumn += columnDelta;
+            }
+            else
+            {
+                if (nextRow > exit)
+                    return false;
+
+                row += rowStep;
+                nextRow += rowDelta;
+            }
+
+            if (column < 0 || column > static_cast<int64_t>(m_columnCount) - 2 ||
+                row < 0 || row > static_cast<int64_t>(m_rowCount) - 2)
+                return false;
+        }
+    }
+
+    Vector3 HeightfieldCollider::getClosestPoint(const Vector3& point) const
+    {
+        return check(point) ? point : getClosestPointOnSurface(point);
+    }
+
+    Vector3 HeightfieldCollider::getClosestPointOnSurface(const Vector3& point) const
+    {
+        const Matrix4& worldMatrix = getWorldMatrix();
+        const Vector3  localPoint = (getInverseWorldMatrix() * Vector4(point, 1.f)).xyz();
+        const AABB     localBounds = getLocalBounds();
+
+        // The surface point above or under the clamped position bounds the search to the cells around it
+        const float x = std::clamp(localPoint.m_x, localBounds.m_min.m_x, localBounds.m_max.m_x);
+        const float z = std::clamp(localPoint.m_z, localBounds.m_min.m_z, localBounds.m_max.m_z);
+
+        Vector3 closestPoint(x, getHeight(x, z), z);
+        float   closestDistanceSqr = closestPoint.distanceSquaredFrom(localPoint);
+
+        const Vector3 extents(std::sqrt(closestDistanceSqr) + SURFACE_TOLERANCE);
+
+        forEachCell(AABB{ localPoint - extents, localPoint + extents }, [&](const uint32_t column, const uint32_t row)
+        {
+            const auto [first, second] = getCellTriangles(column, row);
+
+            for (const TriangleShape& triangle : { first, second })
+            {
+                const Vector3 trianglePoint = getClosestPointOnTriangle(triangle, localPoint);
+                const float   distanceSqr = trianglePoint.distanceSquaredFrom(localPoint);
+
+                if (distanceSqr < closestDistanceSqr)
+                {
+                    closestPoint = trianglePoint;
+                    closestDistanceSqr = distanceSqr;
+                }
+            }
+
+            return false;
+        });
+
+        return (worldMatrix * Vector4(closestPoint, 1.f)).xyz();
+    }
+
+    bool HeightfieldCollider::queryTriangles(const AABB& bounds, const TriangleCallback& callback) const
+    {
+        const Matrix4& worldMatrix = getWorldMatrix();
+        const AABB     localBounds = transformBox(bounds, getInverseWorldMatrix());
+
+        return forEachCell(localBounds, [&](const uint32_t column, const uint32_t row)
+        {
+            const auto [first, second] = getCellTriangles(column, row);
+
+            for (const TriangleShape& localTriangle : { first, second })
+            {
+                const TriangleShape triangle
+                {
+                    (worldMatrix * Vector4(localTriangle.m_a, 1.f)).xyz(),
+                    (worldMatrix * Vector4(localTriangle.m_b, 1.f)).xyz(),
+                    (worldMatrix * Vector4(localTriangle.m_c, 1.f)).xyz()
+                };
+
+                // The local box is larger than the world one once the owner is rotated
+                if (triangle.getAABB().overlaps(bounds) && callback(triangle))
+                    return true;
+            }
+
+            return false;
+        });
+    }
+
+    float HeightfieldCollider::getHeight(const float x, const float z) const
+    {
+        const auto toCell = [this](const float position, const uint32_t sampleCount, float& ratio)
+        {
+            const float maxCell = static_cast<float>(sampleCount - 2);
+            const float cell = std::clamp(position / m_cellSize, 0.f, maxCell + 1.f);
+            const float index = min(std::floor(cell), maxCell);
+
+            ratio = cell - index;
+            return static_cast<uint32_t>(index);
+        };
+
+        float u, v;
+
+        const uint32_t column = toCell(x, m_columnCount, u);
+        const uint32_t row = toCell(z, m_rowCount, v);
+
+        const size_t index = static_cast<size_t>(row) * m_columnCount + column;
+
+        const float height00 = m_heights[index];
+        const float height10 = m_heights[index + 1];
+        const float height01 = m_heights[index + m_columnCount];
+        const float height11 = m_heights[index + m_columnCount + 1];
+
+        // Each cell is split along the diagonal going from its (1, 0) corner to its (0, 1) one
+        if (u + v <= 1.f)
+            return height00 + u * (height10 - height00) + v * (height01 - height00);
+
+        return height11 + (1.f - u) * (height01 - height11) + (1.f - v) * (height10 - height11);
+    }
+
+    void HeightfieldCollider::serialize(Resources::SceneWriter& writer) const
+    {
+        writer.write(m_columnCount);
+        writer.write(m_rowCount);
+        writer.write(m_cellSize);
+        writer.writeBytes(m_heights.data(), m_heights.size() * sizeof(float));
+
+        serializeSettings(writer);
+    }
+
+    HeightfieldCollider& HeightfieldCollider::deserialize(Entity& owner, Resources::SceneReader& reader)
+    {
+        const uint32_t columnCount = reader.read<uint32_t>();
+        const uint32_t rowCount = reader.read<uint32_t>();
+        const float    cellSize = reader.read<float>();
+
+        const bool isValidGrid = reader.isValid() && columnCount >= 2 && rowCount >= 2 &&
+            std::isfinite(cellSize) && cellSize > 0.f;
+
+        const size_t   sampleCount = static_cast<size_t>(columnCount) * rowCount;
+        const uint8_t* bytes = isValidGrid ? reader.readBytes(sampleCount * sizeof(float)) : nullptr;
+
+        if (bytes == nullptr)
+        {
+            reader.invalidate();
+
+            // The collider is still added with a flat grid on failure since the scene's load is aborted anyway
+            HeightfieldCollider& collider = owner.addComponent<HeightfieldCollider>(2u, 2u,
+                std::vector<float>(4, 0.f), 1.f);
+
+            collider.deserializeSettings(reader);
+
+            return collider;
+        }
+
+        std::vector<float> heights(sampleCount);
+        std::memcpy(heights.data(), bytes, sampleCount * sizeof(float));
+
+        HeightfieldCollider& collider = owner.addComponent<HeightfieldCollider>(columnCount, rowCount,
+            std::move(heights), cellSize);
+
+        collider.deserializeSettings(reader);
+
+        return collider;
+    }
+
+    std::pair<TriangleShape, TriangleShape> HeightfieldCollider::getCellTriangles(const uint32_t column,
+                                                                                  const uint32_t row) const
+    {
+        const size_t index = static_cast<size_t>(row) * m_columnCount + column;
+
+        const float left = static_cast<float>(column) * m_cellSize;
+        const float right = left + m_cellSize;
+        const float back = static_cast<float>(row) * m_cellSize;
+        const float front = back + m_cellSize;
+
+        const Vector3 corner00(left, m_heights[index], back);
+        const Vector3 corner10(right, m_heights[index + 1], back);
+        const Vector3 corner01(left, m_heights[index + m_columnCount], front);
+        const Vector3 corner11(right, m_heights[index + m_columnCount + 1], front);
+
+        // Both triangles are wound to face up
+        return {
+            TriangleShape{ corner00, corner01, corner10 },
+            TriangleShape{ corner10, corner01, corner11 }
+        };
+    }
+
+    AABB HeightfieldCollider::getLocalBounds() const
+    {
+        return {
+            Vector3(0.f, m_minHeight, 0.f),
+            Vector3(static_cast<float>(m_columnCount - 1) * m_cellSize, m_maxHeight,
+                static_cast<float>(m_rowCount - 1) * m_cellSize)
+        };
+    }
+
+    Bounds HeightfieldCollider::calculateBounds(const uint32_t columnCount, const uint32_t rowCount,
+                                                const std::vector<float>& heights, const float cellSize)
+    {
+        ASSERT(columnCount >= 2 && rowCount >= 2, "A heightfield needs at least two samples along each axis");
+        ASSERT(heights.size() == static_cast<size_t>(columnCount) * rowCount,
+            "A heightfield needs exactly one height per sample");
+        ASSERT(cellSize > 0.f, "A heightfield's cells need a positive size");
+
+        const auto [minHeight, maxHeight] = std::minmax_element(heights.begin(), heights.end());
+
+        const Vector3 size(static_cast<float>(columnCount - 1) * cellSize, *maxHeight - *minHeight,
+            static_cast<float>(rowCount - 1) * cellSize);
+
+        return BoxShape{ Vector3(size.m_x, *maxHeight + *minHeight, size.m_z) / 2.f, size }.getBounds();
+    }
+}
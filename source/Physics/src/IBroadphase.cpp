@@ -0,0 +1,80 @@
+#include "IBroadphase.h"
+
+#include "ICollider.h"
+
+namespace LibGL::Physics
+{
+    IBroadphase::IBroadphase(const float margin)
+        : m_margin(margin)
+    {
+    }
+
+    void IBroadphase::raycast(RayPacket& packet, const PacketRaycastCallback& callback) const
+    {
+        for (size_t lane = 0; lane < RayPacket::SIZE; ++lane)
+        {
+            const auto laneMask = static_cast<uint8_t>(1 << lane);
+
+            if ((packet.m_activeMask & laneMask) == 0)
+                continue;
+
+            raycast(packet.getOrigin(lane), packet.getDirection(lane), packet.m_maxDistance[lane],
+                [&packet, &callback, lane, laneMask](ICollider* collider, float)
+                {
+                    callback(collider, laneMask);
+                    return packet.m_maxDistance[lane];
+                });
+        }
+    }
+
+    bool IBroadphase::canQueryConcurrently() const
+    {
+        return true;
+    }
+
+    const PairCache& IBroadphase::getPairCache() const
+    {
+        return m_pairCache;
+    }
+
+    void IBroadphase::advancePairs()
+    {
+        m_pairCache.advance();
+    }
+
+    void IBroadphase::sortPairs()
+    {
+        m_pairCache.sort();
+    }
+
+    float IBroadphase::getMargin() const
+    {
+        return m_margin;
+    }
+
+    void IBroadphase::updatePairs(const int32_t proxyId)
+    {
+        const AABB&                    bounds = getFatBounds(proxyId);
+        const std::span<const int32_t> overlaps = m_pairCache.getOverlaps(proxyId);
+
+        // Ending a pair moves the last overlap to its index so the list is iterated backwards
+        for (size_t i = overlaps.size(); i-- > 0;)
+        {
+            const int32_t otherId = overlaps[i];
+
+            if (!getFatBounds(otherId).overlaps(bounds))
+                m_pairCache.removePair(proxyId, otherId);
+        }
+
+        const ICollider* collider = getCollider(proxyId);
+
+        m_queryResults.clear();
+        query(bounds, m_queryResults);
+
+        for (ICollider* other : m_queryResults)
+        {
+            if (other != collider)
+                m_pairCache.addPair(proxyId, other->getProxyId());
+        }
+    }
+}
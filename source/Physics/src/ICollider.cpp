@@ -1,8 +1,12 @@
 #include "ICollider.h"
 
 #include "Arithmetic.h"
+#include "CollisionDispatcher.h"
 #include "Entity.h"
+#include "Gjk.h"
+#include "SceneSerializer.h"
 #include "Interpolation.h"
+#include "Debug/Assertion.h"
 #include "Vector/Vector4.h"
 
 #include <algorithm>
@@ -62,37 +66,144 @@ namespace LibGL::Physics
     }
 
     ICollider::ICollider(const ICollider& other)
-        : Component(other), m_bounds(other.m_bounds)
+        : Component(other), m_bounds(other.m_bounds), m_dataIndex(s_worldData.allocate()), m_layers(other.m_layers),
+        m_collisionMask(other.m_collisionMask), m_shapeType(other.m_shapeType), m_isTrigger(other.m_isTrigger)
     {
         m_colliders.push_back(this);
+        markDirty();
     }
 
     ICollider::ICollider(ICollider&& other) noexcept
-        : Component(std::forward<ICollider>(other)), m_bounds(std::move(other.m_bounds))
+        : Component(std::forward<ICollider>(other)), m_collisionEnterEvent(std::move(other.m_collisionEnterEvent)),
+        m_collisionStayEvent(std::move(other.m_collisionStayEvent)),
+        m_collisionExitEvent(std::move(other.m_collisionExitEvent)),
+        m_triggerEnterEvent(std::move(other.m_triggerEnterEvent)), m_triggerExitEvent(std::move(other.m_triggerExitEvent)),
+        m_bounds(std::move(other.m_bounds)), m_dataIndex(s_worldData.allocate()), m_layers(other.m_layers),
+        m_collisionMask(other.m_collisionMask), m_shapeType(other.m_shapeType), m_isTrigger(other.m_isTrigger)
     {
         m_colliders.push_back(this);
+        markDirty();
+    }
+
+    ICollider& ICollider::operator=(const ICollider& other)
+    {
+        if (&other == this)
+            return *this;
+
+        Component::operator=(other);
+        m_bounds = other.m_bounds;
+        m_layers = other.m_layers;
+        m_collisionMask = other.m_collisionMask;
+        m_isTrigger = other.m_isTrigger;
+        s_worldData.invalidate(m_dataIndex);
+        markDirty();
+
+        return *this;
+    }
+
+    ICollider& ICollider::operator=(ICollider&& other) noexcept
+    {
+        if (&other == this)
+            return *this;
+
+        Component::operator=(std::move(other));
+        m_collisionEnterEvent = std::move(other.m_collisionEnterEvent);
+        m_collisionStayEvent = std::move(other.m_collisionStayEvent);
+        m_collisionExitEvent = std::move(other.m_collisionExitEvent);
+        m_triggerEnterEvent = std::move(other.m_triggerEnterEvent);
+        m_triggerExitEvent = std::move(other.m_triggerExitEvent);
+        m_bounds = other.m_bounds;
+        m_layers = other.m_layers;
+        m_collisionMask = other.m_collisionMask;
+        m_isTrigger = other.m_isTrigger;
+        s_worldData.invalidate(m_dataIndex);
+        markDirty();
+
+        return *this;
     }
 
     ICollider::~ICollider()
     {
         m_colliders.erase(std::ranges::find(m_colliders, this));
+        s_worldData.release(m_dataIndex);
+        s_events.removeCollider(*this);
+
+        if (m_isDirty)
+            std::erase(s_dirtyColliders, this);
+
+        if (m_proxyId != IBroadphase::NULL_PROXY)
+        {
+            s_contacts.removeProxy(m_proxyId);
+            s_broadphase->destroyProxy(m_proxyId);
+        }
     }
 
     Bounds ICollider::getBounds() const
     {
-        const Transform& transform = getOwner();
-        const Vector3    worldCenter = (transform.getWorldMatrix() * Vector4(m_bounds.m_center, 1.f)).xyz();
-        Vector3          worldSize = (transform.getWorldMatrix() * Vector4(m_bounds.m_boxSize, 0)).xyz();
+        updateWorldData();
+        return s_worldData.getBounds(m_dataIndex);
+    }
 
-        worldSize.m_x = LibMath::abs(worldSize.m_x);
-        worldSize.m_y = LibMath::abs(worldSize.m_y);
-        worldSize.m_z = LibMath::abs(worldSize.m_z);
+    WorldShape ICollider::getWorldShape() const
+    {
+        updateWorldData();
+        return { s_worldData.getBounds(m_dataIndex), s_worldData.getAxis(m_dataIndex), s_worldData.getRadius(m_dataIndex) };
+    }
 
-        const Vector3 scale = transform.getWorldScale();
-        const float   radiusScale = max(max(scale.m_x, scale.m_y), scale.m_z);
-        const float   worldRadius = m_bounds.m_sphereRadius * radiusScale;
+    EShapeType ICollider::getShapeType() const
+    {
+        return m_shapeType;
+    }
+
+    uint32_t ICollider::getDataIndex() const
+    {
+        return m_dataIndex;
+    }
+
+    uint32_t ICollider::getLayers() const
+    {
+        return m_layers;
+    }
+
+    void ICollider::setLayers(const uint32_t layers)
+    {
+        m_layers = layers;
+    }
+
+    uint32_t ICollider::getCollisionMask() const
+    {
+        return m_collisionMask;
+    }
+
+    void ICollider::setCollisionMask(const uint32_t collisionMask)
+    {
+        m_collisionMask = collisionMask;
+    }
+
+    bool ICollider::isInLayers(const uint32_t layerMask) const
+    {
+        return (m_layers & layerMask) != 0;
+    }
+
+    bool ICollider::canCollideWith(const ICollider& other) const
+    {
+        return isInLayers(other.m_collisionMask) && other.isInLayers(m_collisionMask);
+    }
 
-        return { worldCenter, worldSize, worldRadius };
+    bool ICollider::isTrigger() const
+    {
+        return m_isTrigger;
+    }
+
+    void ICollider::setTrigger(const bool isTrigger)
+    {
+        m_isTrigger = isTrigger;
+    }
+
+    AABB ICollider::getAABB() const
+    {
+        const auto [center, _, radius] = getBounds();
+        return AABB::fromCenter(center, Vector3(radius));
     }
 
     bool ICollider::check(const Vector3& point) const
@@ -105,18 +216,53 @@ namespace LibGL::Physics
     {
         const auto    [center, _, radius] = getBounds();
         const Vector3 closestPoint = ray.getClosestPoint(center);
-        const bool    colliding = closestPoint.distanceSquaredFrom(center) <= radius * radius;
+
+        // Ignore the spheres behind the ray's origin
+        const bool isInFront = (center - ray.m_origin).dot(ray.m_direction) >= 0.f ||
+            ray.m_origin.distanceSquaredFrom(center) <= radius * radius;
+
+        const bool colliding = isInFront && closestPoint.distanceSquaredFrom(center) <= radius * radius;
         distanceSqr = colliding ? closestPoint.distanceSquaredFrom(ray.m_origin) : INFINITY;
         return colliding;
     }
 
     bool ICollider::check(const ICollider& other) const
     {
-        const auto  [center, _, sphereRadius] = getBounds();
-        const auto  [otherCenter, _o, otherSphereRadius] = other.getBounds();
-        const float totalRadius = sphereRadius + otherSphereRadius;
+        return CollisionDispatcher::check(*this, other);
+    }
+
+    bool ICollider::isConvex() const
+    {
+        return true;
+    }
+
+    bool ICollider::computeContact(const ICollider& other, Contact& contact) const
+    {
+        if (isConvex())
+        {
+            if (other.isConvex())
+                return Gjk::computeContact(*this, other, contact);
+
+            if (!other.computeConcaveContact(*this, contact))
+                return false;
+
+            contact = { -contact.m_normal, contact.m_pointB, contact.m_pointA, contact.m_depth };
+            return true;
+        }
+
+        return other.isConvex() && computeConcaveContact(other, contact);
+    }
+
+    bool ICollider::computeTimeOfImpact(const ICollider& other, const Vector3& displacement, float& fraction,
+                                        Vector3&         normal) const
+    {
+        if (!isConvex())
+            return false;
+
+        if (other.isConvex())
+            return Gjk::computeTimeOfImpact(*this, other, displacement, fraction, normal);
 
-        return center.distanceSquaredFrom(otherCenter) <= totalRadius * totalRadius;
+        return other.computeConcaveTimeOfImpact(*this, displacement, fraction, normal);
     }
 
     std::vector<ICollider*> ICollider::getColliders()
@@ -124,16 +270,265 @@ namespace LibGL::Physics
         return m_colliders;
     }
 
-    ICollider::ICollider(Entity& owner, const Bounds& bounds)
-        : Component(owner), m_bounds(bounds)
+    int32_t ICollider::getProxyId() const
+    {
+        return m_proxyId;
+    }
+
+    void ICollider::updateColliders()
+    {
+        if (s_dirtyColliders.empty())
+            return;
+
+        // Proxies are created lazily since copied components only get their final owner after construction
+        for (ICollider* collider : s_dirtyColliders)
+        {
+            collider->updateWorldData();
+
+            if (collider->m_proxyId == IBroadphase::NULL_PROXY)
+                collider->m_proxyId = s_broadphase->createProxy(collider->getAABB(), collider);
+            else
+                s_broadphase->moveProxy(collider->m_proxyId, collider->getAABB());
+
+            collider->m_isDirty = false;
+        }
+
+        s_dirtyColliders.clear();
+
+#ifdef LGL_PHYSICS_DETERMINISTIC
+        // Each broadphase finds the pairs in its own traversal order, which would change the order contacts are solved in
+        s_broadphase->sortPairs();
+#endif
+    }
+
+    const IBroadphase& ICollider::getBroadphase()
+    {
+        updateColliders();
+        return *s_broadphase;
+    }
+
+    void ICollider::advancePairs()
+    {
+        s_contacts.removePairs(s_broadphase->getPairCache().getEndedPairs());
+        s_broadphase->advancePairs();
+    }
+
+    ContactCache& ICollider::getContacts()
+    {
+        return s_contacts;
+    }
+
+    CollisionEvents& ICollider::getEvents()
+    {
+        return s_events;
+    }
+
+    const ColliderWorldData& ICollider::getWorldData()
+    {
+        return s_worldData;
+    }
+
+    ICollider::ICollider(Entity& owner, const Bounds& bounds, const EShapeType shapeType)
+        : Component(owner), m_bounds(bounds), m_dataIndex(s_worldData.allocate()), m_shapeType(shapeType)
     {
         m_colliders.push_back(this);
+        markDirty();
+    }
+
+    Vector3 ICollider::getSupportPoint(const Vector3&) const
+    {
+        return getBounds().m_center;
+    }
+
+    float ICollider::getSupportRadius() const
+    {
+        return getBounds().m_sphereRadius;
+    }
+
+    bool ICollider::sweep(const Vector3& segmentStart, const Vector3& segmentEnd, const float radius,
+                          const Vector3& direction, const float maxDistance, float& distance, Vector3& hitPoint) const
+    {
+        // The gap between the capsule and the collider shrinks by at most the travelled distance,
+        // so moving by the gap can never go through the collider
+        float travelled = 0.f;
+
+        for (int i = 0; i < MAX_SWEEP_ITERATIONS && travelled <= maxDistance; ++i)
+        {
+            const Vector3 offset = direction * travelled;
+
+            Vector3     closestOnSegment;
+            Vector3     closestOnCollider;
+            const float gap = getSegmentDistance(segmentStart + offset, segmentEnd + offset, closestOnSegment,
+                closestOnCollider) - radius;
+
+            if (gap <= SWEEP_TOLERANCE)
+            {
+                distance = travelled;
+                hitPoint = closestOnCollider;
+                return true;
+            }
+
+            // The gap is convex along the sweep and can't shrink again once it started growing
+            if ((closestOnSegment - closestOnCollider).dot(direction) >= 0.f)
+                return false;
+
+            travelled += gap;
+        }
+
+        return false;
+    }
+
+    void ICollider::serializeSettings(Resources::SceneWriter& writer) const
+    {
+        writer.write(m_layers);
+        writer.write(m_collisionMask);
+        writer.write(static_cast<uint8_t>(m_isTrigger));
+    }
+
+    void ICollider::deserializeSettings(Resources::SceneReader& reader)
+    {
+        const uint32_t layers = reader.read<uint32_t>();
+        const uint32_t collisionMask = reader.read<uint32_t>();
+        const uint8_t  isTrigger = reader.read<uint8_t>();
+
+        // Fail the load on a corrupted flag instead of storing an invalid boolean
+        if (isTrigger > 1)
+        {
+            reader.invalidate();
+            return;
+        }
+
+        m_layers = layers;
+        m_collisionMask = collisionMask;
+        m_isTrigger = isTrigger != 0;
+    }
+
+    float ICollider::getWorldRadius() const
+    {
+        updateWorldData();
+        return s_worldData.getRadius(m_dataIndex);
+    }
+
+    const Vector3& ICollider::getWorldAxis() const
+    {
+        updateWorldData();
+        return s_worldData.getAxis(m_dataIndex);
+    }
+
+    float ICollider::computeWorldRadius(const Bounds& worldBounds) const
+    {
+        return worldBounds.m_sphereRadius;
+    }
+
+    Vector3 ICollider::computeWorldAxis() const
+    {
+        return (getOwner().getWorldMatrix() * Vector4(Vector3::up(), 0.f)).xyz();
+    }
+
+    void ICollider::onWorldDataUpdate(const Matrix4&) const
+    {
+    }
+
+    bool ICollider::computeConcaveContact(const ICollider&, Contact&) const
+    {
+        return false;
+    }
+
+    bool ICollider::computeConcaveTimeOfImpact(const ICollider&, const Vector3&, float&, Vector3&) const
+    {
+        return false;
+    }
+
+    void ICollider::onTransformChange()
+    {
+        s_worldData.invalidate(m_dataIndex);
+        markDirty();
+    }
+
+    float ICollider::getSegmentDistance(const Vector3& segmentStart, const Vector3& segmentEnd, Vector3& closestOnSegment,
+                                        Vector3&       closestOnCollider) const
+    {
+        const auto getDistanceAt = [&](const float ratio, Vector3& segmentPoint, Vector3& colliderPoint)
+        {
+            segmentPoint = lerp(segmentStart, segmentEnd, ratio);
+            colliderPoint = getClosestPoint(segmentPoint);
+
+            return segmentPoint.distanceFrom(colliderPoint);
+        };
+
+        float minRatio = 0.f;
+        float maxRatio = 1.f;
+
+        if (segmentStart != segmentEnd)
+        {
+            for (int i = 0; i < SEGMENT_SEARCH_ITERATIONS; ++i)
+            {
+                const float third = (maxRatio - minRatio) / 3.f;
+                const float lowRatio = minRatio + third;
+                const float highRatio = maxRatio - third;
+
+                if (getDistanceAt(lowRatio, closestOnSegment, closestOnCollider) <
+                    getDistanceAt(highRatio, closestOnSegment, closestOnCollider))
+                    maxRatio = highRatio;
+                else
+                    minRatio = lowRatio;
+            }
+        }
+
+        return getDistanceAt((minRatio + maxRatio) * .5f, closestOnSegment, closestOnCollider);
+    }
+
+    void ICollider::updateWorldData() const
+    {
+        if (s_worldData.isValid(m_dataIndex))
+            return;
+
+        ASSERT(!s_isReadingConcurrently, "Colliders can't be moved during a batched query");
+
+        const Transform& transform = getOwner();
+        const Vector3    worldCenter = (transform.getWorldMatrix() * Vector4(m_bounds.m_center, 1.f)).xyz();
+        Vector3          worldSize = (transform.getWorldMatrix() * Vector4(m_bounds.m_boxSize, 0)).xyz();
+
+        worldSize.m_x = LibMath::abs(worldSize.m_x);
+        worldSize.m_y = LibMath::abs(worldSize.m_y);
+        worldSize.m_z = LibMath::abs(worldSize.m_z);
+
+        const Vector3 scale = transform.getWorldScale();
+        const float   radiusScale = max(max(scale.m_x, scale.m_y), scale.m_z);
+        const Bounds  worldBounds{ worldCenter, worldSize, m_bounds.m_sphereRadius * radiusScale };
+
+        s_worldData.update(m_dataIndex, worldBounds, computeWorldRadius(worldBounds), computeWorldAxis());
+        onWorldDataUpdate(transform.getWorldMatrix());
+    }
+
+    void ICollider::resetProxies()
+    {
+        for (ICollider* collider : m_colliders)
+        {
+            collider->m_proxyId = IBroadphase::NULL_PROXY;
+            collider->markDirty();
+        }
+    }
+
+    void ICollider::markDirty()
+    {
+        if (m_isDirty)
+            return;
+
+        m_isDirty = true;
+        s_dirtyColliders.push_back(this);
     }
 
     Vector3 getClosestPointOnSegment(const Vector3& point, const Vector3& lineStart, const Vector3& lineEnd)
     {
         const Vector3 segmentVec = lineEnd - lineStart;
-        const float   t = (point - lineStart).dot(segmentVec) / segmentVec.magnitudeSquared();
+        const float   lengthSqr = segmentVec.magnitudeSquared();
+
+        // Capsules no taller than their diameter have a single point as their segment
+        if (floatEquals(lengthSqr, 0.f))
+            return lineStart;
+
+        const float t = (point - lineStart).dot(segmentVec) / lengthSqr;
 
         return lerp(lineStart, lineEnd, clamp(t, 0.f, 1.f));
     }
@@ -0,0 +1,167 @@
+#include "ITriangleCollider.h"
+
+#include "Arithmetic.h"
+#include "CollisionDispatcher.h"
+#include "Gjk.h"
+#include "Narrowphase.h"
+#include "Vector/Vector4.h"
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+    template <bool (*Func)(const TriangleShape&, const WorldShape&)>
+    bool ITriangleCollider::checkTriangles(const WorldShape& shape, const AABB& bounds) const
+    {
+        // Shapes fully inside the collider touch none of its triangles
+        if (check(shape.m_bounds.m_center))
+            return true;
+
+        return queryTriangles(bounds, [&shape](const TriangleShape& triangle)
+        {
+            return Func(triangle, shape);
+        });
+    }
+
+    template <bool (*Func)(const TriangleShape&, const WorldShape&)>
+    bool ITriangleCollider::checkCollider(const ICollider& triangles, const ICollider& other)
+    {
+        return static_cast<const ITriangleCollider&>(triangles).checkTriangles<Func>(other.getWorldShape(),
+            other.getAABB());
+    }
+
+    bool ITriangleCollider::check(const SphereShape& sphere) const
+    {
+        return checkTriangles<&checkTriangleSphere>(sphere.getWorldShape(), sphere.getAABB());
+    }
+
+    bool ITriangleCollider::check(const BoxShape& box) const
+    {
+        return checkTriangles<&checkTriangleBox>(box.getWorldShape(), box.getAABB());
+    }
+
+    bool ITriangleCollider::check(const CapsuleShape& capsule) const
+    {
+        return checkTriangles<&checkTriangleCapsule>(capsule.getWorldShape(), capsule.getAABB());
+    }
+
+    bool ITriangleCollider::isConvex() const
+    {
+        return false;
+    }
+
+    ITriangleCollider::ITriangleCollider(Entity& owner, const Bounds& bounds, const EShapeType shapeType)
+        : ICollider(owner, bounds, shapeType)
+    {
+    }
+
+    bool ITriangleCollider::computeConcaveContact(const ICollider& convex, Contact& contact) const
+    {
+        bool isTouching = false;
+
+        queryTriangles(convex.getAABB(), [&](const TriangleShape& triangle)
+        {
+            Contact triangleContact;
+
+            if (Gjk::computeContact(triangle, convex, triangleContact) &&
+                (!isTouching || triangleContact.m_depth > contact.m_depth))
+            {
+                contact = triangleContact;
+                isTouching = true;
+            }
+
+            return false;
+        });
+
+        return isTouching;
+    }
+
+    bool ITriangleCollider::computeConcaveTimeOfImpact(const ICollider& moving, const Vector3& displacement,
+                                                       float& fraction, Vector3& normal) const
+    {
+        const AABB startBounds = moving.getAABB();
+        const AABB sweptBounds = startBounds.merged({
+            startBounds.m_min + displacement, startBounds.m_max + displacement
+        });
+
+        const float radius = moving.getSupportRadius();
+
+        bool isHit = false;
+
+        queryTriangles(sweptBounds, [&](const TriangleShape& triangle)
+        {
+            const Vector3 triangleNormal = triangle.getNormal();
+            const float   planeDistance = triangleNormal.dot(triangle.m_a);
+
+            const float front = triangleNormal.dot(moving.getSupportPoint(triangleNormal)) + radius - planeDistance;
+            const float back = triangleNormal.dot(moving.getSupportPoint(-triangleNormal)) - radius - planeDistance;
+
+            if (back <= SURFACE_TOLERANCE && front >= -SURFACE_TOLERANCE)
+                return false;
+
+            float   triangleFraction;
+            Vector3 triangleImpactNormal;
+
+            if (Gjk::computeTimeOfImpact(moving, triangle, displacement, triangleFraction, triangleImpactNormal) &&
+                (!isHit || triangleFraction < fraction))
+            {
+                fraction = triangleFraction;
+                normal = triangleImpactNormal;
+                isHit = true;
+            }
+
+            return false;
+        });
+
+        return isHit;
+    }
+
+    EShapeType ITriangleCollider::registerShapeType()
+    {
+        const EShapeType shapeType = CollisionDispatcher::registerShapeType();
+
+        CollisionDispatcher::registerCheck(shapeType, EShapeType::BOX, &checkCollider<&checkTriangleBox>);
+        CollisionDispatcher::registerCheck(shapeType, EShapeType::SPHERE, &checkCollider<&checkTriangleSphere>);
+        CollisionDispatcher::registerCheck(shapeType, EShapeType::CAPSULE, &checkCollider<&checkTriangleCapsule>);
+
+        return shapeType;
+    }
+
+    AABB ITriangleCollider::transformBox(const AABB& box, const Matrix4& matrix)
+    {
+        AABB result{ Vector3(INFINITY), Vector3(-INFINITY) };
+
+        for (uint8_t i = 0; i < 8; ++i)
+        {
+            const Vector3 corner
+            {
+                (i & 1) != 0 ? box.m_max.m_x : box.m_min.m_x,
+                (i & 2) != 0 ? box.m_max.m_y : box.m_min.m_y,
+                (i & 4) != 0 ? box.m_max.m_z : box.m_min.m_z
+            };
+
+            const Vector3 transformed = (matrix * Vector4(corner, 1.f)).xyz();
+            result = result.merged({ transformed, transformed });
+        }
+
+        return result;
+    }
+
+    const Matrix4& ITriangleCollider::getWorldMatrix() const
+    {
+        updateWorldData();
+        return m_worldMatrix;
+    }
+
+    const Matrix4& ITriangleCollider::getInverseWorldMatrix() const
+    {
+        updateWorldData();
+        return m_inverseWorldMatrix;
+    }
+
+    void ITriangleCollider::onWorldDataUpdate(const Matrix4& worldMatrix) const
+    {
+        m_worldMatrix = worldMatrix;
+        m_inverseWorldMatrix = worldMatrix.inverse();
+    }
+}
@@ -0,0 +1,143 @@
+#include "MeshCollider.h"
+
+#include "Entity.h"
+#include "SceneSerializer.h"
+#include "Debug/Assertion.h"
+#include "Vector/Vector4.h"
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+    REGISTER_COMPONENT_TYPE(MeshCollider);
+
+    const EShapeType MeshCollider::s_shapeType = registerShapeType();
+
+    MeshCollider::MeshCollider(Entity& owner, std::shared_ptr<const TriangleMesh> mesh)
+        : ITriangleCollider(owner, calculateBounds(mesh.get()), s_shapeType), m_mesh(std::move(mesh))
+    {
+    }
+
+    MeshCollider::MeshCollider(Entity& owner, const CollisionMesh& mesh)
+        : MeshCollider(owner, mesh.getMesh())
+    {
+        m_resource = &mesh;
+    }
+
+    AABB MeshCollider::getAABB() const
+    {
+        return transformBox(m_mesh->getBounds(), getWorldMatrix());
+    }
+
+    bool MeshCollider::check(const Vector3& point) const
+    {
+        return getClosestPoint(point).distanceSquaredFrom(point) <= SURFACE_TOLERANCE * SURFACE_TOLERANCE;
+    }
+
+    bool MeshCollider::check(const Ray& ray, float& distanceSqr) const
+    {
+        distanceSqr = INFINITY;
+
+        // The ray is transformed as a whole so the hit's distance is the same in local and world space
+        const Matrix4& inverseMatrix = getInverseWorldMatrix();
+        const Vector3  localOrigin = (inverseMatrix * Vector4(ray.m_origin, 1.f)).xyz();
+        const Vector3  localDirection = (inverseMatrix * Vector4(ray.m_direction, 0.f)).xyz();
+
+        float    distance;
+        uint32_t triangleIndex;
+
+        if (!m_mesh->raycast(localOrigin, localDirection, INFINITY, distance, triangleIndex))
+            return false;
+
+        distanceSqr = (ray.m_direction * distance).magnitudeSquared();
+        return true;
+    }
+
+    Vector3 MeshCollider::getClosestPoint(const Vector3& point) const
+    {
+        return getClosestPointOnSurface(point);
+    }
+
+    Vector3 MeshCollider::getClosestPointOnSurface(const Vector3& point) const
+    {
+        const Matrix4& worldMatrix = getWorldMatrix();
+        const Vector3  localPoint = (getInverseWorldMatrix() * Vector4(point, 1.f)).xyz();
+
+        uint32_t      triangleIndex;
+        const Vector3 localClosest = m_mesh->getClosestPoint(localPoint, triangleIndex);
+
+        return (worldMatrix * Vector4(localClosest, 1.f)).xyz();
+    }
+
+    bool MeshCollider::queryTriangles(const AABB& bounds, const TriangleCallback& callback) const
+    {
+        const Matrix4& worldMatrix = getWorldMatrix();
+        const AABB     localBounds = transformBox(bounds, getInverseWorldMatrix());
+
+        return m_mesh->query(localBounds, [&](const uint32_t triangleIndex)
+        {
+            const auto [a, b, c] = m_mesh->getTriangle(triangleIndex);
+
+            const TriangleShape triangle
+            {
+                (worldMatrix * Vector4(a, 1.f)).xyz(),
+                (worldMatrix * Vector4(b, 1.f)).xyz(),
+                (worldMatrix * Vector4(c, 1.f)).xyz()
+            };
+
+            // The local box is larger than the world one once the owner is rotated
+            return triangle.getAABB().overlaps(bounds) && callback(triangle);
+        });
+    }
+
+    const std::shared_ptr<const TriangleMesh>& MeshCollider::getMesh() const
+    {
+        return m_mesh;
+    }
+
+    void MeshCollider::serialize(Resources::SceneWriter& writer) const
+    {
+        writer.write(static_cast<uint8_t>(m_resource != nullptr));
+
+        if (m_resource != nullptr)
+            writer.writeResource(m_resource);
+        else
+            m_mesh->serialize(writer);
+
+        serializeSettings(writer);
+    }
+
+    MeshCollider& MeshCollider::deserialize(Entity& owner, Resources::SceneReader& reader)
+    {
+        const uint8_t        isShared = reader.read<uint8_t>();
+        const CollisionMesh* resource = isShared == 1 ? reader.readResource<CollisionMesh>() : nullptr;
+
+        if (isShared > 1 || (isShared == 1 && resource == nullptr))
+            reader.invalidate();
+
+        if (resource != nullptr)
+        {
+            MeshCollider& collider = owner.addComponent<MeshCollider>(*resource);
+            collider.deserializeSettings(reader);
+
+            return collider;
+        }
+
+        // The collider is still added with an empty mesh on failure since the scene's load is aborted anyway
+        auto mesh = std::make_shared<const TriangleMesh>(isShared == 0 ? TriangleMesh::deserialize(reader)
+                                                                         : TriangleMesh({}, {}));
+
+        MeshCollider& collider = owner.addComponent<MeshCollider>(std::move(mesh));
+        collider.deserializeSettings(reader);
+
+        return collider;
+    }
+
+    Bounds MeshCollider::calculateBounds(const TriangleMesh* mesh)
+    {
+        ASSERT(mesh != nullptr, "A mesh collider needs a mesh");
+
+        const auto [minCorner, maxCorner] = mesh->getBounds();
+        return BoxShape{ (minCorner + maxCorner) / 2.f, maxCorner - minCorner }.getBounds();
+    }
+}
@@ -0,0 +1,456 @@
+#include "Narrowphase.h"
+
+#include "Arithmetic.h"
+#include "ICollider.h"
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+    bool checkBoundingSpheres(const WorldShape& first, const WorldShape& second)
+    {
+        const float totalRadius = first.m_bounds.m_sphereRadius + second.m_bounds.m_sphereRadius;
+        return first.m_bounds.m_center.distanceSquaredFrom(second.m_bounds.m_center) <= totalRadius * totalRadius;
+    }
+
+    bool checkSpherePoint(const WorldShape& sphere, const Vector3& point)
+    {
+        const auto [center, _, radius] = sphere.m_bounds;
+        return point.distanceSquaredFrom(center) <= radius * radius;
+    }
+
+    bool checkBoxPoint(const WorldShape& box, const Vector3& point)
+    {
+        const auto [center, size, _] = box.m_bounds;
+
+        const Vector3 min = center - size / 2.f;
+        const Vector3 max = center + size / 2.f;
+
+        return min.m_x <= point.m_x && max.m_x >= point.m_x &&
+            min.m_y <= point.m_y && max.m_y >= point.m_y &&
+            min.m_z <= point.m_z && max.m_z >= point.m_z;
+    }
+
+    bool checkCapsulePoint(const WorldShape& capsule, const Vector3& point)
+    {
+        // Check the bounding sphere first to avoid unnecessary computation
+        if (!checkSpherePoint(capsule, point))
+            return false;
+
+        const auto [center, _, halfHeight] = capsule.m_bounds;
+        const Vector3 offset = capsule.m_axis * (halfHeight - capsule.m_radius);
+
+        // Get the closest point on the capsule's center segment
+        const Vector3 closestPoint = getClosestPointOnSegment(point, center - offset, center + offset);
+
+        return point.distanceSquaredFrom(closestPoint) <= capsule.m_radius * capsule.m_radius;
+    }
+
+    Vector3 getClosestPointOnSphere(const WorldShape& sphere, const Vector3& point)
+    {
+        const auto [center, _, radius] = sphere.m_bounds;
+        return center + (point - center).normalized() * min(radius, center.distanceFrom(point));
+    }
+
+    Vector3 getClosestPointOnBox(const WorldShape& box, const Vector3& point)
+    {
+        const auto [center, size, _] = box.m_bounds;
+        return clamp(point, center - size / 2.f, center + size / 2.f);
+    }
+
+    Vector3 getClosestPointOnCapsule(const WorldShape& capsule, const Vector3& point)
+    {
+        const auto [center, _, halfHeight] = capsule.m_bounds;
+        const float radius = capsule.m_radius;
+
+        const Vector3 offset = capsule.m_axis * (halfHeight - radius);
+        const Vector3 centerPoint = getClosestPointOnSegment(point, center - offset, center + offset);
+
+        return centerPoint + (point - centerPoint).normalized() * min(radius, centerPoint.distanceFrom(point));
+    }
+
+    Vector3 getBoxSupportPoint(const WorldShape& box, const Vector3& direction)
+    {
+        const auto [center, size, _] = box.m_bounds;
+
+        return center + Vector3
+        {
+            direction.m_x >= 0.f ? size.m_x : -size.m_x,
+            direction.m_y >= 0.f ? size.m_y : -size.m_y,
+            direction.m_z >= 0.f ? size.m_z : -size.m_z
+        } / 2.f;
+    }
+
+    Vector3 getCapsuleSupportPoint(const WorldShape& capsule, const Vector3& direction)
+    {
+        const auto [center, _, halfHeight] = capsule.m_bounds;
+        const Vector3 offset = capsule.m_axis * (halfHeight - capsule.m_radius);
+
+        return direction.dot(capsule.m_axis) >= 0.f ? center + offset : center - offset;
+    }
+
+    bool checkBoxBox(const WorldShape& box, const WorldShape& other)
+    {
+        const auto [center, size, _] = box.m_bounds;
+        const auto [otherCenter, otherSize, _o] = other.m_bounds;
+
+        const Vector3 min = center - size / 2.f;
+        const Vector3 max = center + size / 2.f;
+        const Vector3 otherMin = otherCenter - otherSize / 2.f;
+        const Vector3 otherMax = otherCenter + otherSize / 2.f;
+
+        return min.m_x <= otherMax.m_x && max.m_x >= otherMin.m_x &&
+            min.m_y <= otherMax.m_y && max.m_y >= otherMin.m_y &&
+            min.m_z <= otherMax.m_z && max.m_z >= otherMin.m_z;
+    }
+
+    bool checkBoxSphere(const WorldShape& box, const WorldShape& sphere)
+    {
+        // Check the bounding spheres first to avoid unnecessary computation
+        if (!checkBoundingSpheres(box, sphere))
+            return false;
+
+        // If the closest point to the sphere's center is in the sphere, the box and sphere collide
+        return checkSpherePoint(sphere, getClosestPointOnBox(box, sphere.m_bounds.m_center));
+    }
+
+    bool checkBoxCapsule(const WorldShape& box, const WorldShape& capsule)
+    {
+        // Check the bounding spheres first to avoid unnecessary computation
+        if (!checkBoundingSpheres(box, capsule))
+            return false;
+
+        // Compute the closest point on the box to the capsule
+        const auto    [boxCenter, boxSize, _] = box.m_bounds;
+        const Vector3 halfSize = boxSize * 0.5f;
+
+        const Vector3 capsuleCenter = capsule.m_bounds.m_center;
+        const float   capsuleRadius = capsule.m_radius;
+        const float   capsuleHeight = capsule.m_bounds.m_sphereRadius * 2.f;
+
+        // Check if the capsule is inside of the box
+        const Vector3 closestOnCapsule = getClosestPointOnCapsule(capsule, boxCenter);
+        const Vector3 closestOnBox = getClosestPointOnBox(box, closestOnCapsule);
+
+        if (checkBoxPoint(box, closestOnCapsule) || checkCapsulePoint(capsule, closestOnBox))
+            return true;
+
+        Vector3 capsuleToBox = boxCenter - capsuleCenter;
+        Vector3 closestPoint;
+
+        // Check intersection on each axis
+        for (int i = 0; i < 3; i++)
+        {
+            // First check if the capsule is above or below the box
+            const float boxMin = boxCenter[i] - halfSize[i];
+            const float boxMax = boxCenter[i] + halfSize[i];
+            const float capsuleMin = capsuleCenter[i] - capsuleHeight * 0.5f;
+            const float capsuleMax = capsuleCenter[i] + capsuleHeight * 0.5f;
+
+            // Capsule is completely above or below the box, so there's no collision
+            if (capsuleMin > boxMax || capsuleMax < boxMin)
+                return false;
+
+            // Check if the capsule is intersecting the box in the x-z plane
+            capsuleToBox.m_y = 0.f;
+            capsuleToBox = capsuleToBox.normalized();
+
+            Vector3 boxExtents = halfSize - Vector3(capsuleRadius, 0.f, capsuleRadius);
+            boxExtents = max(boxExtents, Vector3::zero());
+
+            closestPoint = boxCenter + capsuleToBox * (boxExtents.m_x * (capsuleToBox.m_x > 0 ? 1.f : -1.f));
+            closestPoint = closestPoint + Vector3::up() * capsuleHeight * 0.5f * (capsuleToBox.m_y > 0 ? 1.f : -1.f);
+
+            if (closestPoint.m_y < boxMin)
+                closestPoint.m_y = boxMin;
+            else if (closestPoint.m_y > boxMax)
+                closestPoint.m_y = boxMax;
+        }
+
+        // Check if the closest point on the box is inside the capsule
+        const float dist = (closestPoint - capsuleCenter).magnitudeSquared();
+        return dist < capsuleRadius * capsuleRadius;
+    }
+
+    bool checkSphereSphere(const WorldShape& sphere, const WorldShape& other)
+    {
+        return checkBoundingSpheres(sphere, other);
+    }
+
+    bool checkSphereCapsule(const WorldShape& sphere, const WorldShape& capsule)
+    {
+        // Check the bounding spheres first to avoid unnecessary computation
+        if (!checkBoundingSpheres(sphere, capsule))
+            return false;
+
+        const auto [center, _, radius] = sphere.m_bounds;
+        const auto [capsuleCenter, _c, capsuleHalfHeight] = capsule.m_bounds;
+
+        const Vector3 capsuleOffset = capsule.m_axis * (capsuleHalfHeight - capsule.m_radius);
+        const float   totalRadius = radius + capsule.m_radius;
+
+        // Get the closest point to the sphere's center on the capsule's center segment
+        const Vector3 closestPoint = getClosestPointOnSegment(center,
+            capsuleCenter - capsuleOffset,
+            capsuleCenter + capsuleOffset);
+
+        return center.distanceSquaredFrom(closestPoint) <= totalRadius * totalRadius;
+    }
+
+    bool checkCapsuleCapsule(const WorldShape& capsule, const WorldShape& other)
+    {
+        // Check the bounding spheres first to avoid unnecessary computation
+        if (!checkBoundingSpheres(capsule, other))
+            return false;
+
+        const auto    [center, _, halfHeight] = capsule.m_bounds;
+        const Vector3 offset = capsule.m_axis * (halfHeight - capsule.m_radius);
+
+        const auto    [otherCenter, _o, otherHalfHeight] = other.m_bounds;
+        const Vector3 otherOffset = other.m_axis * (otherHalfHeight - other.m_radius);
+
+        const float totalRadius = capsule.m_radius + other.m_radius;
+
+        const Ray ray = { center, capsule.m_axis };
+        const Ray otherRay = { otherCenter, other.m_axis };
+
+        auto [closest, otherClosest] = ray.getClosestPoints(otherRay);
+
+        closest = getClosestPointOnSegment(closest, center - offset, center + offset);
+        otherClosest = getClosestPointOnSegment(closest, otherCenter - otherOffset, otherCenter + otherOffset);
+
+        return closest.distanceSquaredFrom(otherClosest) <= totalRadius * totalRadius;
+    }
+
+    std::pair<Vector3, Vector3> getClosestPointsOnSegments(const Vector3& firstStart, const Vector3& firstEnd,
+                                                           const Vector3& secondStart, const Vector3& secondEnd)
+    {
+        // Closest points of two segments from Real-Time Collision Detection
+        const Vector3 firstDir = firstEnd - firstStart;
+        const Vector3 secondDir = secondEnd - secondStart;
+        const Vector3 startOffset = firstStart - secondStart;
+
+        const float firstLengthSqr = firstDir.dot(firstDir);
+        const float secondLengthSqr = secondDir.dot(secondDir);
+        const float secondProjection = secondDir.dot(startOffset);
+
+        // Segments reduced to a point
+        if (floatEquals(firstLengthSqr, 0.f))
+        {
+            if (floatEquals(secondLengthSqr, 0.f))
+                return { firstStart, secondStart };
+
+            return { firstStart, secondStart + secondDir * clamp(secondProjection / secondLengthSqr, 0.f, 1.f) };
+        }
+
+        const float firstProjection = firstDir.dot(startOffset);
+
+        if (floatEquals(secondLengthSqr, 0.f))
+            return { firstStart + firstDir * clamp(-firstProjection / firstLengthSqr, 0.f, 1.f), secondStart };
+
+        const float dirsDot = firstDir.dot(secondDir);
+        const float denominator = firstLengthSqr * secondLengthSqr - dirsDot * dirsDot;
+
+        // Parallel segments have no single closest pair, any point of the first one works
+        float firstRatio = denominator > 0.f
+                               ? clamp((dirsDot * secondProjection - firstProjection * secondLengthSqr) / denominator,
+                                   0.f, 1.f)
+                               : 0.f;
+
+        float secondRatio = (dirsDot * firstRatio + secondProjection) / secondLengthSqr;
+
+        if (secondRatio < 0.f)
+        {
+            secondRatio = 0.f;
+            firstRatio = clamp(-firstProjection / firstLengthSqr, 0.f, 1.f);
+        }
+        else if (secondRatio > 1.f)
+        {
+            secondRatio = 1.f;
+            firstRatio = clamp((dirsDot - firstProjection) / firstLengthSqr, 0.f, 1.f);
+        }
+
+        return { firstStart + firstDir * firstRatio, secondStart + secondDir * secondRatio };
+    }
+
+    Vector3 getClosestPointOnTriangle(const TriangleShape& triangle, const Vector3& point)
+    {
+        // Voronoi regions test from Real-Time Collision Detection's closest point on triangle
+        const auto& [a, b, c] = triangle;
+
+        const Vector3 ab = b - a;
+        const Vector3 ac = c - a;
+
+        const float d1 = ab.dot(point - a);
+        const float d2 = ac.dot(point - a);
+
+        if (d1 <= 0.f && d2 <= 0.f)
+            return a;
+
+        const float d3 = ab.dot(point - b);
+        const float d4 = ac.dot(point - b);
+
+        if (d3 >= 0.f && d4 <= d3)
+            return b;
+
+        const float vc = d1 * d4 - d3 * d2;
+
+        if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f)
+            return a + ab * (d1 / (d1 - d3));
+
+        const float d5 = ab.dot(point - c);
+        const float d6 = ac.dot(point - c);
+
+        if (d6 >= 0.f && d5 <= d6)
+            return c;
+
+        const float vb = d5 * d2 - d1 * d6;
+
+        if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f)
+            return a + ac * (d2 / (d2 - d6));
+
+        const float va = d3 * d6 - d5 * d4;
+
+        if (va <= 0.f && d4 - d3 >= 0.f && d5 - d6 >= 0.f)
+            return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+        const float sum = va + vb + vc;
+
+        // Flat triangles have no inner region, their closest point is on one of their edges
+        if (sum <= 0.f)
+        {
+            const Vector3 onAb = getClosestPointOnSegment(point, a, b);
+            const Vector3 onBc = getClosestPointOnSegment(point, b, c);
+            const Vector3 onCa = getClosestPointOnSegment(point, c, a);
+
+            const Vector3 closest = point.distanceSquaredFrom(onAb) <= point.distanceSquaredFrom(onBc) ? onAb : onBc;
+            return point.distanceSquaredFrom(closest) <= point.distanceSquaredFrom(onCa) ? closest : onCa;
+        }
+
+        return a + ab * (vb / sum) + ac * (vc / sum);
+    }
+
+    bool raycastTriangle(const TriangleShape& triangle, const Vector3& origin, const Vector3& direction,
+                         float&               distance)
+    {
+        // Möller-Trumbore intersection, solving for the hit's barycentric coordinates and distance at once
+        const auto& [a, b, c] = triangle;
+
+        const Vector3 ab = b - a;
+        const Vector3 ac = c - a;
+        const Vector3 normalCross = direction.cross(ac);
+        const float   determinant = ab.dot(normalCross);
+
+        // The ray is parallel to the triangle
+        if (floatEquals(determinant, 0.f))
+            return false;
+
+        const float   inverseDeterminant = 1.f / determinant;
+        const Vector3 toOrigin = origin - a;
+        const float   u = toOrigin.dot(normalCross) * inverseDeterminant;
+
+        if (u < 0.f || u > 1.f)
+            return false;
+
+        const Vector3 edgeCross = toOrigin.cross(ab);
+        const float   v = direction.dot(edgeCross) * inverseDeterminant;
+
+        if (v < 0.f || u + v > 1.f)
+            return false;
+
+        const float hitDistance = ac.dot(edgeCross) * inverseDeterminant;
+
+        if (hitDistance < 0.f)
+            return false;
+
+        distance = hitDistance;
+        return true;
+    }
+
+    bool checkTriangleSphere(const TriangleShape& triangle, const WorldShape& sphere)
+    {
+        return checkSpherePoint(sphere, getClosestPointOnTriangle(triangle, sphere.m_bounds.m_center));
+    }
+
+    bool checkTriangleBox(const TriangleShape& triangle, const WorldShape& box)
+    {
+        // Separating axis test from Akenine-Möller's triangle-box overlap, done in the box's space
+        const auto [center, size, _] = box.m_bounds;
+        const Vector3 halfSize = size / 2.f;
+
+        const Vector3 a = triangle.m_a - center;
+        const Vector3 b = triangle.m_b - center;
+        const Vector3 c = triangle.m_c - center;
+
+        const auto isSeparatingAxis = [&](const Vector3& axis)
+        {
+            const float projectedA = a.dot(axis);
+            const float projectedB = b.dot(axis);
+            const float projectedC = c.dot(axis);
+
+            const float radius = halfSize.m_x * LibMath::abs(axis.m_x) + halfSize.m_y * LibMath::abs(axis.m_y) +
+                halfSize.m_z * LibMath::abs(axis.m_z);
+
+            return min(min(projectedA, projectedB), projectedC) > radius ||
+                max(max(projectedA, projectedB), projectedC) < -radius;
+        };
+
+        const Vector3 edges[3] = { b - a, c - b, a - c };
+        const Vector3 axes[3] = { Vector3::right(), Vector3::up(), Vector3::front() };
+
+        // The box's faces
+        for (const Vector3& axis : axes)
+        {
+            if (isSeparatingAxis(axis))
+                return false;
+        }
+
+        // The triangle's face
+        if (isSeparatingAxis(edges[0].cross(edges[1])))
+            return false;
+
+        // The cross products of the box's and triangle's edges
+        for (const Vector3& axis : axes)
+        {
+            for (const Vector3& edge : edges)
+            {
+                if (isSeparatingAxis(axis.cross(edge)))
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool checkTriangleCapsule(const TriangleShape& triangle, const WorldShape& capsule)
+    {
+        const auto    [center, _, halfHeight] = capsule.m_bounds;
+        const Vector3 offset = capsule.m_axis * (halfHeight - capsule.m_radius);
+        const Vector3 segmentStart = center - offset;
+        const Vector3 segmentEnd = center + offset;
+        const float   radiusSqr = capsule.m_radius * capsule.m_radius;
+
+        // The capsule's segment goes through the triangle
+        float hitRatio;
+
+        if (raycastTriangle(triangle, segmentStart, segmentEnd - segmentStart, hitRatio) && hitRatio <= 1.f)
+            return true;
+
+        // Otherwise the closest points are on the segment's ends or on one of the triangle's edges
+        if (getClosestPointOnTriangle(triangle, segmentStart).distanceSquaredFrom(segmentStart) <= radiusSqr ||
+            getClosestPointOnTriangle(triangle, segmentEnd).distanceSquaredFrom(segmentEnd) <= radiusSqr)
+            return true;
+
+        const auto& [a, b, c] = triangle;
+
+        for (const auto& [edgeStart, edgeEnd] : { std::pair{ a, b }, std::pair{ b, c }, std::pair{ c, a } })
+        {
+            const auto [onSegment, onEdge] = getClosestPointsOnSegments(segmentStart, segmentEnd, edgeStart, edgeEnd);
+
+            if (onSegment.distanceSquaredFrom(onEdge) <= radiusSqr)
+                return true;
+        }
+
+        return false;
+    }
+}
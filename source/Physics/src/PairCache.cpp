@@ -0,0 +1,139 @@
+#include "PairCache.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace LibGL::Physics
+{
+    void PairCache::addPair(int32_t first, int32_t second)
+    {
+        if (first > second)
+            std::swap(first, second);
+
+        const auto [it, isNew] = m_pairIndices.try_emplace(getKey(first, second), m_pairs.size());
+
+        if (!isNew)
+            return;
+
+        m_pairs.push_back({ first, second, EPairState::BEGIN });
+
+        if (m_overlaps.size() <= static_cast<size_t>(second))
+            m_overlaps.resize(static_cast<size_t>(second) + 1);
+
+        m_overlaps[static_cast<size_t>(first)].push_back(second);
+        m_overlaps[static_cast<size_t>(second)].push_back(first);
+    }
+
+    void PairCache::removePair(const int32_t first, const int32_t second)
+    {
+        const auto it = m_pairIndices.find(getKey(first, second));
+
+        if (it == m_pairIndices.end())
+            return;
+
+        const size_t index = it->second;
+
+        // Pairs which began since the last advance never existed from the consumers' point of view
+        if (m_pairs[index].m_state != EPairState::BEGIN)
+            m_endedPairs.push_back({ m_pairs[index].m_first, m_pairs[index].m_second, EPairState::END });
+
+        erasePair(index);
+    }
+
+    void PairCache::removeProxy(const int32_t proxyId)
+    {
+        if (static_cast<size_t>(proxyId) < m_overlaps.size())
+        {
+            // Erasing a pair removes it from the proxy's overlaps
+            const std::vector<int32_t>& overlaps = m_overlaps[static_cast<size_t>(proxyId)];
+
+            while (!overlaps.empty())
+                erasePair(m_pairIndices.at(getKey(proxyId, overlaps.back())));
+        }
+
+        const auto isProxyPair = [proxyId](const OverlapPair& pair)
+        {
+            return pair.m_first == proxyId || pair.m_second == proxyId;
+        };
+
+        // The proxy id can be reused so its ended pairs can't be kept either
+        std::erase_if(m_endedPairs, isProxyPair);
+    }
+
+    void PairCache::advance()
+    {
+        m_endedPairs.clear();
+
+        for (OverlapPair& pair : m_pairs)
+            pair.m_state = EPairState::PERSIST;
+    }
+
+    void PairCache::sort()
+    {
+        std::ranges::sort(m_pairs, {}, [](const OverlapPair& pair)
+        {
+            return getKey(pair.m_first, pair.m_second);
+        });
+
+        for (size_t i = 0; i < m_pairs.size(); ++i)
+            m_pairIndices[getKey(m_pairs[i].m_first, m_pairs[i].m_second)] = i;
+    }
+
+    bool PairCache::contains(const int32_t first, const int32_t second) const
+    {
+        return m_pairIndices.contains(getKey(first, second));
+    }
+
+    std::span<const OverlapPair> PairCache::getPairs() const
+    {
+        return m_pairs;
+    }
+
+    std::span<const OverlapPair> PairCache::getEndedPairs() const
+    {
+        return m_endedPairs;
+    }
+
+    std::span<const int32_t> PairCache::getOverlaps(const int32_t proxyId) const
+    {
+        if (proxyId < 0 || static_cast<size_t>(proxyId) >= m_overlaps.size())
+            return {};
+
+        return m_overlaps[static_cast<size_t>(proxyId)];
+    }
+
+    void PairCache::erasePair(const size_t index)
+    {
+        const OverlapPair pair = m_pairs[index];
+
+        eraseOverlap(pair.m_first, pair.m_second);
+        eraseOverlap(pair.m_second, pair.m_first);
+        m_pairIndices.erase(getKey(pair.m_first, pair.m_second));
+
+        // Fill the hole with the last pair to keep the list contiguous
+        if (index != m_pairs.size() - 1)
+        {
+            m_pairs[index] = m_pairs.back();
+            m_pairIndices[getKey(m_pairs[index].m_first, m_pairs[index].m_second)] = index;
+        }
+
+        m_pairs.pop_back();
+    }
+
+    void PairCache::eraseOverlap(const int32_t proxyId, const int32_t otherId)
+    {
+        std::vector<int32_t>& overlaps = m_overlaps[static_cast<size_t>(proxyId)];
+
+        const auto it = std::ranges::find(overlaps, otherId);
+        *it = overlaps.back();
+        overlaps.pop_back();
+    }
+
+    uint64_t PairCache::getKey(const int32_t first, const int32_t second)
+    {
+        const uint64_t low = static_cast<uint32_t>(std::min(first, second));
+        const uint64_t high = static_cast<uint32_t>(std::max(first, second));
+
+        return high << 32 | low;
+    }
+}
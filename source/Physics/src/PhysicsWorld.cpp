@@ -0,0 +1,88 @@
+#include "PhysicsWorld.h"
+
+#include "Arithmetic.h"
+#include "Rigidbody.h"
+#include "Debug/Assertion.h"
+
+#include <cmath>
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+    PhysicsWorld::PhysicsWorld(const float fixedDeltaTime, const uint8_t maxSubsteps)
+        : m_fixedDeltaTime(fixedDeltaTime), m_maxSubsteps(maxSubsteps)
+    {
+        ASSERT(fixedDeltaTime > 0.f, "The physics world's fixed delta time must be positive");
+        ASSERT(maxSubsteps > 0, "The physics world must run at least one step per update");
+    }
+
+    uint8_t PhysicsWorld::update(const float deltaTime)
+    {
+        // The positions shown during the last frame aren't the simulated ones
+        Rigidbody::restorePositions();
+
+        m_accumulator += max(deltaTime, 0.f);
+
+        uint8_t stepCount = 0;
+
+        while (m_accumulator >= m_fixedDeltaTime && stepCount < m_maxSubsteps)
+        {
+            Rigidbody::step(m_fixedDeltaTime);
+            m_accumulator -= m_fixedDeltaTime;
+            ++stepCount;
+            ++m_stepCount;
+        }
+
+        // Catching up would take longer than the frame, the simulation slows down instead
+        if (m_accumulator >= m_fixedDeltaTime)
+            m_accumulator = fmod(m_accumulator, m_fixedDeltaTime);
+
+        if (m_shouldInterpolate)
+            Rigidbody::interpolatePositions(getInterpolationFactor());
+
+        return stepCount;
+    }
+
+    float PhysicsWorld::getFixedDeltaTime() const
+    {
+        return m_fixedDeltaTime;
+    }
+
+    void PhysicsWorld::setFixedDeltaTime(const float fixedDeltaTime)
+    {
+        ASSERT(fixedDeltaTime > 0.f, "The physics world's fixed delta time must be positive");
+        m_fixedDeltaTime = fixedDeltaTime;
+    }
+
+    uint8_t PhysicsWorld::getMaxSubsteps() const
+    {
+        return m_maxSubsteps;
+    }
+
+    void PhysicsWorld::setMaxSubsteps(const uint8_t maxSubsteps)
+    {
+        ASSERT(maxSubsteps > 0, "The physics world must run at least one step per update");
+        m_maxSubsteps = maxSubsteps;
+    }
+
+    bool PhysicsWorld::isInterpolating() const
+    {
+        return m_shouldInterpolate;
+    }
+
+    void PhysicsWorld::setInterpolation(const bool shouldInterpolate)
+    {
+        m_shouldInterpolate = shouldInterpolate;
+    }
+
+    float PhysicsWorld::getInterpolationFactor() const
+    {
+        return clamp(m_accumulator / m_fixedDeltaTime, 0.f, 1.f);
+    }
+
+    uint64_t PhysicsWorld::getStepCount() const
+    {
+        return m_stepCount;
+    }
+}
@@ -0,0 +1,145 @@
+#include "RayPacket.h"
+
+#include "Arithmetic.h"
+#include "Debug/Assertion.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define LGL_RAY_PACKET_SSE 1
+#include <xmmintrin.h>
+#else
+#define LGL_RAY_PACKET_SSE 0
+#endif
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+    void RayPacket::setRay(const size_t lane, const Vector3& origin, const Vector3& direction, const float maxDistance)
+    {
+        ASSERT(lane < SIZE, "Ray packet lane out of range");
+
+        // A huge finite inverse for the null components keeps the slabs' products free of NaNs (0 * inf)
+        constexpr float parallelInverse = 1e30f;
+
+        m_originX[lane] = origin.m_x;
+        m_originY[lane] = origin.m_y;
+        m_originZ[lane] = origin.m_z;
+        m_directionX[lane] = direction.m_x;
+        m_directionY[lane] = direction.m_y;
+        m_directionZ[lane] = direction.m_z;
+        m_inverseDirX[lane] = floatEquals(direction.m_x, 0.f) ? parallelInverse : 1.f / direction.m_x;
+        m_inverseDirY[lane] = floatEquals(direction.m_y, 0.f) ? parallelInverse : 1.f / direction.m_y;
+        m_inverseDirZ[lane] = floatEquals(direction.m_z, 0.f) ? parallelInverse : 1.f / direction.m_z;
+        m_maxDistance[lane] = maxDistance;
+
+        m_activeMask |= static_cast<uint8_t>(1 << lane);
+    }
+
+    Vector3 RayPacket::getOrigin(const size_t lane) const
+    {
+        return { m_originX[lane], m_originY[lane], m_originZ[lane] };
+    }
+
+    Vector3 RayPacket::getDirection(const size_t lane) const
+    {
+        return { m_directionX[lane], m_directionY[lane], m_directionZ[lane] };
+    }
+
+#if LGL_RAY_PACKET_SSE
+    uint8_t RayPacket::raycast(const AABB& bounds) const
+    {
+        __m128 distMin = _mm_setzero_ps();
+        __m128 distMax = _mm_load_ps(m_maxDistance);
+
+        const auto clipSlab = [&distMin, &distMax](const float min, const float max, const float* origin,
+                                                   const float* inverseDir)
+        {
+            const __m128 originLanes = _mm_load_ps(origin);
+            const __m128 inverseLanes = _mm_load_ps(inverseDir);
+
+            const __m128 distNear = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(min), originLanes), inverseLanes);
+            const __m128 distFar = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(max), originLanes), inverseLanes);
+
+            distMin = _mm_max_ps(distMin, _mm_min_ps(distNear, distFar));
+            distMax = _mm_min_ps(distMax, _mm_max_ps(distNear, distFar));
+        };
+
+        clipSlab(bounds.m_min.m_x, bounds.m_max.m_x, m_originX, m_inverseDirX);
+        clipSlab(bounds.m_min.m_y, bounds.m_max.m_y, m_originY, m_inverseDirY);
+        clipSlab(bounds.m_min.m_z, bounds.m_max.m_z, m_originZ, m_inverseDirZ);
+
+        return static_cast<uint8_t>(_mm_movemask_ps(_mm_cmple_ps(distMin, distMax))) & m_activeMask;
+    }
+
+    uint8_t RayPacket::raycastSphere(const Vector3& center, const float radius) const
+    {
+        const __m128 toCenterX = _mm_sub_ps(_mm_set1_ps(center.m_x), _mm_load_ps(m_originX));
+        const __m128 toCenterY = _mm_sub_ps(_mm_set1_ps(center.m_y), _mm_load_ps(m_originY));
+        const __m128 toCenterZ = _mm_sub_ps(_mm_set1_ps(center.m_z), _mm_load_ps(m_originZ));
+
+        // Distance along the ray to the center's projection and squared distance from the center to the ray
+        const __m128 projection = _mm_add_ps(_mm_add_ps(
+                                                 _mm_mul_ps(toCenterX, _mm_load_ps(m_directionX)),
+                                                 _mm_mul_ps(toCenterY, _mm_load_ps(m_directionY))),
+                                             _mm_mul_ps(toCenterZ, _mm_load_ps(m_directionZ)));
+
+        const __m128 centerDistSqr = _mm_add_ps(_mm_add_ps(
+                                                    _mm_mul_ps(toCenterX, toCenterX),
+                                                    _mm_mul_ps(toCenterY, toCenterY)),
+                                                _mm_mul_ps(toCenterZ, toCenterZ));
+
+        const __m128 radiusSqr = _mm_set1_ps(radius * radius);
+        const __m128 halfChordSqr = _mm_sub_ps(radiusSqr, _mm_sub_ps(centerDistSqr, _mm_mul_ps(projection, projection)));
+        const __m128 halfChord = _mm_sqrt_ps(_mm_max_ps(halfChordSqr, _mm_setzero_ps()));
+
+        // The line must cross the sphere, the sphere can't be behind the origin and must start before the max distance
+        const __m128 crossesLine = _mm_cmpge_ps(halfChordSqr, _mm_setzero_ps());
+        const __m128 isAhead = _mm_cmpge_ps(_mm_add_ps(projection, halfChord), _mm_setzero_ps());
+        const __m128 isInRange = _mm_cmple_ps(_mm_sub_ps(projection, halfChord), _mm_load_ps(m_maxDistance));
+
+        const __m128 hits = _mm_and_ps(crossesLine, _mm_and_ps(isAhead, isInRange));
+        return static_cast<uint8_t>(_mm_movemask_ps(hits)) & m_activeMask;
+    }
+#else
+    uint8_t RayPacket::raycast(const AABB& bounds) const
+    {
+        uint8_t mask = 0;
+
+        for (size_t lane = 0; lane < SIZE; ++lane)
+        {
+            float distance;
+
+            if ((m_activeMask & (1 << lane)) != 0 &&
+                bounds.raycast(getOrigin(lane), getDirection(lane), m_maxDistance[lane], distance))
+                mask |= static_cast<uint8_t>(1 << lane);
+        }
+
+        return mask;
+    }
+
+    uint8_t RayPacket::raycastSphere(const Vector3& center, const float radius) const
+    {
+        uint8_t mask = 0;
+
+        for (size_t lane = 0; lane < SIZE; ++lane)
+        {
+            if ((m_activeMask & (1 << lane)) == 0)
+                continue;
+
+            const Vector3 toCenter = center - getOrigin(lane);
+            const float   projection = toCenter.dot(getDirection(lane));
+            const float   halfChordSqr = radius * radius - (toCenter.magnitudeSquared() - projection * projection);
+
+            if (halfChordSqr < 0.f)
+                continue;
+
+            const float halfChord = squareRoot(halfChordSqr);
+
+            if (projection + halfChord >= 0.f && projection - halfChord <= m_maxDistance[lane])
+                mask |= static_cast<uint8_t>(1 << lane);
+        }
+
+        return mask;
+    }
+#endif
+}
@@ -2,38 +2,52 @@
 
 #include "Arithmetic.h"
 #include "ICollider.h"
+#include "Debug/Assertion.h"
+#include "Utility/ServiceLocator.h"
+#include "Utility/ThreadPool.h"
+
+#include <algorithm>
+#include <array>
 
 using namespace LibMath;
 
 namespace LibGL::Physics
 {
-    bool raycast(const Vector3& origin, const Vector3& direction, const float maxDistance)
+    bool raycast(const Vector3& origin, const Vector3& direction, const float maxDistance, const uint32_t layerMask)
     {
         RaycastHit discard;
-        return raycast(origin, direction, discard, maxDistance);
+        return raycast(origin, direction, discard, maxDistance, layerMask);
     }
 
-    bool raycast(const Vector3& origin, const Vector3& direction, RaycastHit& hitInfo, const float maxDistance)
+    bool raycast(const Vector3& origin, const Vector3& direction, RaycastHit& hitInfo, const float maxDistance,
+                 const uint32_t layerMask)
     {
         const Vector3 dir = direction.normalized();
-        const auto    colliders = ICollider::getColliders();
         const Ray     ray{ origin, dir };
         const float   maxDistanceSqr = maxDistance * maxDistance;
 
-        for (const auto& collider : colliders)
+        // Only the colliders whose box is crossed by the ray before the current closest hit are checked
+        const auto checkCollider = [&](ICollider* collider, const float clipDistance)
         {
-            if (collider == nullptr || !collider->isActive())
-                continue;
+            if (!collider->isActive() || !collider->isInLayers(layerMask))
+                return clipDistance;
 
             const auto  closestOnCollider = collider->getClosestPoint(origin);
             const float distanceSqr = origin.distanceSquaredFrom(closestOnCollider);
+            float       hitDistanceSqr;
 
             if (distanceSqr > maxDistanceSqr || distanceSqr >= hitInfo.m_distance ||
-                !collider->check(ray, hitInfo.m_distance) || hitInfo.m_distance > maxDistanceSqr)
-                continue;
+                !collider->check(ray, hitDistanceSqr) || hitDistanceSqr > maxDistanceSqr ||
+                hitDistanceSqr >= hitInfo.m_distance)
+                return clipDistance;
 
             hitInfo.m_collider = collider;
-        }
+            hitInfo.m_distance = hitDistanceSqr;
+
+            return min(clipDistance, squareRoot(hitDistanceSqr));
+        };
+
+        ICollider::getBroadphase().raycast(origin, dir, maxDistance, checkCollider);
 
         if (hitInfo.m_collider != nullptr)
         {
@@ -48,4 +62,140 @@ namespace LibGL::Physics
 
         return hitInfo.m_collider != nullptr;
     }
+
+    size_t raycastAll(const Vector3& origin, const Vector3& direction, std::vector<RaycastHit>& hits,
+                      const float    maxDistance, const uint32_t layerMask)
+    {
+        const Vector3 dir = direction.normalized();
+        const Ray     ray{ origin, dir };
+        const float   maxDistanceSqr = maxDistance * maxDistance;
+
+        hits.clear();
+
+        // The ray is never clipped since every hit collider is wanted
+        const auto checkCollider = [&](ICollider* collider, const float clipDistance)
+        {
+            float hitDistanceSqr;
+
+            if (!collider->isActive() || !collider->isInLayers(layerMask) ||
+                !collider->check(ray, hitDistanceSqr) || hitDistanceSqr > maxDistanceSqr)
+                return clipDistance;
+
+            const float hitDistance = squareRoot(hitDistanceSqr);
+            hits.push_back({ origin + dir * hitDistance, collider, hitDistance });
+
+            return clipDistance;
+        };
+
+        ICollider::getBroadphase().raycast(origin, dir, maxDistance, checkCollider);
+
+        std::ranges::sort(hits, [](const RaycastHit& first, const RaycastHit& second)
+        {
+            return first.m_distance < second.m_distance;
+        });
+
+        return hits.size();
+    }
+
+    size_t raycastBatch(const std::span<const Ray> rays, const std::span<RaycastHit> hits, const float maxDistance,
+                        const uint32_t             layerMask)
+    {
+        ASSERT(rays.size() == hits.size(), "Batched ray casts need one hit info per ray");
+
+        // Flushing the moved colliders first leaves every active collider's world data up to date,
+        // which keeps the packets' reads free of writes
+        const IBroadphase& broadphase = ICollider::getBroadphase();
+        ICollider::s_isReadingConcurrently = true;
+        const float        maxDistanceSqr = maxDistance * maxDistance;
+
+        const auto castPacket = [&broadphase, rays, hits, maxDistance, maxDistanceSqr, layerMask](const size_t packetIndex)
+        {
+            const size_t first = packetIndex * RayPacket::SIZE;
+            const size_t count = min(RayPacket::SIZE, rays.size() - first);
+
+            RayPacket                        packet;
+            std::array<Ray, RayPacket::SIZE> packetRays;
+
+            // The directions are normalized like the single ray casts' so the hit distances are in world units
+            for (size_t lane = 0; lane < count; ++lane)
+            {
+                hits[first + lane] = RaycastHit();
+                packetRays[lane] = { rays[first + lane].m_origin, rays[first + lane].m_direction.normalized() };
+                packet.setRay(lane, packetRays[lane].m_origin, packetRays[lane].m_direction, maxDistance);
+            }
+
+            // Hit distances are kept squared until all the colliders are checked
+            const auto checkCollider = [&packet, &packetRays, hits, first, maxDistanceSqr, layerMask](
+                ICollider* collider, uint8_t hitMask)
+            {
+                if (!collider->isActive() || !collider->isInLayers(layerMask))
+                    return;
+
+                const auto [center, _, radius] = collider->getBounds();
+                hitMask &= packet.raycastSphere(center, radius);
+
+                for (size_t lane = 0; hitMask != 0; ++lane, hitMask >>= 1)
+                {
+                    if ((hitMask & 1) == 0)
+                        continue;
+
+                    RaycastHit& hitInfo = hits[first + lane];
+                    float       hitDistanceSqr;
+
+                    if (!collider->check(packetRays[lane], hitDistanceSqr) || hitDistanceSqr > maxDistanceSqr ||
+                        hitDistanceSqr >= hitInfo.m_distance)
+                        continue;
+
+                    hitInfo.m_collider = collider;
+                    hitInfo.m_distance = hitDistanceSqr;
+
+                    packet.m_maxDistance[lane] = min(packet.m_maxDistance[lane], squareRoot(hitDistanceSqr));
+                }
+            };
+
+            broadphase.raycast(packet, checkCollider);
+
+            for (size_t lane = 0; lane < count; ++lane)
+            {
+                RaycastHit& hitInfo = hits[first + lane];
+
+                if (hitInfo.m_collider == nullptr)
+                    continue;
+
+                hitInfo.m_distance = squareRoot(hitInfo.m_distance);
+                hitInfo.m_position = packetRays[lane].m_origin + packetRays[lane].m_direction * hitInfo.m_distance;
+            }
+        };
+
+        // Packets are grouped to keep the scheduling cost low compared to the ray casts
+        constexpr size_t packetsPerTask = 16;
+
+        const size_t packetCount = (rays.size() + RayPacket::SIZE - 1) / RayPacket::SIZE;
+        const size_t taskCount = (packetCount + packetsPerTask - 1) / packetsPerTask;
+
+        Utility::ThreadPool* threadPool = LGL_TRY_SERVICE(Utility::ThreadPool);
+
+        if (threadPool != nullptr && taskCount > 1 && broadphase.canQueryConcurrently())
+        {
+            threadPool->parallelFor(taskCount, [&castPacket, packetCount](const size_t taskIndex)
+            {
+                const size_t lastPacket = min(packetCount, (taskIndex + 1) * packetsPerTask);
+
+                for (size_t packetIndex = taskIndex * packetsPerTask; packetIndex < lastPacket; ++packetIndex)
+                    castPacket(packetIndex);
+            });
+        }
+        else
+        {
+            for (size_t packetIndex = 0; packetIndex < packetCount; ++packetIndex)
+                castPacket(packetIndex);
+        }
+
+        ICollider::s_isReadingConcurrently = false;
+
+        return static_cast<size_t>(std::ranges::count_if(hits, [](const RaycastHit& hitInfo)
+        {
+            return hitInfo.m_collider != nullptr;
+        }));
+    }
 }
@@ -1,27 +1,81 @@
 #include "Arithmetic.h"
 #include "Rigidbody.h"
 #include "Component.h"
+#include "ContactManifold.h"
 #include "Entity.h"
 #include "ICollider.h"
+#include "Interpolation.h"
+#include "PhysicsWorld.h"
+#include "SceneSerializer.h"
+#include "Debug/Assertion.h"
 #include "Debug/Log.h"
 #include "Utility/ServiceLocator.h"
-#include "Utility/Timer.h"
+#include "Utility/ThreadPool.h"
+
+#include <bit>
 
 using namespace LibMath;
 using namespace LibGL::Utility;
 
 namespace LibGL::Physics
 {
+    REGISTER_COMPONENT_TYPE(Rigidbody);
+
     Rigidbody::Rigidbody(Entity& owner)
-        : Component(owner)
+        : Component(owner), m_storageIndex(s_storage.add(*this))
+    {
+    }
+
+    Rigidbody::Rigidbody(const Rigidbody& other)
+        : Component(other), m_collisionDetectionMode(other.m_collisionDetectionMode),
+        m_sleepThreshold(other.m_sleepThreshold), m_storageIndex(s_storage.add(*this)),
+        m_isKinematic(other.m_isKinematic), m_isSleeping(other.m_isSleeping)
     {
+        s_storage.copy(other.m_storageIndex, m_storageIndex);
     }
 
-    void Rigidbody::update()
+    Rigidbody::Rigidbody(Rigidbody&& other) noexcept
+        : Component(std::move(other)), m_collisionDetectionMode(other.m_collisionDetectionMode),
+        m_sleepThreshold(other.m_sleepThreshold), m_storageIndex(s_storage.add(*this)),
+        m_isKinematic(other.m_isKinematic), m_isSleeping(other.m_isSleeping)
     {
-        Component::update();
+        s_storage.copy(other.m_storageIndex, m_storageIndex);
+    }
 
-        simulate();
+    Rigidbody::~Rigidbody()
+    {
+        if (Rigidbody* movedBody = s_storage.remove(m_storageIndex))
+            movedBody->m_storageIndex = m_storageIndex;
+    }
+
+    Rigidbody& Rigidbody::operator=(const Rigidbody& other)
+    {
+        if (&other == this)
+            return *this;
+
+        Component::operator=(other);
+        s_storage.copy(other.m_storageIndex, m_storageIndex);
+        m_collisionDetectionMode = other.m_collisionDetectionMode;
+        m_sleepThreshold = other.m_sleepThreshold;
+        m_isKinematic = other.m_isKinematic;
+        m_isSleeping = other.m_isSleeping;
+
+        return *this;
+    }
+
+    Rigidbody& Rigidbody::operator=(Rigidbody&& other) noexcept
+    {
+        if (&other == this)
+            return *this;
+
+        Component::operator=(std::move(other));
+        s_storage.copy(other.m_storageIndex, m_storageIndex);
+        m_collisionDetectionMode = other.m_collisionDetectionMode;
+        m_sleepThreshold = other.m_sleepThreshold;
+        m_isKinematic = other.m_isKinematic;
+        m_isSleeping = other.m_isSleeping;
+
+        return *this;
     }
 
     void Rigidbody::addForce(const Vector3& force, const EForceMode forceMode)
@@ -29,35 +83,60 @@ namespace LibGL::Physics
         if (!isActive() || m_isKinematic)
             return;
 
+        const float inverseMass = s_storage.getInverseMass(m_storageIndex);
+        Vector3     velocity = getVelocity();
+
         switch (forceMode)
         {
         case EForceMode::FORCE:
-            m_velocity += force * LGL_SERVICE(Timer).getDeltaTime() / m_mass;
+            velocity += force * getForceDeltaTime() * inverseMass;
             break;
         case EForceMode::ACCELERATION:
-            m_velocity += force * LGL_SERVICE(Timer).getDeltaTime();
+            velocity += force * getForceDeltaTime();
             break;
         case EForceMode::IMPULSE:
-            m_velocity += force / m_mass;
+            velocity += force * inverseMass;
             break;
         case EForceMode::VELOCITY_CHANGE:
-            m_velocity += force;
+            velocity += force;
             break;
         default:
             const std::string msg = formatString("Invalid force mode: %u\n", forceMode);
             DEBUG_LOG(msg.c_str());
             throw std::out_of_range(msg);
         }
+
+        setVelocity(velocity);
     }
 
     void Rigidbody::sleep()
     {
         m_isSleeping = true;
+        m_sleepingIsland = 0;
+        setVelocity(Vector3::zero());
     }
 
     void Rigidbody::wakeUp()
     {
+        if (!m_isSleeping)
+            return;
+
         m_isSleeping = false;
+        m_restTime = 0.f;
+
+        if (m_sleepingIsland == 0)
+            return;
+
+        const uint32_t sleepingIsland = m_sleepingIsland;
+
+        for (Rigidbody* rigidbody : s_storage.getBodies())
+        {
+            if (rigidbody->m_isSleeping && rigidbody->m_sleepingIsland == sleepingIsland)
+            {
+                rigidbody->m_isSleeping = false;
+                rigidbody->m_restTime = 0.f;
+            }
+        }
     }
 
     bool Rigidbody::isSleeping() const
@@ -65,199 +144,562 @@ namespace LibGL::Physics
         return m_isSleeping;
     }
 
+    Vector3 Rigidbody::getVelocity() const
+    {
+        return s_storage.getVelocity(m_storageIndex);
+    }
+
+    void Rigidbody::setVelocity(const Vector3& velocity)
+    {
+        s_storage.setVelocity(m_storageIndex, velocity);
+    }
+
     Vector3 Rigidbody::getDraggedVelocity() const
     {
-        const float deltaTime = LGL_SERVICE(Timer).getDeltaTime();
-        return deltaTime > 0.f ? m_velocity * clamp(1.f - m_drag * deltaTime, 0.f, 1.f) : Vector3::zero();
+        const float deltaTime = getForceDeltaTime();
+        return deltaTime > 0.f ? getVelocity() * clamp(1.f - getDrag() * deltaTime, 0.f, 1.f) : Vector3::zero();
     }
 
-    void Rigidbody::simulate()
+    float Rigidbody::getMass() const
     {
-        if (!isActive())
-            return;
+        return 1.f / s_storage.getInverseMass(m_storageIndex);
+    }
 
-        if (m_isKinematic)
+    void Rigidbody::setMass(const float mass)
+    {
+        ASSERT(mass > 0.f, "A rigidbody's mass must be positive");
+        s_storage.setInverseMass(m_storageIndex, 1.f / mass);
+    }
+
+    float Rigidbody::getDrag() const
+    {
+        return s_storage.getDrag(m_storageIndex);
+    }
+
+    void Rigidbody::setDrag(const float drag)
+    {
+        s_storage.setDrag(m_storageIndex, drag);
+    }
+
+    bool Rigidbody::isUsingGravity() const
+    {
+        return s_storage.getGravityScale(m_storageIndex) != 0.f;
+    }
+
+    void Rigidbody::setUseGravity(const bool useGravity)
+    {
+        s_storage.setGravityScale(m_storageIndex, useGravity ? 1.f : 0.f);
+    }
+
+    bool Rigidbody::isKinematic() const
+    {
+        return m_isKinematic;
+    }
+
+    void Rigidbody::setKinematic(const bool isKinematic)
+    {
+        m_isKinematic = isKinematic;
+    }
+
+    void Rigidbody::serialize(Resources::SceneWriter& writer) const
+    {
+        writer.write(getVelocity());
+        writer.write(static_cast<uint8_t>(m_collisionDetectionMode));
+        writer.write(m_sleepThreshold);
+        writer.write(getDrag());
+        writer.write(getMass());
+        writer.write(static_cast<uint8_t>(isUsingGravity()));
+        writer.write(static_cast<uint8_t>(m_isKinematic));
+        writer.write(static_cast<uint8_t>(m_isSleeping));
+    }
+
+    Rigidbody& Rigidbody::deserialize(Entity& owner, Resources::SceneReader& reader)
+    {
+        Rigidbody& rigidbody = owner.addComponent<Rigidbody>();
+
+        const Vector3 velocity = reader.read<Vector3>();
+        const uint8_t detectionMode = reader.read<uint8_t>();
+        const float   sleepThreshold = reader.read<float>();
+        const float   drag = reader.read<float>();
+        const float   mass = reader.read<float>();
+        const uint8_t useGravity = reader.read<uint8_t>();
+        const uint8_t isKinematic = reader.read<uint8_t>();
+        const uint8_t isSleeping = reader.read<uint8_t>();
+
+        // Fail the load on corrupted values instead of storing invalid enums or booleans
+        if (detectionMode > static_cast<uint8_t>(ECollisionDetectionMode::NONE)
+            || useGravity > 1 || isKinematic > 1 || isSleeping > 1)
         {
-            move();
+            reader.invalidate();
+            return rigidbody;
+        }
+
+        rigidbody.setVelocity(velocity);
+        rigidbody.m_collisionDetectionMode = static_cast<ECollisionDetectionMode>(detectionMode);
+        rigidbody.m_sleepThreshold = sleepThreshold;
+        rigidbody.setDrag(drag);
+
+        if (mass > 0.f)
+            rigidbody.setMass(mass);
+
+        rigidbody.setUseGravity(useGravity != 0);
+        rigidbody.m_isKinematic = isKinematic != 0;
+        rigidbody.m_isSleeping = isSleeping != 0;
+
+        return rigidbody;
+    }
+
+    void Rigidbody::step(const float deltaTime)
+    {
+        if (deltaTime <= 0.f)
             return;
+
+        const std::span<Rigidbody* const> bodies = s_storage.getBodies();
+
+        // Sleeping rigidbodies whose velocity was changed should move again
+        for (Rigidbody* rigidbody : bodies)
+        {
+            if (rigidbody->isActive() && rigidbody->isSleeping() && rigidbody->getVelocity() != Vector3::zero())
+                rigidbody->wakeUp();
         }
 
-        if (m_useGravity)
-            addForce(s_gravity, EForceMode::ACCELERATION);
+        s_storage.clearStep();
 
-        if (isSleeping())
+        for (Rigidbody* rigidbody : bodies)
         {
-            if (m_velocity.magnitudeSquared() >= m_sleepThreshold)
-                wakeUp();
+            rigidbody->m_stepPass = NOT_STEPPED;
 
-            return;
+            if (rigidbody->isActive() && !rigidbody->isSleeping())
+                rigidbody->prepareStep(0);
         }
 
-        if (floatEquals(getDraggedVelocity().magnitudeSquared(), 0.f))
-            return;
+        s_stepContacts.clear();
+
+        // The islands woken up by a pass' contacts join the next one
+        for (uint32_t pass = 0; findContacts(pass); ++pass)
+        {
+            for (Rigidbody* rigidbody : bodies)
+            {
+                if (rigidbody->m_stepPass == NOT_STEPPED && rigidbody->isActive() && !rigidbody->isSleeping())
+                    rigidbody->prepareStep(pass + 1);
+            }
+        }
+
+        // Gravity and drag don't affect the contacts so every stepped rigidbody is integrated at once
+        s_storage.integrateVelocities(s_gravity, deltaTime);
+
+        buildIslands();
+        solveIslands(deltaTime);
+
+        s_storage.computeDisplacements(deltaTime);
+
+        for (Rigidbody* rigidbody : bodies)
+        {
+            if (rigidbody->m_stepPass != NOT_STEPPED)
+                rigidbody->finishStep(deltaTime);
+        }
+
+        s_storage.integratePositions();
+
+        for (Rigidbody* rigidbody : bodies)
+        {
+            if (rigidbody->m_stepPass == NOT_STEPPED ||
+                s_storage.getDisplacement(rigidbody->m_storageIndex) == Vector3::zero())
+                continue;
+
+            rigidbody->getOwner().setPosition(s_storage.getPosition(rigidbody->m_storageIndex));
+            rigidbody->m_currentPosition = rigidbody->getOwner().getPosition();
+        }
+
+        // An island only falls asleep once all its rigidbodies are at rest
+        for (size_t i = 0; i < s_islandCount; ++i)
+        {
+            const std::vector<Rigidbody*>& islandBodies = s_islands[i].m_bodies;
+
+            const bool isResting = std::ranges::all_of(islandBodies, [](const Rigidbody* rigidbody)
+            {
+                return rigidbody->m_restTime >= s_timeToSleep;
+            });
+
+            if (!isResting)
+                continue;
+
+            ++s_lastSleepingIsland;
+
+            for (Rigidbody* rigidbody : islandBodies)
+            {
+                rigidbody->sleep();
+                rigidbody->m_sleepingIsland = s_lastSleepingIsland;
+            }
+        }
 
-        move();
+        // The callbacks run once the step is done so they can freely move or destroy the colliders
+        ICollider::getEvents().update();
+        ICollider::advancePairs();
+        ICollider::getEvents().dispatch();
     }
 
-    void Rigidbody::move()
+    uint64_t Rigidbody::computeStateHash()
     {
-        if (!isActive() || isSleeping())
-            return;
+        // FNV-1a over the values' bits, so that even a rounding difference changes the hash
+        uint64_t hash = 14695981039346656037ull;
 
-        const float deltaTime = LGL_SERVICE(Timer).getDeltaTime();
-
-        if (m_isKinematic)
-            getOwner().translate(m_velocity * deltaTime);
+        const auto mix = [&hash](const uint32_t value)
+        {
+            for (int shift = 0; shift < 32; shift += 8)
+            {
+                hash ^= (value >> shift) & 0xFF;
+                hash *= 1099511628211ull;
+            }
+        };
 
-        const auto ownerColliders = getOwner().getComponents<ICollider>();
+        const auto mixVector = [&mix](const Vector3& vector)
+        {
+            mix(std::bit_cast<uint32_t>(vector.m_x));
+            mix(std::bit_cast<uint32_t>(vector.m_y));
+            mix(std::bit_cast<uint32_t>(vector.m_z));
+        };
 
-        if (ownerColliders.empty())
+        for (const Rigidbody* rigidbody : s_storage.getBodies())
         {
-            getOwner().translate(getDraggedVelocity() * deltaTime);
-            return;
+            mixVector(rigidbody->m_isInterpolated ? rigidbody->m_currentPosition : rigidbody->getOwner().getPosition());
+            mixVector(rigidbody->getVelocity());
+            mix(rigidbody->m_isSleeping ? 1 : 0);
         }
 
-        const auto worldColliders = ICollider::getColliders();
+        return hash;
+    }
 
-        int stepsCount;
+    void Rigidbody::prepareStep(const uint32_t pass)
+    {
+        m_stepPass = pass;
+        m_islandIndex = NO_ISLAND;
+        m_solverIndex = ContactSolver::STATIC_BODY;
+
+        m_previousPosition = getOwner().getPosition();
+        m_currentPosition = m_previousPosition;
+
+        s_storage.setPosition(m_storageIndex, m_previousPosition);
+        s_storage.addToStep(m_storageIndex, !m_isKinematic);
+    }
 
-        switch (m_collisionDetectionMode)
+    void Rigidbody::finishStep(const float deltaTime)
+    {
+        if (m_islandIndex != NO_ISLAND)
         {
-        case ECollisionDetectionMode::DISCRETE:
-            stepsCount = 1;
-            break;
-        case ECollisionDetectionMode::CONTINUOUS:
-            stepsCount = s_continuousCollisionSteps;
-            break;
-        case ECollisionDetectionMode::NONE:
-        default:
-            getOwner().translate(getDraggedVelocity() * deltaTime);
-            return;
+            const ContactSolver::Body& body = s_islands[m_islandIndex].m_solver.getBody(m_solverIndex);
+
+            s_storage.setVelocity(m_storageIndex, body.m_velocity);
+            s_storage.setDisplacement(m_storageIndex, body.m_displacement);
+        }
+
+        Vector3 displacement = s_storage.getDisplacement(m_storageIndex);
+
+        if (m_collisionDetectionMode == ECollisionDetectionMode::CONTINUOUS && !m_isKinematic &&
+            displacement != Vector3::zero())
+        {
+            stopAtFirstImpact(displacement);
+            s_storage.setDisplacement(m_storageIndex, displacement);
         }
 
-        std::unordered_map<ComponentId, std::vector<ComponentId>> checkedCollidersMap;
+        if (m_isKinematic)
+            return;
+
+        if (getVelocity().magnitudeSquared() < m_sleepThreshold * m_sleepThreshold)
+            m_restTime += deltaTime;
+        else
+            m_restTime = 0.f;
+    }
+
+    void Rigidbody::stopAtFirstImpact(Vector3& displacement)
+    {
+        const IBroadphase& broadphase = ICollider::getBroadphase();
+        const float        distance = displacement.magnitude();
+        const Vector3      direction = displacement / distance;
+
+        float   impactFraction = 1.f;
+        Vector3 impactNormal = Vector3::zero();
 
-        for (int i = 0; i < stepsCount; i++)
+        for (const auto& collider : getOwner().getComponents<ICollider>())
         {
-            const Vector3 velocity = getDraggedVelocity();
+            if (!collider->isActive())
+                continue;
 
-            for (const auto& entityCollider : ownerColliders)
+            s_sweepCandidates.clear();
+            broadphase.query(collider->getAABB().swept(direction, distance), s_sweepCandidates);
+
+            for (const ICollider* other : s_sweepCandidates)
             {
-                if (!entityCollider->isActive())
+                // Moving rigidbodies are handled by the contacts, only the static colliders can be tunnelled through
+                if (!other->isActive() || &other->getOwner() == &getOwner() || !collider->canCollideWith(*other) ||
+                    collider->isTrigger() || other->isTrigger() || getRigidbody(*other) != nullptr)
                     continue;
 
-                auto& checkedColliders = checkedCollidersMap[entityCollider->getId()];
+                float   fraction;
+                Vector3 normal;
 
-                for (const auto& worldCollider : worldColliders)
+                if (collider->computeTimeOfImpact(*other, displacement, fraction, normal) &&
+                    fraction < impactFraction)
                 {
-                    if (worldCollider == nullptr || !worldCollider->isActive() ||
-                        &worldCollider->getOwner() == &getOwner() || *entityCollider == *worldCollider ||
-                        std::ranges::find(checkedColliders, worldCollider->getId()) != checkedColliders.end() ||
-                        !entityCollider->check(*worldCollider))
-                        continue;
-
-                    const Vector3 normal = getBoundsNormal(*entityCollider, *worldCollider);
-
-                    const Vector3 normalMask
-                    {
-                        LibMath::abs(normal.m_x) > 0.f ? sign(normal.m_x) : 0.f,
-                        LibMath::abs(normal.m_y) > 0.f ? sign(normal.m_y) : 0.f,
-                        LibMath::abs(normal.m_z) > 0.f ? sign(normal.m_z) : 0.f
-                    };
-
-                    const Vector3 frictionMask
-                    {
-                        floatEquals(normalMask.m_x, 0.f) ? sign(normalMask.m_x) : 0.f,
-                        floatEquals(normalMask.m_y, 0.f) ? sign(normalMask.m_y) : 0.f,
-                        floatEquals(normalMask.m_z, 0.f) ? sign(normalMask.m_z) : 0.f
-                    };
-
-                    Rigidbody* otherRigidbody = worldCollider->getOwner().getComponent<Rigidbody>();
-
-                    // There is a collision, apply opposite forces
-                    if (otherRigidbody != nullptr && otherRigidbody != this && otherRigidbody->isActive())
-                    {
-                        const Vector3 otherVelocity = otherRigidbody->getDraggedVelocity();
-
-                        if (!otherRigidbody->m_isKinematic)
-                        {
-                            if (normal.dot(otherVelocity) >= 0.f)
-                                otherRigidbody->addForce((otherVelocity * normalMask).magnitude() * -normal,
-                                    EForceMode::VELOCITY_CHANGE);
-
-                            if (normal.dot(-velocity) >= 0.f)
-                                otherRigidbody->addForce((velocity * m_mass * normalMask).magnitude() * -normal,
-                                    EForceMode::IMPULSE);
-                        }
-
-                        if (normal.dot(-velocity) >= 0.f)
-                            addForce((velocity * normalMask).magnitude() * normal, EForceMode::VELOCITY_CHANGE);
-
-                        if (normal.dot(otherVelocity) >= 0.f)
-                            addForce((otherVelocity * otherRigidbody->m_mass * normalMask).magnitude() * normal,
-                                EForceMode::IMPULSE);
-                    }
-                    else if (normal.dot(-velocity) >= 0.f)
-                    {
-                        addForce((velocity * normalMask).magnitude() * normal, EForceMode::VELOCITY_CHANGE);
-                    }
-
-                    addForce(-velocity * frictionMask * s_friction * s_gravity.magnitude(), EForceMode::ACCELERATION);
-
-                    checkedColliders.push_back(worldCollider->getId());
+                    impactFraction = fraction;
+                    impactNormal = normal;
                 }
             }
+        }
+
+        if (impactFraction >= 1.f)
+            return;
+
+        displacement *= impactFraction;
+
+        // The impact stops the rigidbody from moving further into the collider, the next step's contacts handle the rest
+        const Vector3 velocity = getVelocity();
+        const float   approachSpeed = velocity.dot(impactNormal);
+
+        if (approachSpeed > 0.f)
+            setVelocity(velocity - impactNormal * approachSpeed);
+    }
+
+    void Rigidbody::restorePositions()
+    {
+        for (Rigidbody* rigidbody : s_storage.getBodies())
+        {
+            if (!rigidbody->m_isInterpolated)
+                continue;
+
+            rigidbody->m_isInterpolated = false;
+
+            // A position changed since the interpolation was set on purpose and replaces the simulated one
+            if (rigidbody->getOwner().getPosition() == rigidbody->m_interpolatedPosition)
+            {
+                rigidbody->getOwner().setPosition(rigidbody->m_currentPosition);
+                continue;
+            }
+
+            rigidbody->m_previousPosition = rigidbody->getOwner().getPosition();
+            rigidbody->m_currentPosition = rigidbody->m_previousPosition;
+        }
+    }
+
+    void Rigidbody::interpolatePositions(const float ratio)
+    {
+        for (Rigidbody* rigidbody : s_storage.getBodies())
+        {
+            if (rigidbody->m_stepPass == NOT_STEPPED || rigidbody->m_previousPosition == rigidbody->m_currentPosition)
+                continue;
 
-            const Vector3 step = getDraggedVelocity() * deltaTime / static_cast<float>(stepsCount);
-            getOwner().translate(step);
+            rigidbody->m_interpolatedPosition = lerp(rigidbody->m_previousPosition, rigidbody->m_currentPosition, ratio);
+            rigidbody->m_isInterpolated = true;
+
+            rigidbody->getOwner().setPosition(rigidbody->m_interpolatedPosition);
         }
+    }
 
-        if (getDraggedVelocity().magnitudeSquared() < m_sleepThreshold * m_sleepThreshold)
-            sleep();
+    Rigidbody* Rigidbody::getRigidbody(const ICollider& collider)
+    {
+        Rigidbody* rigidbody = collider.getOwner().getComponent<Rigidbody>();
+        return rigidbody != nullptr && rigidbody->isActive() ? rigidbody : nullptr;
     }
 
-    Vector3 Rigidbody::getBoundsNormal(const ICollider& entityCollider, const ICollider& worldCollider)
+    float Rigidbody::getForceDeltaTime()
     {
-        const auto [center, size, _] = worldCollider.getBounds();
-        const auto minCorner = center - size;
-        const auto maxCorner = center + size;
+        // The forces act over the fixed step like the integration, whatever the frames' duration
+        const PhysicsWorld* physicsWorld = LGL_TRY_SERVICE(PhysicsWorld);
+        return physicsWorld != nullptr ? physicsWorld->getFixedDeltaTime() : PhysicsWorld::DEFAULT_FIXED_DELTA_TIME;
+    }
+
+    bool Rigidbody::findContacts(const uint32_t pass)
+    {
+        const IBroadphase& broadphase = ICollider::getBroadphase();
+        ContactCache&      contacts = ICollider::getContacts();
+        bool               hasWokenUp = false;
+
+        const auto isDynamic = [](const Rigidbody* rigidbody)
+        {
+            return rigidbody != nullptr && !rigidbody->m_isKinematic;
+        };
 
-        const auto entityCenter = entityCollider.getBounds().m_center;
+        const auto getDynamicPass = [&isDynamic](const Rigidbody* rigidbody)
+        {
+            return isDynamic(rigidbody) ? rigidbody->m_stepPass : NOT_STEPPED;
+        };
 
-        const Vector3 snappedX
+        const auto getMovingKinematicPass = [](const Rigidbody* rigidbody)
         {
-            snap(entityCenter.m_x, minCorner.m_x, maxCorner.m_x),
-            entityCenter.m_y,
-            entityCenter.m_z
+            return rigidbody != nullptr && rigidbody->m_isKinematic && rigidbody->getVelocity() != Vector3::zero()
+                       ? rigidbody->m_stepPass
+                       : NOT_STEPPED;
         };
 
-        const Vector3 snappedY
+        const auto ignoresCollisions = [](const Rigidbody* rigidbody)
         {
-            entityCenter.m_x,
-            snap(entityCenter.m_y, minCorner.m_y, maxCorner.m_y),
-            entityCenter.m_z
+            return rigidbody != nullptr && rigidbody->m_collisionDetectionMode == ECollisionDetectionMode::NONE;
         };
 
-        const Vector3 snappedZ
+        for (const OverlapPair& pair : broadphase.getPairCache().getPairs())
+        {
+            const ICollider& first = *broadphase.getCollider(pair.m_first);
+            const ICollider& second = *broadphase.getCollider(pair.m_second);
+
+            // Triggers only report their overlaps, which the collision events find on their own
+            if (!first.isActive() || !second.isActive() || &first.getOwner() == &second.getOwner() ||
+                !first.canCollideWith(second) || first.isTrigger() || second.isTrigger())
+                continue;
+
+            Rigidbody* firstBody = getRigidbody(first);
+            Rigidbody* secondBody = getRigidbody(second);
+
+            if ((!isDynamic(firstBody) && !isDynamic(secondBody)) || ignoresCollisions(firstBody) ||
+                ignoresCollisions(secondBody))
+                continue;
+
+            // Each pair is handled during the pass its first moving dynamic rigidbody joined the step.
+            // Without one, a moving kinematic rigidbody can still wake the sleeping ones up
+            const uint32_t dynamicPass = min(getDynamicPass(firstBody), getDynamicPass(secondBody));
+            const uint32_t pairPass = dynamicPass != NOT_STEPPED
+                                          ? dynamicPass
+                                          : min(getMovingKinematicPass(firstBody), getMovingKinematicPass(secondBody));
+
+            if (pairPass != pass)
+                continue;
+
+            ContactManifold& manifold = contacts.getManifold(first, second);
+
+            if (!manifold.update())
+                continue;
+
+            for (Rigidbody* rigidbody : { firstBody, secondBody })
+            {
+                if (rigidbody != nullptr && rigidbody->isSleeping())
+                {
+                    rigidbody->wakeUp();
+                    hasWokenUp = true;
+                }
+            }
+
+            // The woken up rigidbodies will handle the pair once they joined the step
+            if (dynamicPass == NOT_STEPPED)
+                continue;
+
+            const bool isSwapped = &manifold.getFirst() != &first;
+
+            s_stepContacts.push_back({
+                &manifold, isSwapped ? secondBody : firstBody, isSwapped ? firstBody : secondBody
+            });
+        }
+
+        return hasWokenUp;
+    }
+
+    void Rigidbody::buildIslands()
+    {
+        // The scratch lists are kept across the steps to reuse their memory
+        s_islandParents.clear();
+        s_dynamicBodies.clear();
+
+        for (Rigidbody* rigidbody : s_storage.getBodies())
+        {
+            if (rigidbody->m_stepPass == NOT_STEPPED || rigidbody->m_isKinematic)
+                continue;
+
+            // The island index holds the rigidbody's union-find node until the islands are known
+            rigidbody->m_islandIndex = static_cast<uint32_t>(s_islandParents.size());
+            s_islandParents.push_back(rigidbody->m_islandIndex);
+            s_dynamicBodies.push_back(rigidbody);
+        }
+
+        const auto findRoot = [](uint32_t node)
         {
-            entityCenter.m_x,
-            entityCenter.m_y,
-            snap(entityCenter.m_z, minCorner.m_z, maxCorner.m_z)
+            while (s_islandParents[node] != node)
+            {
+                s_islandParents[node] = s_islandParents[s_islandParents[node]];
+                node = s_islandParents[node];
+            }
+
+            return node;
         };
 
-        const float minDist = min(entityCenter.distanceSquaredFrom(snappedX),
-            min(entityCenter.distanceSquaredFrom(snappedY),
-                entityCenter.distanceSquaredFrom(snappedZ)));
+        // Static and kinematic colliders don't link the islands since the contacts can't move them
+        for (const StepContact& contact : s_stepContacts)
+        {
+            if (contact.m_first == nullptr || contact.m_first->m_isKinematic ||
+                contact.m_second == nullptr || contact.m_second->m_isKinematic)
+                continue;
+
+            s_islandParents[findRoot(contact.m_first->m_islandIndex)] = findRoot(contact.m_second->m_islandIndex);
+        }
+
+        // Each root gets the next island, whose solver and bodies are reused from the previous steps
+        s_rootIslands.assign(s_dynamicBodies.size(), NO_ISLAND);
+        s_islandCount = 0;
+
+        for (Rigidbody* rigidbody : s_dynamicBodies)
+        {
+            const uint32_t root = findRoot(rigidbody->m_islandIndex);
+
+            if (s_rootIslands[root] == NO_ISLAND)
+            {
+                s_rootIslands[root] = static_cast<uint32_t>(s_islandCount++);
+
+                if (s_islands.size() < s_islandCount)
+                    s_islands.emplace_back();
+
+                s_islands[s_rootIslands[root]].m_solver.clear();
+                s_islands[s_rootIslands[root]].m_bodies.clear();
+            }
+
+            Island& island = s_islands[s_rootIslands[root]];
+
+            rigidbody->m_islandIndex = s_rootIslands[root];
+            rigidbody->m_solverIndex = island.m_solver.addBody(rigidbody->getVelocity(),
+                s_storage.getInverseMass(rigidbody->m_storageIndex));
+            island.m_bodies.push_back(rigidbody);
+        }
+
+        for (const StepContact& contact : s_stepContacts)
+        {
+            const Rigidbody* dynamicBody = contact.m_first != nullptr && !contact.m_first->m_isKinematic
+                                               ? contact.m_first
+                                               : contact.m_second;
 
-        if (floatEquals(minDist, entityCenter.distanceSquaredFrom(snappedX)))
-            return (Vector3::right() * sign(snappedX.m_x - center.m_x)).normalized();
+            Island& island = s_islands[dynamicBody->m_islandIndex];
 
-        if (floatEquals(minDist, entityCenter.distanceSquaredFrom(snappedY)))
-            return (Vector3::up() * sign(snappedY.m_y - center.m_y)).normalized();
+            // Kinematic rigidbodies can touch several islands so each island gets its own copy
+            const auto getSolverIndex = [&island](const Rigidbody* rigidbody)
+            {
+                if (rigidbody == nullptr)
+                    return ContactSolver::STATIC_BODY;
+
+                return rigidbody->m_isKinematic
+                           ? island.m_solver.addBody(rigidbody->getVelocity(), 0.f)
+                           : rigidbody->m_solverIndex;
+            };
+
+            island.m_solver.addManifold(*contact.m_manifold, getSolverIndex(contact.m_first),
+                getSolverIndex(contact.m_second), s_friction);
+        }
+    }
+
+    void Rigidbody::solveIslands(const float deltaTime)
+    {
+        const auto solveIsland = [deltaTime](const size_t index)
+        {
+            ContactSolver& solver = s_islands[index].m_solver;
+
+            solver.solveVelocities();
+            solver.integratePositions(deltaTime);
+            solver.solvePositions();
+        };
+
+        Utility::ThreadPool* threadPool = LGL_TRY_SERVICE(Utility::ThreadPool);
 
-        if (floatEquals(minDist, entityCenter.distanceSquaredFrom(snappedZ)))
-            return (Vector3::front() * sign(snappedZ.m_z - center.m_z)).normalized();
+        if (threadPool != nullptr && s_islandCount > 1)
+        {
+            threadPool->parallelFor(s_islandCount, solveIsland);
+            return;
+        }
 
-        return Vector3::zero();
+        for (size_t i = 0; i < s_islandCount; ++i)
+            solveIsland(i);
     }
 }
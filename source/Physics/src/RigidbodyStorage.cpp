@@ -0,0 +1,252 @@
+#include "RigidbodyStorage.h"
+
+#include "Arithmetic.h"
+#include "Debug/Assertion.h"
+
+#include <algorithm>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define LGL_RIGIDBODY_STORAGE_SSE 1
+#include <xmmintrin.h>
+#else
+#define LGL_RIGIDBODY_STORAGE_SSE 0
+#endif
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+    uint32_t RigidbodyStorage::add(Rigidbody& rigidbody)
+    {
+        for (std::vector<float>* component : getComponents())
+            component->push_back(0.f);
+
+        m_inverseMass.back() = 1.f;
+        m_gravityScale.back() = 1.f;
+
+        m_bodies.push_back(&rigidbody);
+        return static_cast<uint32_t>(m_bodies.size() - 1);
+    }
+
+    Rigidbody* RigidbodyStorage::remove(const uint32_t index)
+    {
+        ASSERT(index < m_bodies.size(), "Rigidbody storage index out of range");
+
+        for (std::vector<float>* component : getComponents())
+        {
+            (*component)[index] = component->back();
+            component->pop_back();
+        }
+
+        m_bodies[index] = m_bodies.back();
+        m_bodies.pop_back();
+
+        return index < m_bodies.size() ? m_bodies[index] : nullptr;
+    }
+
+    void RigidbodyStorage::copy(const uint32_t source, const uint32_t destination)
+    {
+        setVelocity(destination, getVelocity(source));
+        setInverseMass(destination, getInverseMass(source));
+        setDrag(destination, getDrag(source));
+        setGravityScale(destination, getGravityScale(source));
+    }
+
+    std::span<Rigidbody* const> RigidbodyStorage::getBodies() const
+    {
+        return m_bodies;
+    }
+
+    Vector3 RigidbodyStorage::getPosition(const uint32_t index) const
+    {
+        return { m_positionX[index], m_positionY[index], m_positionZ[index] };
+    }
+
+    void RigidbodyStorage::setPosition(const uint32_t index, const Vector3& position)
+    {
+        m_positionX[index] = position.m_x;
+        m_positionY[index] = position.m_y;
+        m_positionZ[index] = position.m_z;
+    }
+
+    Vector3 RigidbodyStorage::getVelocity(const uint32_t index) const
+    {
+        return { m_velocityX[index], m_velocityY[index], m_velocityZ[index] };
+    }
+
+    void RigidbodyStorage::setVelocity(const uint32_t index, const Vector3& velocity)
+    {
+        m_velocityX[index] = velocity.m_x;
+        m_velocityY[index] = velocity.m_y;
+        m_velocityZ[index] = velocity.m_z;
+    }
+
+    Vector3 RigidbodyStorage::getDisplacement(const uint32_t index) const
+    {
+        return { m_displacementX[index], m_displacementY[index], m_displacementZ[index] };
+    }
+
+    void RigidbodyStorage::setDisplacement(const uint32_t index, const Vector3& displacement)
+    {
+        m_displacementX[index] = displacement.m_x;
+        m_displacementY[index] = displacement.m_y;
+        m_displacementZ[index] = displacement.m_z;
+    }
+
+    float RigidbodyStorage::getInverseMass(const uint32_t index) const
+    {
+        return m_inverseMass[index];
+    }
+
+    void RigidbodyStorage::setInverseMass(const uint32_t index, const float inverseMass)
+    {
+        m_inverseMass[index] = inverseMass;
+    }
+
+    float RigidbodyStorage::getDrag(const uint32_t index) const
+    {
+        return m_drag[index];
+    }
+
+    void RigidbodyStorage::setDrag(const uint32_t index, const float drag)
+    {
+        m_drag[index] = drag;
+    }
+
+    float RigidbodyStorage::getGravityScale(const uint32_t index) const
+    {
+        return m_gravityScale[index];
+    }
+
+    void RigidbodyStorage::setGravityScale(const uint32_t index, const float gravityScale)
+    {
+        m_gravityScale[index] = gravityScale;
+    }
+
+    void RigidbodyStorage::clearStep()
+    {
+        std::ranges::fill(m_dynamicMask, 0.f);
+        std::ranges::fill(m_stepMask, 0.f);
+        std::ranges::fill(m_displacementX, 0.f);
+        std::ranges::fill(m_displacementY, 0.f);
+        std::ranges::fill(m_displacementZ, 0.f);
+    }
+
+    void RigidbodyStorage::addToStep(const uint32_t index, const bool isDynamic)
+    {
+        m_dynamicMask[index] = isDynamic ? 1.f : 0.f;
+        m_stepMask[index] = 1.f;
+    }
+
+    void RigidbodyStorage::integrateVelocities(const Vector3& gravity, const float deltaTime)
+    {
+        const size_t count = m_bodies.size();
+        size_t       i = 0;
+
+        // The masked out lanes get neither gravity nor drag, leaving their velocity untouched
+#if LGL_RIGIDBODY_STORAGE_SSE
+        const __m128 gravityX = _mm_set1_ps(gravity.m_x * deltaTime);
+        const __m128 gravityY = _mm_set1_ps(gravity.m_y * deltaTime);
+        const __m128 gravityZ = _mm_set1_ps(gravity.m_z * deltaTime);
+        const __m128 deltaLanes = _mm_set1_ps(deltaTime);
+        const __m128 one = _mm_set1_ps(1.f);
+
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 mask = _mm_loadu_ps(&m_dynamicMask[i]);
+            const __m128 gravityScale = _mm_mul_ps(_mm_loadu_ps(&m_gravityScale[i]), mask);
+
+            const __m128 dragRatio = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(&m_drag[i]), deltaLanes),
+                _mm_setzero_ps()), one);
+
+            const __m128 damping = _mm_sub_ps(one, _mm_mul_ps(dragRatio, mask));
+
+            const auto integrate = [&](float* velocity, const __m128 gravityStep)
+            {
+                const __m128 accelerated = _mm_add_ps(_mm_loadu_ps(velocity), _mm_mul_ps(gravityStep, gravityScale));
+                _mm_storeu_ps(velocity, _mm_mul_ps(accelerated, damping));
+            };
+
+            integrate(&m_velocityX[i], gravityX);
+            integrate(&m_velocityY[i], gravityY);
+            integrate(&m_velocityZ[i], gravityZ);
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            const float gravityScale = m_gravityScale[i] * m_dynamicMask[i];
+            const float damping = 1.f - clamp(m_drag[i] * deltaTime, 0.f, 1.f) * m_dynamicMask[i];
+
+            m_velocityX[i] = (m_velocityX[i] + gravity.m_x * deltaTime * gravityScale) * damping;
+            m_velocityY[i] = (m_velocityY[i] + gravity.m_y * deltaTime * gravityScale) * damping;
+            m_velocityZ[i] = (m_velocityZ[i] + gravity.m_z * deltaTime * gravityScale) * damping;
+        }
+    }
+
+    void RigidbodyStorage::computeDisplacements(const float deltaTime)
+    {
+        const size_t count = m_bodies.size();
+        size_t       i = 0;
+
+#if LGL_RIGIDBODY_STORAGE_SSE
+        const __m128 deltaLanes = _mm_set1_ps(deltaTime);
+
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 step = _mm_mul_ps(_mm_loadu_ps(&m_stepMask[i]), deltaLanes);
+
+            _mm_storeu_ps(&m_displacementX[i], _mm_mul_ps(_mm_loadu_ps(&m_velocityX[i]), step));
+            _mm_storeu_ps(&m_displacementY[i], _mm_mul_ps(_mm_loadu_ps(&m_velocityY[i]), step));
+            _mm_storeu_ps(&m_displacementZ[i], _mm_mul_ps(_mm_loadu_ps(&m_velocityZ[i]), step));
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            const float step = m_stepMask[i] * deltaTime;
+
+            m_displacementX[i] = m_velocityX[i] * step;
+            m_displacementY[i] = m_velocityY[i] * step;
+            m_displacementZ[i] = m_velocityZ[i] * step;
+        }
+    }
+
+    void RigidbodyStorage::integratePositions()
+    {
+        const size_t count = m_bodies.size();
+        size_t       i = 0;
+
+#if LGL_RIGIDBODY_STORAGE_SSE
+        const auto translate = [](float* position, const float* displacement)
+        {
+            _mm_storeu_ps(position, _mm_add_ps(_mm_loadu_ps(position), _mm_loadu_ps(displacement)));
+        };
+
+        for (; i + 4 <= count; i += 4)
+        {
+            translate(&m_positionX[i], &m_displacementX[i]);
+            translate(&m_positionY[i], &m_displacementY[i]);
+            translate(&m_positionZ[i], &m_displacementZ[i]);
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            m_positionX[i] += m_displacementX[i];
+            m_positionY[i] += m_displacementY[i];
+            m_positionZ[i] += m_displacementZ[i];
+        }
+    }
+
+    std::array<std::vector<float>*, RigidbodyStorage::COMPONENT_COUNT> RigidbodyStorage::getComponents()
+    {
+        return {
+            &m_positionX, &m_positionY, &m_positionZ,
+            &m_velocityX, &m_velocityY, &m_velocityZ,
+            &m_displacementX, &m_displacementY, &m_displacementZ,
+            &m_inverseMass, &m_drag, &m_gravityScale,
+            &m_dynamicMask, &m_stepMask
+        };
+    }
+}
@@ -0,0 +1,71 @@
+#include "ShapeCast.h"
+
+#include "Arithmetic.h"
+#include "ICollider.h"
+
+#include <vector>
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+    bool sphereCast(const SphereShape& sphere, const Vector3& direction, RaycastHit& hitInfo, const float maxDistance,
+                    const uint32_t     layerMask)
+    {
+        // A capsule whose height is its diameter has a single point as its segment
+        const CapsuleShape capsule{ sphere.m_center, Vector3::up(), sphere.m_radius * 2.f, sphere.m_radius };
+        return capsuleCast(capsule, direction, hitInfo, maxDistance, layerMask);
+    }
+
+    bool capsuleCast(const CapsuleShape& capsule, const Vector3& direction, RaycastHit& hitInfo, const float maxDistance,
+                     const uint32_t      layerMask)
+    {
+        const Vector3 dir = direction.normalized();
+
+        const float   halfSegment = max(capsule.m_height, capsule.m_radius * 2.f) / 2.f - capsule.m_radius;
+        const Vector3 segmentOffset = capsule.m_upDirection.normalized() * halfSegment;
+        const Vector3 segmentStart = capsule.m_center - segmentOffset;
+        const Vector3 segmentEnd = capsule.m_center + segmentOffset;
+
+        const AABB    shapeBounds = capsule.getAABB();
+        const Vector3 shapeHalfSize = (shapeBounds.m_max - shapeBounds.m_min) / 2.f;
+
+        // The candidates buffer is kept per thread to avoid an allocation per cast
+        thread_local std::vector<ICollider*> candidates;
+        candidates.clear();
+
+        ICollider::getBroadphase().query(shapeBounds.swept(dir, maxDistance), candidates);
+
+        hitInfo = RaycastHit();
+        hitInfo.m_distance = maxDistance;
+
+        for (ICollider* collider : candidates)
+        {
+            if (!collider->isActive() || !collider->isInLayers(layerMask))
+                continue;
+
+            // The shape's center must cross the collider's box grown by the shape's half size before the closest hit
+            float entryDistance;
+
+            if (!collider->getAABB().expanded(shapeHalfSize).raycast(capsule.m_center, dir, hitInfo.m_distance,
+                entryDistance))
+                continue;
+
+            float   hitDistance;
+            Vector3 hitPoint;
+
+            if (!collider->sweep(segmentStart, segmentEnd, capsule.m_radius, dir, hitInfo.m_distance, hitDistance,
+                    hitPoint) || (hitInfo.m_collider != nullptr && hitDistance >= hitInfo.m_distance))
+                continue;
+
+            hitInfo.m_collider = collider;
+            hitInfo.m_distance = hitDistance;
+            hitInfo.m_position = hitPoint;
+        }
+
+        if (hitInfo.m_collider == nullptr)
+            hitInfo = RaycastHit();
+
+        return hitInfo.m_collider != nullptr;
+    }
+}
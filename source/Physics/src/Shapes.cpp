@@ -0,0 +1,78 @@
+#include "Shapes.h"
+
+#include "Arithmetic.h"
+#include "Matrix/Matrix4.h"
+#include "Vector/Vector4.h"
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+    Bounds SphereShape::getBounds() const
+    {
+        return { m_center, Vector3(m_radius * 2.f), m_radius };
+    }
+
+    AABB SphereShape::getAABB() const
+    {
+        return AABB::fromCenter(m_center, Vector3(m_radius));
+    }
+
+    WorldShape SphereShape::getWorldShape() const
+    {
+        return { getBounds(), Vector3::up(), m_radius };
+    }
+
+    Bounds BoxShape::getBounds() const
+    {
+        return { m_center, m_size, (m_size / 2.f).magnitude() };
+    }
+
+    AABB BoxShape::getAABB() const
+    {
+        return AABB::fromCenter(m_center, m_size / 2.f);
+    }
+
+    WorldShape BoxShape::getWorldShape() const
+    {
+        const Bounds bounds = getBounds();
+        return { bounds, Vector3::up(), bounds.m_sphereRadius };
+    }
+
+    Bounds CapsuleShape::getBounds() const
+    {
+        const Vector3 upDir = m_upDirection.normalized();
+        const float   height = max(m_height, m_radius * 2.f);
+
+        const Matrix4 rotationMat = rotationFromTo(Vector3::up(), upDir);
+        const Vector3 rightDir = (rotationMat * Vector4::right()).xyz();
+        const Vector3 frontDir = (rotationMat * Vector4::front()).xyz();
+
+        return
+        {
+            m_center,
+            upDir * height + rightDir * m_radius + frontDir * m_radius,
+            height / 2.f
+        };
+    }
+
+    AABB CapsuleShape::getAABB() const
+    {
+        return AABB::fromCenter(m_center, Vector3(max(m_height, m_radius * 2.f) / 2.f));
+    }
+
+    WorldShape CapsuleShape::getWorldShape() const
+    {
+        return { getBounds(), m_upDirection.normalized(), m_radius };
+    }
+
+    AABB TriangleShape::getAABB() const
+    {
+        return { min(min(m_a, m_b), m_c), max(max(m_a, m_b), m_c) };
+    }
+
+    Vector3 TriangleShape::getNormal() const
+    {
+        return (m_b - m_a).cross(m_c - m_a).normalized();
+    }
+}
@@ -0,0 +1,507 @@
+#include "SpatialHashGrid.h"
+
+#include "Arithmetic.h"
+#include "Debug/Assertion.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+    SpatialHashGrid::SpatialHashGrid(const float cellSize, const float margin)
+        : IBroadphase(margin), m_cellSize(cellSize > 0.f ? cellSize : 1.f), m_isAutoCellSize(cellSize <= 0.f)
+    {
+    }
+
+    int32_t SpatialHashGrid::createProxy(const AABB& bounds, ICollider* collider)
+    {
+        int32_t proxyId = m_freeList;
+
+        if (proxyId == NULL_PROXY)
+        {
+            proxyId = static_cast<int32_t>(m_proxies.size());
+            m_proxies.emplace_back();
+        }
+        else
+        {
+            m_freeList = m_proxies[static_cast<size_t>(proxyId)].m_nextFree;
+        }
+
+        Proxy& proxy = m_proxies[static_cast<size_t>(proxyId)];
+        proxy.m_bounds = bounds.expanded(m_margin);
+        proxy.m_collider = collider;
+        proxy.m_nextFree = NULL_PROXY;
+
+        m_sizeSum += getSize(proxy.m_bounds);
+        ++m_proxyCount;
+
+        insertInCells(proxyId);
+        updateCellSize();
+        updatePairs(proxyId);
+
+        return proxyId;
+    }
+
+    void SpatialHashGrid::destroyProxy(const int32_t proxyId)
+    {
+        Proxy& proxy = m_proxies[static_cast<size_t>(proxyId)];
+        ASSERT(proxy.m_collider != nullptr, "Invalid spatial hash grid proxy");
+
+        m_pairCache.removeProxy(proxyId);
+        removeFromCells(proxyId);
+
+        m_sizeSum = --m_proxyCount == 0 ? 0.f : m_sizeSum - getSize(proxy.m_bounds);
+
+        proxy = Proxy();
+        proxy.m_nextFree = m_freeList;
+        m_freeList = proxyId;
+    }
+
+    bool SpatialHashGrid::moveProxy(const int32_t proxyId, const AABB& bounds)
+    {
+        Proxy& proxy = m_proxies[static_cast<size_t>(proxyId)];
+        ASSERT(proxy.m_collider != nullptr, "Invalid spatial hash grid proxy");
+
+        // Keep the current bounds unless the collider left them or got much smaller than them
+        if (proxy.m_bounds.contains(bounds) && bounds.expanded(m_margin * 4.f).contains(proxy.m_bounds))
+            return false;
+
+        m_sizeSum -= getSize(proxy.m_bounds);
+        proxy.m_bounds = bounds.expanded(m_margin);
+        m_sizeSum += getSize(proxy.m_bounds);
+
+        const CellCoord minCell = getCell(proxy.m_bounds.m_min);
+        const CellCoord maxCell = getCell(proxy.m_bounds.m_max);
+
+        if (proxy.m_isLarge)
+        {
+            removeFromCells(proxyId);
+            insertInCells(proxyId);
+        }
+        else if (minCell != proxy.m_minCell || maxCell != proxy.m_maxCell)
+        {
+            const CellCoord oldMinCell = proxy.m_minCell;
+            const CellCoord oldMaxCell = proxy.m_maxCell;
+
+            const int64_t cellCount = static_cast<int64_t>(maxCell.m_x - minCell.m_x + 1) *
+                (maxCell.m_y - minCell.m_y + 1) * (maxCell.m_z - minCell.m_z + 1);
+
+            if (cellCount > MAX_PROXY_CELLS)
+            {
+                removeFromCells(proxyId);
+                insertInCells(proxyId);
+            }
+            else
+            {
+                // Only the cells the proxy left or entered are updated
+                const auto isInRange = [](const CellCoord& cell, const CellCoord& rangeMin, const CellCoord& rangeMax)
+                {
+                    return cell.m_x >= rangeMin.m_x && cell.m_x <= rangeMax.m_x &&
+                        cell.m_y >= rangeMin.m_y && cell.m_y <= rangeMax.m_y &&
+                        cell.m_z >= rangeMin.m_z && cell.m_z <= rangeMax.m_z;
+                };
+
+                for (int32_t z = oldMinCell.m_z; z <= oldMaxCell.m_z; ++z)
+                {
+                    for (int32_t y = oldMinCell.m_y; y <= oldMaxCell.m_y; ++y)
+                    {
+                        for (int32_t x = oldMinCell.m_x; x <= oldMaxCell.m_x; ++x)
+                        {
+                            if (!isInRange({ x, y, z }, minCell, maxCell))
+                                removeFromCell({ x, y, z }, proxyId);
+                        }
+                    }
+                }
+
+                for (int32_t z = minCell.m_z; z <= maxCell.m_z; ++z)
+                {
+                    for (int32_t y = minCell.m_y; y <= maxCell.m_y; ++y)
+                    {
+                        for (int32_t x = minCell.m_x; x <= maxCell.m_x; ++x)
+                        {
+                            if (!isInRange({ x, y, z }, oldMinCell, oldMaxCell))
+                                addToCell({ x, y, z }, proxyId);
+                        }
+                    }
+                }
+
+                proxy.m_minCell = minCell;
+                proxy.m_maxCell = maxCell;
+            }
+        }
+
+        updateCellSize();
+        updatePairs(proxyId);
+
+        return true;
+    }
+
+    ICollider* SpatialHashGrid::getCollider(const int32_t proxyId) const
+    {
+        return m_proxies[static_cast<size_t>(proxyId)].m_collider;
+    }
+
+    const AABB& SpatialHashGrid::getFatBounds(const int32_t proxyId) const
+    {
+        return m_proxies[static_cast<size_t>(proxyId)].m_bounds;
+    }
+
+    void SpatialHashGrid::query(const AABB& bounds, std::vector<ICollider*>& colliders) const
+    {
+        const uint32_t queryStamp = nextQueryStamp();
+
+        const auto checkProxy = [this, &bounds, &colliders, queryStamp](const int32_t proxyId)
+        {
+            const Proxy& proxy = m_proxies[static_cast<size_t>(proxyId)];
+
+            if (proxy.m_queryStamp == queryStamp)
+                return;
+
+            proxy.m_queryStamp = queryStamp;
+
+            if (proxy.m_bounds.overlaps(bounds))
+                colliders.push_back(proxy.m_collider);
+        };
+
+        for (const int32_t proxyId : m_largeProxies)
+            checkProxy(proxyId);
+
+        if (m_cells.empty())
+            return;
+
+        // The cells outside of the occupied range are known to be empty
+        const CellCoord queryMin = getCell(bounds.m_min);
+        const CellCoord queryMax = getCell(bounds.m_max);
+
+        const CellCoord minCell
+        {
+            max(queryMin.m_x, m_minOccupiedCell.m_x),
+            max(queryMin.m_y, m_minOccupiedCell.m_y),
+            max(queryMin.m_z, m_minOccupiedCell.m_z)
+        };
+
+        const CellCoord maxCell
+        {
+            min(queryMax.m_x, m_maxOccupiedCell.m_x),
+            min(queryMax.m_y, m_maxOccupiedCell.m_y),
+            min(queryMax.m_z, m_maxOccupiedCell.m_z)
+        };
+
+        if (minCell.m_x > maxCell.m_x || minCell.m_y > maxCell.m_y || minCell.m_z > maxCell.m_z)
+            return;
+
+        const int64_t cellCount = static_cast<int64_t>(maxCell.m_x - minCell.m_x + 1) *
+            (maxCell.m_y - minCell.m_y + 1) * (maxCell.m_z - minCell.m_z + 1);
+
+        // Walking the stored cells is cheaper than looking up each cell of a very large range
+        if (cellCount > static_cast<int64_t>(m_cells.size()))
+        {
+            for (const auto& [cell, proxies] : m_cells)
+            {
+                if (cell.m_x < minCell.m_x || cell.m_x > maxCell.m_x ||
+                    cell.m_y < minCell.m_y || cell.m_y > maxCell.m_y ||
+                    cell.m_z < minCell.m_z || cell.m_z > maxCell.m_z)
+                    continue;
+
+                for (const int32_t proxyId : proxies)
+                    checkProxy(proxyId);
+            }
+
+            return;
+        }
+
+        for (int32_t z = minCell.m_z; z <= maxCell.m_z; ++z)
+        {
+            for (int32_t y = minCell.m_y; y <= maxCell.m_y; ++y)
+            {
+                for (int32_t x = minCell.m_x; x <= maxCell.m_x; ++x)
+                {
+                    const auto cellIt = m_cells.find({ x, y, z });
+
+                    if (cellIt == m_cells.end())
+                        continue;
+
+                    for (const int32_t proxyId : cellIt->second)
+                        checkProxy(proxyId);
+                }
+            }
+        }
+    }
+
+    void SpatialHashGrid::raycast(const Vector3&         origin, const Vector3& direction, float maxDistance,
+                                  const RaycastCallback& callback) const
+    {
+        const uint32_t queryStamp = nextQueryStamp();
+
+        for (const int32_t proxyId : m_largeProxies)
+        {
+            if (!raycastProxy(proxyId, queryStamp, origin, direction, maxDistance, callback))
+                return;
+        }
+
+        if (m_cells.empty())
+            return;
+
+        // Only the part of the ray crossing the occupied cells is walked
+        const AABB occupiedBounds
+        {
+            Vector3(static_cast<float>(m_minOccupiedCell.m_x), static_cast<float>(m_minOccupiedCell.m_y),
+                    static_cast<float>(m_minOccupiedCell.m_z)) * m_cellSize,
+            Vector3(static_cast<float>(m_maxOccupiedCell.m_x + 1), static_cast<float>(m_maxOccupiedCell.m_y + 1),
+                    static_cast<float>(m_maxOccupiedCell.m_z + 1)) * m_cellSize
+        };
+
+        float distance;
+
+        if (!occupiedBounds.raycast(origin, direction, maxDistance, distance))
+            return;
+
+        const Vector3   start = origin + direction * distance;
+        const CellCoord startCell = getCell(start);
+
+        const std::array<int32_t, 3> minCell{ m_minOccupiedCell.m_x, m_minOccupiedCell.m_y, m_minOccupiedCell.m_z };
+        const std::array<int32_t, 3> maxCell{ m_maxOccupiedCell.m_x, m_maxOccupiedCell.m_y, m_maxOccupiedCell.m_z };
+
+        std::array<int32_t, 3> cell{ startCell.m_x, startCell.m_y, startCell.m_z };
+        std::array<int32_t, 3> step{};
+        std::array<float, 3>   nextDistance{};
+        std::array<float, 3>   deltaDistance{};
+
+        // Walk the cells in the ray's order by crossing the closest cell boundary each time
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            cell[axis] = clamp(cell[axis], minCell[axis], maxCell[axis]);
+
+            const int i = static_cast<int>(axis);
+
+            if (floatEquals(direction[i], 0.f))
+            {
+                nextDistance[axis] = INFINITY;
+                deltaDistance[axis] = INFINITY;
+                continue;
+            }
+
+            step[axis] = direction[i] > 0.f ? 1 : -1;
+
+            const float boundary = static_cast<float>(cell[axis] + (step[axis] > 0 ? 1 : 0)) * m_cellSize;
+
+            nextDistance[axis] = distance + (boundary - start[i]) / direction[i];
+            deltaDistance[axis] = m_cellSize / std::abs(direction[i]);
+        }
+
+        while (distance <= maxDistance)
+        {
+            const auto cellIt = m_cells.find({ cell[0], cell[1], cell[2] });
+
+            if (cellIt != m_cells.end())
+            {
+                for (const int32_t proxyId : cellIt->second)
+                {
+                    if (!raycastProxy(proxyId, queryStamp, origin, direction, maxDistance, callback))
+                        return;
+                }
+            }
+
+            const size_t axis = nextDistance[0] < nextDistance[1]
+                                    ? (nextDistance[0] < nextDistance[2] ? 0 : 2)
+                                    : (nextDistance[1] < nextDistance[2] ? 1 : 2);
+
+            distance = nextDistance[axis];
+            nextDistance[axis] += deltaDistance[axis];
+            cell[axis] += step[axis];
+
+            if (cell[axis] < minCell[axis] || cell[axis] > maxCell[axis])
+                return;
+        }
+    }
+
+    size_t SpatialHashGrid::getProxyCount() const
+    {
+        return m_proxyCount;
+    }
+
+    bool SpatialHashGrid::canQueryConcurrently() const
+    {
+        return false;
+    }
+
+    float SpatialHashGrid::getCellSize() const
+    {
+        return m_cellSize;
+    }
+
+    size_t SpatialHashGrid::CellHash::operator()(const CellCoord& cell) const
+    {
+        const uint64_t x = static_cast<uint32_t>(cell.m_x);
+        const uint64_t y = static_cast<uint32_t>(cell.m_y);
+        const uint64_t z = static_cast<uint32_t>(cell.m_z);
+
+        // Large primes spread the neighbouring cells over the buckets
+        return std::hash<uint64_t>{}(x * 73856093u ^ y * 19349663u ^ z * 83492791u);
+    }
+
+    void SpatialHashGrid::insertInCells(const int32_t proxyId)
+    {
+        Proxy& proxy = m_proxies[static_cast<size_t>(proxyId)];
+
+        proxy.m_minCell = getCell(proxy.m_bounds.m_min);
+        proxy.m_maxCell = getCell(proxy.m_bounds.m_max);
+
+        const int64_t cellCount = static_cast<int64_t>(proxy.m_maxCell.m_x - proxy.m_minCell.m_x + 1) *
+            (proxy.m_maxCell.m_y - proxy.m_minCell.m_y + 1) * (proxy.m_maxCell.m_z - proxy.m_minCell.m_z + 1);
+
+        proxy.m_isLarge = cellCount > MAX_PROXY_CELLS;
+
+        if (proxy.m_isLarge)
+        {
+            m_largeProxies.push_back(proxyId);
+            return;
+        }
+
+        for (int32_t z = proxy.m_minCell.m_z; z <= proxy.m_maxCell.m_z; ++z)
+        {
+            for (int32_t y = proxy.m_minCell.m_y; y <= proxy.m_maxCell.m_y; ++y)
+            {
+                for (int32_t x = proxy.m_minCell.m_x; x <= proxy.m_maxCell.m_x; ++x)
+                    addToCell({ x, y, z }, proxyId);
+            }
+        }
+    }
+
+    void SpatialHashGrid::removeFromCells(const int32_t proxyId)
+    {
+        const Proxy& proxy = m_proxies[static_cast<size_t>(proxyId)];
+
+        if (proxy.m_isLarge)
+        {
+            const auto it = std::ranges::find(m_largeProxies, proxyId);
+            ASSERT(it != m_largeProxies.end(), "Large proxy missing from the spatial hash grid");
+
+            *it = m_largeProxies.back();
+            m_largeProxies.pop_back();
+            return;
+        }
+
+        for (int32_t z = proxy.m_minCell.m_z; z <= proxy.m_maxCell.m_z; ++z)
+        {
+            for (int32_t y = proxy.m_minCell.m_y; y <= proxy.m_maxCell.m_y; ++y)
+            {
+                for (int32_t x = proxy.m_minCell.m_x; x <= proxy.m_maxCell.m_x; ++x)
+                    removeFromCell({ x, y, z }, proxyId);
+            }
+        }
+    }
+
+    void SpatialHashGrid::addToCell(const CellCoord& cell, const int32_t proxyId)
+    {
+        if (m_cells.empty())
+        {
+            m_minOccupiedCell = cell;
+            m_maxOccupiedCell = cell;
+        }
+        else
+        {
+            m_minOccupiedCell = { min(m_minOccupiedCell.m_x, cell.m_x), min(m_minOccupiedCell.m_y, cell.m_y),
+                                  min(m_minOccupiedCell.m_z, cell.m_z) };
+
+            m_maxOccupiedCell = { max(m_maxOccupiedCell.m_x, cell.m_x), max(m_maxOccupiedCell.m_y, cell.m_y),
+                                  max(m_maxOccupiedCell.m_z, cell.m_z) };
+        }
+
+        m_cells[cell].push_back(proxyId);
+    }
+
+    void SpatialHashGrid::removeFromCell(const CellCoord& cell, const int32_t proxyId)
+    {
+        const auto cellIt = m_cells.find(cell);
+        ASSERT(cellIt != m_cells.end(), "Spatial hash grid proxy missing from its cell");
+
+        std::vector<int32_t>& proxies = cellIt->second;
+        const auto            it = std::ranges::find(proxies, proxyId);
+        ASSERT(it != proxies.end(), "Spatial hash grid proxy missing from its cell");
+
+        *it = proxies.back();
+        proxies.pop_back();
+
+        if (proxies.empty())
+            m_cells.erase(cellIt);
+    }
+
+    void SpatialHashGrid::updateCellSize()
+    {
+        if (!m_isAutoCellSize || m_proxyCount == 0)
+            return;
+
+        // Cells about twice as large as the average proxy keep each proxy in a few cells without crowding them
+        const float targetSize = 2.f * m_sizeSum / static_cast<float>(m_proxyCount);
+
+        // Only resize once the average drifted far enough for the rebuilds to stay rare
+        if (targetSize <= 0.f || (targetSize <= m_cellSize * 2.f && targetSize >= m_cellSize * .5f))
+            return;
+
+        m_cellSize = targetSize;
+        m_cells.clear();
+        m_largeProxies.clear();
+
+        for (size_t i = 0; i < m_proxies.size(); ++i)
+        {
+            if (m_proxies[i].m_collider != nullptr)
+                insertInCells(static_cast<int32_t>(i));
+        }
+    }
+
+    bool SpatialHashGrid::raycastProxy(const int32_t  proxyId, const uint32_t queryStamp, const Vector3& origin,
+                                       const Vector3& direction, float&       maxDistance,
+                                       const RaycastCallback& callback) const
+    {
+        const Proxy& proxy = m_proxies[static_cast<size_t>(proxyId)];
+
+        if (proxy.m_queryStamp == queryStamp)
+            return true;
+
+        proxy.m_queryStamp = queryStamp;
+
+        float distance;
+
+        if (!proxy.m_bounds.raycast(origin, direction, maxDistance, distance))
+            return true;
+
+        maxDistance = callback(proxy.m_collider, maxDistance);
+        return maxDistance >= 0.f;
+    }
+
+    uint32_t SpatialHashGrid::nextQueryStamp() const
+    {
+        // Clear the stamps on overflow so old stamps can't be mistaken for the new query's
+        if (++m_queryStamp == 0)
+        {
+            for (const Proxy& proxy : m_proxies)
+                proxy.m_queryStamp = 0;
+
+            m_queryStamp = 1;
+        }
+
+        return m_queryStamp;
+    }
+
+    SpatialHashGrid::CellCoord SpatialHashGrid::getCell(const Vector3& position) const
+    {
+        // Clamped to keep the conversion defined for huge or infinite query boxes
+        constexpr float maxCell = 1e9f;
+
+        return {
+            static_cast<int32_t>(clamp(std::floor(position.m_x / m_cellSize), -maxCell, maxCell)),
+            static_cast<int32_t>(clamp(std::floor(position.m_y / m_cellSize), -maxCell, maxCell)),
+            static_cast<int32_t>(clamp(std::floor(position.m_z / m_cellSize), -maxCell, maxCell))
+        };
+    }
+
+    float SpatialHashGrid::getSize(const AABB& bounds)
+    {
+        const Vector3 size = bounds.m_max - bounds.m_min;
+        return max(size.m_x, max(size.m_y, size.m_z));
+    }
+}
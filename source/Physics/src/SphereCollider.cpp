@@ -2,22 +2,25 @@
 #include "SphereCollider.h"
 #include "CapsuleCollider.h"
 #include "BoxCollider.h"
-
-#include "Debug/Log.h"
+#include "Entity.h"
+#include "Narrowphase.h"
+#include "SceneSerializer.h"
 
 using namespace LibMath;
 
 namespace LibGL::Physics
 {
+    REGISTER_COMPONENT_TYPE(SphereCollider);
+
     SphereCollider::SphereCollider(Entity& owner, const Vector3& center, const float radius)
-        : ICollider(owner, Bounds{ center, Vector3(radius * 2), radius }),
+        : ICollider(owner, SphereShape{ center, radius }.getBounds(), EShapeType::SPHERE),
         m_center(center), m_radius(radius)
     {
     }
 
     bool SphereCollider::check(const Vector3& point) const
     {
-        return ICollider::check(point);
+        return checkSpherePoint(getWorldShape(), point);
     }
 
     bool SphereCollider::check(const Ray& ray, float& distanceSqr) const
@@ -25,60 +28,39 @@ namespace LibGL::Physics
         return ICollider::check(ray, distanceSqr);
     }
 
-    bool SphereCollider::check(const ICollider& other) const
-    {
-        const auto otherTypeHash = typeid(other).hash_code();
-
-        if (otherTypeHash == typeid(BoxCollider).hash_code())
-            return checkBox(dynamic_cast<const BoxCollider&>(other));
-
-        if (otherTypeHash == typeid(SphereCollider).hash_code())
-            return checkSphere(dynamic_cast<const SphereCollider&>(other));
-
-        if (otherTypeHash == typeid(CapsuleCollider).hash_code())
-            return checkCapsule(dynamic_cast<const CapsuleCollider&>(other));
-
-        DEBUG_LOG("WARNING: collisions between 'SphereCollider' and '%s' are not supported.\n", typeid(other).name());
-        return false;
-    }
-
     bool SphereCollider::checkBox(const BoxCollider& other) const
     {
-        return other.checkSphere(*this);
+        return checkBoxSphere(other.getWorldShape(), getWorldShape());
     }
 
     bool SphereCollider::checkSphere(const SphereCollider& other) const
     {
-        return ICollider::check(other);
+        return checkSphereSphere(getWorldShape(), other.getWorldShape());
     }
 
     bool SphereCollider::checkCapsule(const CapsuleCollider& other) const
     {
-        // Check the bounding spheres first to avoid unnecessary computation
-        if (!ICollider::check(other))
-            return false;
-
-        const auto center = getBounds().m_center;
-        const auto radius = getBounds().m_sphereRadius;
-
-        const auto capsuleCenter = other.getBounds().m_center;
-        const auto capsuleRadius = other.getRadius();
-        const auto capsuleOrientedHeight = other.getUpDirection() * (other.getHeight() - capsuleRadius);
+        return checkSphereCapsule(getWorldShape(), other.getWorldShape());
+    }
 
-        const float totalRadius = radius + capsuleRadius;
+    bool SphereCollider::check(const SphereShape& sphere) const
+    {
+        return checkSphereSphere(getWorldShape(), sphere.getWorldShape());
+    }
 
-        // Get the closest point to the sphere's center on the capsule's center segment
-        const Vector3 closestPoint = getClosestPointOnSegment(center,
-            capsuleCenter - capsuleOrientedHeight / 2.f,
-            capsuleCenter + capsuleOrientedHeight / 2.f);
+    bool SphereCollider::check(const BoxShape& box) const
+    {
+        return checkBoxSphere(box.getWorldShape(), getWorldShape());
+    }
 
-        return center.distanceSquaredFrom(closestPoint) <= totalRadius * totalRadius;
+    bool SphereCollider::check(const CapsuleShape& capsule) const
+    {
+        return checkSphereCapsule(getWorldShape(), capsule.getWorldShape());
     }
 
     Vector3 SphereCollider::getClosestPoint(const Vector3& point) const
     {
-        const auto [center, _, radius] = getBounds();
-        return center + (point - center).normalized() * min(radius, center.distanceFrom(point));
+        return getClosestPointOnSphere(getWorldShape(), point);
     }
 
     Vector3 SphereCollider::getClosestPointOnSurface(const Vector3& point) const
@@ -86,4 +68,22 @@ namespace LibGL::Physics
         const auto [center, _, radius] = getBounds();
         return center + (point - center).normalized() * radius;
     }
+
+    void SphereCollider::serialize(Resources::SceneWriter& writer) const
+    {
+        writer.write(m_center);
+        writer.write(m_radius);
+        serializeSettings(writer);
+    }
+
+    SphereCollider& SphereCollider::deserialize(Entity& owner, Resources::SceneReader& reader)
+    {
+        const Vector3 center = reader.read<Vector3>();
+        const float   radius = reader.read<float>();
+
+        SphereCollider& collider = owner.addComponent<SphereCollider>(center, radius);
+        collider.deserializeSettings(reader);
+
+        return collider;
+    }
 }
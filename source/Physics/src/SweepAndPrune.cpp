@@ -0,0 +1,300 @@
+#include "SweepAndPrune.h"
+
+#include "Arithmetic.h"
+#include "Debug/Assertion.h"
+
+#include <algorithm>
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+    SweepAndPrune::SweepAndPrune(const uint8_t axisCount, const float margin)
+        : IBroadphase(margin), m_axisCount(axisCount)
+    {
+        ASSERT(axisCount == 1 || axisCount == MAX_AXES, "Sweep and prune must sort either 1 or 3 axes");
+    }
+
+    int32_t SweepAndPrune::createProxy(const AABB& bounds, ICollider* collider)
+    {
+        int32_t proxyId = m_freeList;
+
+        if (proxyId == NULL_PROXY)
+        {
+            proxyId = static_cast<int32_t>(m_proxies.size());
+            m_proxies.emplace_back();
+        }
+        else
+        {
+            m_freeList = m_proxies[static_cast<size_t>(proxyId)].m_nextFree;
+        }
+
+        Proxy& proxy = m_proxies[static_cast<size_t>(proxyId)];
+        proxy.m_bounds = bounds.expanded(m_margin);
+        proxy.m_collider = collider;
+        proxy.m_nextFree = NULL_PROXY;
+
+        m_maxSizeX = max(m_maxSizeX, proxy.m_bounds.m_max.m_x - proxy.m_bounds.m_min.m_x);
+
+        // Begin the pairs before inserting the endpoints to avoid finding the proxy itself
+        const AABB fatBounds = proxy.m_bounds;
+
+        for (uint32_t i = findFirstX(fatBounds.m_min.m_x);
+             i < m_endpoints[0].size() && m_endpoints[0][i].m_value <= fatBounds.m_max.m_x; ++i)
+        {
+            const Endpoint& endpoint = m_endpoints[0][i];
+
+            if (!endpoint.m_isMax &&
+                m_proxies[static_cast<size_t>(endpoint.m_proxyId)].m_bounds.m_max.m_x >= fatBounds.m_min.m_x &&
+                overlapsOnOtherAxes(proxyId, endpoint.m_proxyId, 0))
+                m_pairCache.addPair(proxyId, endpoint.m_proxyId);
+        }
+
+        for (uint8_t axis = 0; axis < m_axisCount; ++axis)
+        {
+            std::vector<Endpoint>& endpoints = m_endpoints[axis];
+
+            const Endpoint minEndpoint{ fatBounds.m_min[axis], proxyId, false };
+            const Endpoint maxEndpoint{ fatBounds.m_max[axis], proxyId, true };
+
+            auto minIt = std::lower_bound(endpoints.begin(), endpoints.end(), minEndpoint);
+            minIt = endpoints.insert(minIt, minEndpoint);
+
+            const auto minIndex = static_cast<uint32_t>(minIt - endpoints.begin());
+            const auto maxIt = std::lower_bound(minIt + 1, endpoints.end(), maxEndpoint);
+            endpoints.insert(maxIt, maxEndpoint);
+
+            for (uint32_t i = minIndex; i < endpoints.size(); ++i)
+                updateEndpointIndex(axis, i);
+        }
+
+        ++m_proxyCount;
+        return proxyId;
+    }
+
+    void SweepAndPrune::destroyProxy(const int32_t proxyId)
+    {
+        Proxy& proxy = m_proxies[static_cast<size_t>(proxyId)];
+        ASSERT(proxy.m_collider != nullptr, "Invalid sweep and prune proxy");
+
+        m_pairCache.removeProxy(proxyId);
+
+        for (uint8_t axis = 0; axis < m_axisCount; ++axis)
+        {
+            std::vector<Endpoint>& endpoints = m_endpoints[axis];
+            const uint32_t         minIndex = proxy.m_min[axis];
+
+            endpoints.erase(endpoints.begin() + proxy.m_max[axis]);
+            endpoints.erase(endpoints.begin() + minIndex);
+
+            for (uint32_t i = minIndex; i < endpoints.size(); ++i)
+                updateEndpointIndex(axis, i);
+        }
+
+        proxy = Proxy();
+        proxy.m_nextFree = m_freeList;
+        m_freeList = proxyId;
+
+        if (--m_proxyCount == 0)
+            m_maxSizeX = 0.f;
+    }
+
+    bool SweepAndPrune::moveProxy(const int32_t proxyId, const AABB& bounds)
+    {
+        Proxy& proxy = m_proxies[static_cast<size_t>(proxyId)];
+        ASSERT(proxy.m_collider != nullptr, "Invalid sweep and prune proxy");
+
+        // Keep the current bounds unless the collider left them or got much smaller than them
+        if (proxy.m_bounds.contains(bounds) && bounds.expanded(m_margin * 4.f).contains(proxy.m_bounds))
+            return false;
+
+        const AABB oldBounds = proxy.m_bounds;
+        proxy.m_bounds = bounds.expanded(m_margin);
+
+        m_maxSizeX = max(m_maxSizeX, proxy.m_bounds.m_max.m_x - proxy.m_bounds.m_min.m_x);
+
+        for (uint8_t axis = 0; axis < m_axisCount; ++axis)
+        {
+            const float newMin = proxy.m_bounds.m_min[axis];
+            const float newMax = proxy.m_bounds.m_max[axis];
+
+            m_endpoints[axis][proxy.m_min[axis]].m_value = newMin;
+            m_endpoints[axis][proxy.m_max[axis]].m_value = newMax;
+
+            // Growing first then shrinking keeps the proxy's min before its max at all times
+            if (newMin < oldBounds.m_min[axis])
+                sortDown(axis, proxy.m_min[axis]);
+
+            if (newMax > oldBounds.m_max[axis])
+                sortUp(axis, proxy.m_max[axis]);
+
+            if (newMin > oldBounds.m_min[axis])
+                sortUp(axis, proxy.m_min[axis]);
+
+            if (newMax < oldBounds.m_max[axis])
+                sortDown(axis, proxy.m_max[axis]);
+        }
+
+        return true;
+    }
+
+    ICollider* SweepAndPrune::getCollider(const int32_t proxyId) const
+    {
+        return m_proxies[static_cast<size_t>(proxyId)].m_collider;
+    }
+
+    const AABB& SweepAndPrune::getFatBounds(const int32_t proxyId) const
+    {
+        return m_proxies[static_cast<size_t>(proxyId)].m_bounds;
+    }
+
+    void SweepAndPrune::query(const AABB& bounds, std::vector<ICollider*>& colliders) const
+    {
+        const std::vector<Endpoint>& endpoints = m_endpoints[0];
+
+        for (uint32_t i = findFirstX(bounds.m_min.m_x);
+             i < endpoints.size() && endpoints[i].m_value <= bounds.m_max.m_x; ++i)
+        {
+            if (endpoints[i].m_isMax)
+                continue;
+
+            const Proxy& proxy = m_proxies[static_cast<size_t>(endpoints[i].m_proxyId)];
+
+            if (proxy.m_bounds.overlaps(bounds))
+                colliders.push_back(proxy.m_collider);
+        }
+    }
+
+    void SweepAndPrune::raycast(const Vector3&         origin, const Vector3& direction, float maxDistance,
+                                const RaycastCallback& callback) const
+    {
+        const std::vector<Endpoint>& endpoints = m_endpoints[0];
+
+        // Avoid multiplying an infinite distance by a null direction
+        const float reachX = floatEquals(direction.m_x, 0.f) ? 0.f : direction.m_x * maxDistance;
+        const float minX = min(origin.m_x, origin.m_x + reachX);
+        const float maxX = max(origin.m_x, origin.m_x + reachX);
+
+        for (uint32_t i = findFirstX(minX); i < endpoints.size() && endpoints[i].m_value <= maxX; ++i)
+        {
+            if (endpoints[i].m_isMax)
+                continue;
+
+            const Proxy& proxy = m_proxies[static_cast<size_t>(endpoints[i].m_proxyId)];
+            float        distance;
+
+            if (!proxy.m_bounds.raycast(origin, direction, maxDistance, distance))
+                continue;
+
+            maxDistance = callback(proxy.m_collider, maxDistance);
+
+            if (maxDistance < 0.f)
+                return;
+        }
+    }
+
+    size_t SweepAndPrune::getProxyCount() const
+    {
+        return m_proxyCount;
+    }
+
+    bool SweepAndPrune::Endpoint::operator<(const Endpoint& other) const
+    {
+        // Min endpoints come first on equality so touching boxes are considered overlapping
+        return m_value < other.m_value || (m_value <= other.m_value && !m_isMax && other.m_isMax);
+    }
+
+    void SweepAndPrune::sortDown(const uint8_t axis, uint32_t index)
+    {
+        std::vector<Endpoint>& endpoints = m_endpoints[axis];
+
+        while (index > 0 && endpoints[index] < endpoints[index - 1])
+        {
+            const Endpoint& endpoint = endpoints[index];
+            const Endpoint& previous = endpoints[index - 1];
+
+            if (endpoint.m_proxyId != previous.m_proxyId)
+            {
+                // A min going below a max starts an overlap on this axis while a max going below a min ends it
+                if (!endpoint.m_isMax && previous.m_isMax)
+                {
+                    if (overlapsOnOtherAxes(endpoint.m_proxyId, previous.m_proxyId, axis))
+                        m_pairCache.addPair(endpoint.m_proxyId, previous.m_proxyId);
+                }
+                else if (endpoint.m_isMax && !previous.m_isMax)
+                {
+                    m_pairCache.removePair(endpoint.m_proxyId, previous.m_proxyId);
+                }
+            }
+
+            swapEndpoints(axis, --index);
+        }
+    }
+
+    void SweepAndPrune::sortUp(const uint8_t axis, uint32_t index)
+    {
+        std::vector<Endpoint>& endpoints = m_endpoints[axis];
+
+        while (index + 1 < endpoints.size() && endpoints[index + 1] < endpoints[index])
+        {
+            const Endpoint& endpoint = endpoints[index];
+            const Endpoint& next = endpoints[index + 1];
+
+            if (endpoint.m_proxyId != next.m_proxyId)
+            {
+                // A max going above a min starts an overlap on this axis while a min going above a max ends it
+                if (endpoint.m_isMax && !next.m_isMax)
+                {
+                    if (overlapsOnOtherAxes(endpoint.m_proxyId, next.m_proxyId, axis))
+                        m_pairCache.addPair(endpoint.m_proxyId, next.m_proxyId);
+                }
+                else if (!endpoint.m_isMax && next.m_isMax)
+                {
+                    m_pairCache.removePair(endpoint.m_proxyId, next.m_proxyId);
+                }
+            }
+
+            swapEndpoints(axis, index++);
+        }
+    }
+
+    void SweepAndPrune::swapEndpoints(const uint8_t axis, const uint32_t index)
+    {
+        std::swap(m_endpoints[axis][index], m_endpoints[axis][index + 1]);
+
+        updateEndpointIndex(axis, index);
+        updateEndpointIndex(axis, index + 1);
+    }
+
+    void SweepAndPrune::updateEndpointIndex(const uint8_t axis, const uint32_t index)
+    {
+        const Endpoint& endpoint = m_endpoints[axis][index];
+        Proxy&          proxy = m_proxies[static_cast<size_t>(endpoint.m_proxyId)];
+
+        (endpoint.m_isMax ? proxy.m_max : proxy.m_min)[axis] = index;
+    }
+
+    bool SweepAndPrune::overlapsOnOtherAxes(const int32_t first, const int32_t second, const uint8_t skippedAxis) const
+    {
+        const AABB& firstBounds = m_proxies[static_cast<size_t>(first)].m_bounds;
+        const AABB& secondBounds = m_proxies[static_cast<size_t>(second)].m_bounds;
+
+        for (uint8_t axis = 0; axis < m_axisCount; ++axis)
+        {
+            if (axis != skippedAxis &&
+                (firstBounds.m_min[axis] > secondBounds.m_max[axis] || firstBounds.m_max[axis] < secondBounds.m_min[axis]))
+                return false;
+        }
+
+        return true;
+    }
+
+    uint32_t SweepAndPrune::findFirstX(const float minX) const
+    {
+        // No proxy is larger than the largest one so the overlapping ones can't start before this value
+        const Endpoint first{ minX - m_maxSizeX, NULL_PROXY, false };
+        const std::vector<Endpoint>& endpoints = m_endpoints[0];
+
+        return static_cast<uint32_t>(std::lower_bound(endpoints.begin(), endpoints.end(), first) - endpoints.begin());
+    }
+}
@@ -0,0 +1,421 @@
+#include "TriangleMesh.h"
+
+#include "Arithmetic.h"
+#include "Narrowphase.h"
+#include "Debug/Assertion.h"
+#include "Utility/BinaryReader.h"
+#include "Utility/BinaryWriter.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+    TriangleMesh::TriangleMesh(std::vector<Vector3> positions, std::vector<uint32_t> indices)
+        : m_positions(std::move(positions)), m_indices(std::move(indices))
+    {
+        ASSERT(m_indices.size() % 3 == 0, "A triangle mesh needs three indices per triangle");
+
+        const uint32_t triangleCount = static_cast<uint32_t>(m_indices.size() / 3);
+
+        if (triangleCount == 0)
+            return;
+
+        std::vector<uint32_t> order(triangleCount);
+        std::vector<Vector3>  centroids(triangleCount);
+        std::vector<AABB>     bounds(triangleCount);
+
+        for (uint32_t i = 0; i < triangleCount; ++i)
+        {
+            ASSERT(m_indices[i * 3] < m_positions.size() && m_indices[i * 3 + 1] < m_positions.size() &&
+                m_indices[i * 3 + 2] < m_positions.size(), "Invalid triangle mesh vertex index");
+
+            order[i] = i;
+            bounds[i] = getTriangle(i).getAABB();
+            centroids[i] = (bounds[i].m_min + bounds[i].m_max) * .5f;
+        }
+
+        // Every split leaves at least one triangle on each side, so the tree can't have more nodes than that
+        m_nodes.reserve(2 * static_cast<size_t>(triangleCount) - 1);
+        buildNode(order, centroids, bounds, 0, triangleCount, 0);
+        m_nodes.shrink_to_fit();
+
+        std::vector<uint32_t> sortedIndices(m_indices.size());
+
+        for (uint32_t i = 0; i < triangleCount; ++i)
+            std::copy_n(m_indices.begin() + order[i] * 3, 3, sortedIndices.begin() + i * 3);
+
+        m_indices = std::move(sortedIndices);
+    }
+
+    size_t TriangleMesh::getTriangleCount() const
+    {
+        return m_indices.size() / 3;
+    }
+
+    TriangleShape TriangleMesh::getTriangle(const uint32_t index) const
+    {
+        const size_t first = static_cast<size_t>(index) * 3;
+        return { m_positions[m_indices[first]], m_positions[m_indices[first + 1]], m_positions[m_indices[first + 2]] };
+    }
+
+    AABB TriangleMesh::getBounds() const
+    {
+        return m_nodes.empty() ? AABB{ Vector3::zero(), Vector3::zero() } : m_nodes[0].m_bounds;
+    }
+
+    std::span<const TriangleMesh::Node> TriangleMesh::getNodes() const
+    {
+        return m_nodes;
+    }
+
+    bool TriangleMesh::raycast(const Vector3& origin, const Vector3& direction, const float maxDistance,
+                               float&         distance, uint32_t& triangleIndex) const
+    {
+        if (m_nodes.empty())
+            return false;
+
+        const Vector3 inverseDirection = Vector3::one() / direction;
+        float         closestDistance = maxDistance;
+        bool          isHit = false;
+
+        // Slab test giving whether the box is entered before the closest hit found so far
+        const auto isBoxHit = [&](const AABB& box)
+        {
+            const Vector3 toMin = (box.m_min - origin) * inverseDirection;
+            const Vector3 toMax = (box.m_max - origin) * inverseDirection;
+
+            const float entry = max(max(min(toMin.m_x, toMax.m_x), min(toMin.m_y, toMax.m_y)),
+                min(toMin.m_z, toMax.m_z));
+
+            const float exit = min(min(max(toMin.m_x, toMax.m_x), max(toMin.m_y, toMax.m_y)),
+                max(toMin.m_z, toMax.m_z));
+
+            return entry <= exit && exit >= 0.f && entry <= closestDistance;
+        };
+
+        std::array<uint32_t, MAX_DEPTH + 1> stack;
+        size_t                              stackSize = 0;
+
+        stack[stackSize++] = 0;
+
+        while (stackSize > 0)
+        {
+            const uint32_t nodeIndex = stack[--stackSize];
+            const Node&    node = m_nodes[nodeIndex];
+
+            if (!isBoxHit(node.m_bounds))
+                continue;
+
+            if (node.m_triangleCount != 0)
+            {
+                for (uint32_t i = node.m_offset; i < node.m_offset + node.m_triangleCount; ++i)
+                {
+                    float hitDistance;
+
+                    if (raycastTriangle(getTriangle(i), origin, direction, hitDistance) &&
+                        hitDistance <= closestDistance)
+                    {
+                        closestDistance = hitDistance;
+                        triangleIndex = i;
+                        isHit = true;
+                    }
+                }
+
+                continue;
+            }
+
+            // Visit the child on the ray's side of the split first so the hits found there clip the other one
+            const bool isReversed = direction[node.m_splitAxis] < 0.f;
+
+            stack[stackSize++] = isReversed ? nodeIndex + 1 : node.m_offset;
+            stack[stackSize++] = isReversed ? node.m_offset : nodeIndex + 1;
+        }
+
+        if (isHit)
+            distance = closestDistance;
+
+        return isHit;
+    }
+
+    Vector3 TriangleMesh::getClosestPoint(const Vector3& point, uint32_t& triangleIndex) const
+    {
+        if (m_nodes.empty())
+            return point;
+
+        Vector3 closestPoint = point;
+        float   closestDistanceSqr = INFINITY;
+
+        std::array<uint32_t, MAX_DEPTH + 1> stack;
+        size_t                              stackSize = 0;
+
+        stack[stackSize++] = 0;
+
+        while (stackSize > 0)
+        {
+            const uint32_t nodeIndex = stack[--stackSize];
+            const Node&    node = m_nodes[nodeIndex];
+
+            if (getDistanceSquared(node.m_bounds, point) >= closestDistanceSqr)
+                continue;
+
+            if (node.m_triangleCount != 0)
+            {
+                for (uint32_t i = node.m_offset; i < node.m_offset + node.m_triangleCount; ++i)
+                {
+                    const Vector3 candidate = getClosestPointOnTriangle(getTriangle(i), point);
+                    const float   distanceSqr = candidate.distanceSquaredFrom(point);
+
+                    if (distanceSqr < closestDistanceSqr)
+                    {
+                        closestPoint = candidate;
+                        closestDistanceSqr = distanceSqr;
+                        triangleIndex = i;
+                    }
+                }
+
+                continue;
+            }
+
+            // Visit the closest child first to skip the other one as soon as possible
+            const bool isReversed = getDistanceSquared(m_nodes[node.m_offset].m_bounds, point) <
+                getDistanceSquared(m_nodes[nodeIndex + 1].m_bounds, point);
+
+            stack[stackSize++] = isReversed ? nodeIndex + 1 : node.m_offset;
+            stack[stackSize++] = isReversed ? node.m_offset : nodeIndex + 1;
+        }
+
+        return closestPoint;
+    }
+
+    void TriangleMesh::serialize(Utility::BinaryWriter& writer) const
+    {
+        writer.write(static_cast<uint32_t>(m_positions.size()));
+        writer.writeBytes(m_positions.data(), m_positions.size() * sizeof(Vector3));
+
+        writer.write(static_cast<uint32_t>(m_indices.size()));
+        writer.writeBytes(m_indices.data(), m_indices.size() * sizeof(uint32_t));
+
+        // The nodes are written field by field to leave their padding out
+        writer.write(static_cast<uint32_t>(m_nodes.size()));
+
+        for (const Node& node : m_nodes)
+        {
+            writer.write(node.m_bounds);
+            writer.write(node.m_offset);
+            writer.write(node.m_triangleCount);
+            writer.write(node.m_splitAxis);
+        }
+    }
+
+    TriangleMesh TriangleMesh::deserialize(Utility::BinaryReader& reader)
+    {
+        constexpr size_t nodeSize = sizeof(AABB) + sizeof(uint32_t) + sizeof(uint16_t) + sizeof(uint8_t);
+
+        const auto readArray = [&reader](auto& values)
+        {
+            using ValueT = typename std::remove_reference_t<decltype(values)>::value_type;
+
+            const size_t   count = reader.read<uint32_t>();
+            const uint8_t* bytes = reader.readBytes(count * sizeof(ValueT));
+
+            if (bytes == nullptr)
+                return;
+
+            values.resize(count);
+            std::memcpy(values.data(), bytes, count * sizeof(ValueT));
+        };
+
+        TriangleMesh mesh;
+        readArray(mesh.m_positions);
+        readArray(mesh.m_indices);
+
+        const size_t nodeCount = reader.read<uint32_t>();
+
+        if (!reader.isValid() || nodeCount * nodeSize > reader.getRemaining())
+        {
+            reader.skip(nodeCount * nodeSize);
+            return {};
+        }
+
+        mesh.m_nodes.resize(nodeCount);
+
+        for (Node& node : mesh.m_nodes)
+        {
+            node.m_bounds = reader.read<AABB>();
+            node.m_offset = reader.read<uint32_t>();
+            node.m_triangleCount = reader.read<uint16_t>();
+            node.m_splitAxis = reader.read<uint8_t>();
+        }
+
+        if (!reader.isValid() || !mesh.isValid())
+            return {};
+
+        return mesh;
+    }
+
+    void TriangleMesh::buildNode(std::vector<uint32_t>& order, const std::vector<Vector3>& centroids,
+                                 const std::vector<AABB>& bounds, const uint32_t first, const uint32_t count,
+                                 const uint32_t           depth)
+    {
+        const uint32_t nodeIndex = static_cast<uint32_t>(m_nodes.size());
+        m_nodes.push_back({});
+
+        const auto begin = order.begin() + first;
+        const auto end = begin + count;
+
+        AABB nodeBounds = bounds[*begin];
+        AABB centroidBounds{ centroids[*begin], centroids[*begin] };
+
+        for (auto it = begin + 1; it != end; ++it)
+        {
+            nodeBounds = nodeBounds.merged(bounds[*it]);
+            centroidBounds = centroidBounds.merged({ centroids[*it], centroids[*it] });
+        }
+
+        m_nodes[nodeIndex].m_bounds = nodeBounds;
+
+        if (count <= MAX_LEAF_TRIANGLES)
+        {
+            m_nodes[nodeIndex].m_offset = first;
+            m_nodes[nodeIndex].m_triangleCount = static_cast<uint16_t>(count);
+            return;
+        }
+
+        const Vector3 extent = centroidBounds.m_max - centroidBounds.m_min;
+
+        const auto getBin = [&](const uint32_t triangle, const uint8_t axis)
+        {
+            const float ratio = (centroids[triangle][axis] - centroidBounds.m_min[axis]) / extent[axis];
+            return min(static_cast<uint32_t>(ratio * SAH_BIN_COUNT), SAH_BIN_COUNT - 1);
+        };
+
+        // Binned surface area heuristic: the best split minimizes the children's area weighted by their triangle count
+        float    bestCost = INFINITY;
+        uint8_t  splitAxis = extent.m_x >= extent.m_y && extent.m_x >= extent.m_z ? 0 : extent.m_y >= extent.m_z ? 1 : 2;
+        uint32_t splitBin = 0;
+
+        for (uint8_t axis = 0; axis < 3 && depth < MAX_SAH_DEPTH; ++axis)
+        {
+            if (extent[axis] <= 0.f)
+                continue;
+
+            std::array<AABB, SAH_BIN_COUNT>     binBounds;
+            std::array<uint32_t, SAH_BIN_COUNT> binCounts{};
+
+            binBounds.fill({ Vector3(INFINITY), Vector3(-INFINITY) });
+
+            for (auto it = begin; it != end; ++it)
+            {
+                const uint32_t bin = getBin(*it, axis);
+                binBounds[bin] = binBounds[bin].merged(bounds[*it]);
+                ++binCounts[bin];
+            }
+
+            std::array<float, SAH_BIN_COUNT> rightCosts{};
+            AABB                             rightBounds{ Vector3(INFINITY), Vector3(-INFINITY) };
+            uint32_t                         rightCount = 0;
+
+            for (uint32_t bin = SAH_BIN_COUNT - 1; bin > 0; --bin)
+            {
+                rightBounds = rightBounds.merged(binBounds[bin]);
+                rightCount += binCounts[bin];
+                rightCosts[bin] = rightCount > 0 ? rightBounds.getSurfaceArea() * static_cast<float>(rightCount) : 0.f;
+            }
+
+            AABB     leftBounds{ Vector3(INFINITY), Vector3(-INFINITY) };
+            uint32_t leftCount = 0;
+
+            for (uint32_t bin = 0; bin + 1 < SAH_BIN_COUNT; ++bin)
+            {
+                leftBounds = leftBounds.merged(binBounds[bin]);
+                leftCount += binCounts[bin];
+
+                if (leftCount == 0 || leftCount == count)
+                    continue;
+
+                const float cost = leftBounds.getSurfaceArea() * static_cast<float>(leftCount) + rightCosts[bin + 1];
+
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    splitAxis = axis;
+                    splitBin = bin;
+                }
+            }
+        }
+
+        auto middle = begin + count / 2;
+
+        if (bestCost < INFINITY)
+        {
+            middle = std::partition(begin, end, [&](const uint32_t triangle)
+            {
+                return getBin(triangle, splitAxis) <= splitBin;
+            });
+        }
+        else
+        {
+            // Too deep or overlapping centroids, split at the median to at least halve the triangles
+            std::nth_element(begin, middle, end, [&](const uint32_t triangle, const uint32_t other)
+            {
+                return centroids[triangle][splitAxis] < centroids[other][splitAxis];
+            });
+        }
+
+        const uint32_t leftCount = static_cast<uint32_t>(middle - begin);
+
+        m_nodes[nodeIndex].m_splitAxis = splitAxis;
+        buildNode(order, centroids, bounds, first, leftCount, depth + 1);
+
+        m_nodes[nodeIndex].m_offset = static_cast<uint32_t>(m_nodes.size());
+        buildNode(order, centroids, bounds, first + leftCount, count - leftCount, depth + 1);
+    }
+
+    bool TriangleMesh::isValid() const
+    {
+        if (m_indices.size() % 3 != 0 || m_nodes.empty() != m_indices.empty())
+            return false;
+
+        for (const uint32_t index : m_indices)
+        {
+            if (index >= m_positions.size())
+                return false;
+        }
+
+        // Children always follow their parent, which rules out cycles, and the depth must fit the traversal stacks
+        std::vector<uint32_t> depths(m_nodes.size(), 0);
+
+        for (size_t i = 0; i < m_nodes.size(); ++i)
+        {
+            const Node& node = m_nodes[i];
+
+            if (node.m_splitAxis > 2 || depths[i] > MAX_DEPTH)
+                return false;
+
+            if (node.m_triangleCount != 0)
+            {
+                if (static_cast<size_t>(node.m_offset) + node.m_triangleCount > getTriangleCount())
+                    return false;
+
+                continue;
+            }
+
+            if (i + 1 >= m_nodes.size() || node.m_offset <= i + 1 || node.m_offset >= m_nodes.size())
+                return false;
+
+            depths[i + 1] = max(depths[i + 1], depths[i] + 1);
+            depths[node.m_offset] = max(depths[node.m_offset], depths[i] + 1);
+        }
+
+        return true;
+    }
+
+    float TriangleMesh::getDistanceSquared(const AABB& box, const Vector3& point)
+    {
+        return point.distanceSquaredFrom(clamp(point, box.m_min, box.m_max));
+    }
+}
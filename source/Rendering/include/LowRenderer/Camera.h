@@ -53,6 +53,12 @@ namespace LibGL::Rendering
          */
         Camera& operator=(Camera&& other) noexcept;
 
+        /**
+         * \brief Creates a detached deep copy of the camera
+         * \return A pointer to the created copy
+         */
+        std::shared_ptr<Entity> clone() const override;
+
         /**
          * \brief Gets the camera's view matrix
          * \return The camera's view matrix
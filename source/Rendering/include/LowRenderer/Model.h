@@ -34,16 +34,31 @@ namespace LibGL::Rendering
 
         /**
          * \brief Gets the model's material
-         * \return A copy of the model's material
+         * \return A reference to the model's material
          */
-        Resources::Material getMaterial() const;
+        const Resources::Material& getMaterial() const;
 
         /**
-         * \brief Gets the model's material
-         * \return A reference to the model's material
+         * \brief Gets the model's material for modification, like makeMaterialUnique.
+         * Read the material through a const model to keep sharing it
+         * \return A reference to the model's unique material
          */
         Resources::Material& getMaterial();
 
+        /**
+         * \brief Gives the model its own copy of its material if it is shared with other models
+         * (e.g. instances of the same prefab) and gets it for modification.
+         * Must not be called while the model is being copied on another thread.
+         * \return A reference to the model's unique material
+         */
+        Resources::Material& makeMaterialUnique();
+
+        /**
+         * \brief Creates a detached deep copy of the model sharing its material until either of them modifies it
+         * \return A pointer to the created copy
+         */
+        std::shared_ptr<Entity> clone() const override;
+
         /**
          * \brief Draws the model using the given view-projection matrix
          * \param viewProjMat The target view-projection matrix
@@ -51,8 +66,21 @@ namespace LibGL::Rendering
          */
         void draw(const LibMath::Matrix4x4& viewProjMat, Resources::Shader* shaderOverride) const override;
 
+        /**
+         * \brief Writes the model's mesh and material
+         * \param writer The scene's writer
+         */
+        void serialize(LibGL::Resources::SceneWriter& writer) const;
+
+        /**
+         * \brief Creates a model from the data written by serialize
+         * \param reader The scene's reader
+         * \return A pointer to the created model. nullptr if its mesh or material couldn't be loaded
+         */
+        static std::shared_ptr<Model> deserialize(LibGL::Resources::SceneReader& reader);
+
     private:
-        const Resources::Mesh* m_mesh = nullptr;
-        Resources::Material    m_material;
+        const Resources::Mesh*               m_mesh = nullptr;
+        std::shared_ptr<Resources::Material> m_material;
     };
 }
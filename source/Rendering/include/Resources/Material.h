@@ -2,6 +2,14 @@
 #include "Core/Color.h"
 #include "Vector/Vector2.h"
 
+#include <optional>
+
+namespace LibGL::Resources
+{
+    class SceneReader;
+    class SceneWriter;
+}
+
 namespace LibGL::Rendering::Resources
 {
     class Shader;
@@ -141,6 +149,19 @@ namespace LibGL::Rendering::Resources
          */
         void use() const;
 
+        /**
+         * \brief Writes the material's data
+         * \param writer The scene's writer
+         */
+        void serialize(LibGL::Resources::SceneWriter& writer) const;
+
+        /**
+         * \brief Creates a material from the data written by serialize
+         * \param reader The scene's reader
+         * \return The read material. An empty optional if its shader isn't loaded
+         */
+        static std::optional<Material> deserialize(LibGL::Resources::SceneReader& reader);
+
     private:
         Maps        m_maps;
         UVModifiers m_uvModifiers;
@@ -32,6 +32,18 @@ namespace LibGL::Rendering::Resources
          */
         void draw() const;
 
+        /**
+         * \brief Gets the model's vertices
+         * \return The model's vertices
+         */
+        const std::vector<Vertex>& getVertices() const;
+
+        /**
+         * \brief Gets the model's triangles' vertex indices
+         * \return The model's vertex indices
+         */
+        const std::vector<uint32_t>& getIndices() const;
+
     protected:
         std::vector<Vertex>   m_vertices;
         std::vector<uint32_t> m_indices;
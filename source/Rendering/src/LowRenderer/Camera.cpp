@@ -60,6 +60,11 @@ namespace LibGL::Rendering
         return *this;
     }
 
+    std::shared_ptr<Entity> Camera::clone() const
+    {
+        return std::make_shared<Camera>(*this);
+    }
+
     Matrix4 Camera::getViewMatrix() const
     {
         return m_viewMatrix;
@@ -1,5 +1,6 @@
 #include "LowRenderer/Model.h"
 
+#include "SceneSerializer.h"
 #include "LowRenderer/Camera.h"
 #include "Resources/Mesh.h"
 #include "Resources/Shader.h"
@@ -10,8 +11,10 @@ using namespace LibGL::Rendering::Resources;
 
 namespace LibGL::Rendering
 {
+    REGISTER_ENTITY_TYPE(Model);
+
     Model::Model(Entity* parent, const Mesh& mesh, Material material)
-        : Entity(parent, Transform()), m_mesh(&mesh), m_material(std::move(material))
+        : Entity(parent, Transform()), m_mesh(&mesh), m_material(std::make_shared<Material>(std::move(material)))
     {
     }
 
@@ -25,21 +28,34 @@ namespace LibGL::Rendering
         m_mesh = &mesh;
     }
 
-    Material Model::getMaterial() const
+    const Material& Model::getMaterial() const
     {
-        return m_material;
+        return *m_material;
     }
 
     Material& Model::getMaterial()
     {
-        return m_material;
+        return makeMaterialUnique();
+    }
+
+    Material& Model::makeMaterialUnique()
+    {
+        if (m_material.use_count() > 1)
+            m_material = std::make_shared<Material>(*m_material);
+
+        return *m_material;
+    }
+
+    std::shared_ptr<Entity> Model::clone() const
+    {
+        return std::make_shared<Model>(*this);
     }
 
     void Model::draw(const Matrix4x4& viewProjMat, Shader* shaderOverride) const
     {
-        m_material.use();
+        m_material->use();
 
-        Shader&       shader   = shaderOverride ? *shaderOverride : m_material.getShader();
+        Shader&       shader   = shaderOverride ? *shaderOverride : m_material->getShader();
         const Matrix4 modelMat = getWorldMatrix();
 
         shader.setUniformMat4("u_mvp", viewProjMat * modelMat);
@@ -51,4 +67,21 @@ namespace LibGL::Rendering
         Shader::unbind();
         Texture::unbind();
     }
+
+    void Model::serialize(LibGL::Resources::SceneWriter& writer) const
+    {
+        writer.writeResource(m_mesh);
+        m_material->serialize(writer);
+    }
+
+    std::shared_ptr<Model> Model::deserialize(LibGL::Resources::SceneReader& reader)
+    {
+        const Mesh*             mesh     = reader.readResource<Mesh>();
+        std::optional<Material> material = Material::deserialize(reader);
+
+        if (mesh == nullptr || !material)
+            return nullptr;
+
+        return std::make_shared<Model>(nullptr, *mesh, std::move(*material));
+    }
 }
@@ -4,6 +4,8 @@
 #include "Resources/Shader.h"
 #include "Resources/Texture.h"
 
+#include "SceneSerializer.h"
+
 using namespace LibMath;
 
 namespace LibGL::Rendering::Resources
@@ -132,4 +134,42 @@ namespace LibGL::Rendering::Resources
         m_shader->setUniformInt("u_material.specular", 1);
         m_shader->setUniformInt("u_material.normal", 2);
     }
+
+    void Material::serialize(LibGL::Resources::SceneWriter& writer) const
+    {
+        writer.writeResource(m_shader);
+        writer.writeResource(m_maps.m_diffuse);
+        writer.writeResource(m_maps.m_specular);
+        writer.writeResource(m_maps.m_normal);
+        writer.write(m_uvModifiers.m_offset);
+        writer.write(m_uvModifiers.m_scale);
+        writer.write(m_colors.m_tint);
+        writer.write(m_colors.m_specular);
+        writer.write(m_shininess);
+    }
+
+    std::optional<Material> Material::deserialize(LibGL::Resources::SceneReader& reader)
+    {
+        Shader* shader = reader.readResource<Shader>();
+
+        Maps maps{};
+        maps.m_diffuse  = reader.readResource<Texture>();
+        maps.m_specular = reader.readResource<Texture>();
+        maps.m_normal   = reader.readResource<Texture>();
+
+        UVModifiers uvModifiers;
+        uvModifiers.m_offset = reader.read<Vector2>();
+        uvModifiers.m_scale  = reader.read<Vector2>();
+
+        ColorData colors;
+        colors.m_tint     = reader.read<Color>();
+        colors.m_specular = reader.read<Color>();
+
+        const float shininess = reader.read<float>();
+
+        if (shader == nullptr || !reader.isValid())
+            return std::nullopt;
+
+        return Material(*shader, maps, uvModifiers, colors, shininess);
+    }
 }
@@ -66,6 +66,16 @@ namespace LibGL::Rendering::Resources
             GL_UNSIGNED_INT, nullptr);
     }
 
+    const std::vector<Vertex>& Mesh::getVertices() const
+    {
+        return m_vertices;
+    }
+
+    const std::vector<uint32_t>& Mesh::getIndices() const
+    {
+        return m_indices;
+    }
+
     Vector3 Mesh::parseVector3(const std::string& vec3Str)
     {
         std::istringstream vec3Stream(vec3Str);
@@ -16,6 +16,8 @@ using namespace LibGL::Utility;
 
 namespace LibGL::Rendering::Resources
 {
+    REGISTER_RESOURCE_TYPE(MeshMulti);
+
     bool MeshMulti::load(const char* fileName)
     {
         const std::vector<std::string> lines = readFile(fileName);